@@ -11,7 +11,11 @@ DEPS 		:= TransferManager
 AR 			?= ar
 ARFLAGS		:= -rcv
 CXX 		?=
-CXXFLAGS 	:= -Wall -Werror -std=c++11 -pthread
+# Lowest log level built in: 0 trace, 1 debug, 2 info, 3 warning, 4 error,
+# 5 none. Log calls below it are stripped.
+BLSEC_LOG_LEVEL ?= 2
+
+CXXFLAGS 	:= -Wall -Werror -std=c++11 -pthread -DBLSEC_LOG_LEVEL=$(BLSEC_LOG_LEVEL)
 DBGFLAGS 	:= -g -ggdb
 TESTFLAGS 	:= -fprofile-arcs -ftest-coverage --coverage
 LINKFLAGS 	:= -shared
@@ -0,0 +1,84 @@
+#ifndef AUTHENTICATIONBUFFERREADER_H
+#define AUTHENTICATIONBUFFERREADER_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "AuthenticationFieldView.h"
+
+/**
+ * @brief Bounds-checked cursor used to read big-endian fields from a
+ * serialized authentication file. If a field goes past the end of the buffer,
+ * nothing is read and the read fails.
+ */
+class AuthenticationBufferReader
+{
+public:
+        AuthenticationBufferReader(const uint8_t *buffer, size_t size, size_t offset = 0);
+        virtual ~AuthenticationBufferReader();
+
+        /**
+         * @brief Read an 8 bits field.
+         *
+         * @param[out] value value read.
+         *
+         * @return true if the field is inside the buffer.
+         * @return false otherwise.
+         */
+        bool getUint8(uint8_t &value);
+
+        /**
+         * @brief Read a 16 bits field (big-endian).
+         *
+         * @param[out] value value read.
+         *
+         * @return true if the field is inside the buffer.
+         * @return false otherwise.
+         */
+        bool getUint16(uint16_t &value);
+
+        /**
+         * @brief Read a 24 bits field (big-endian).
+         *
+         * @param[out] value value read.
+         *
+         * @return true if the field is inside the buffer.
+         * @return false otherwise.
+         */
+        bool getUint24(uint32_t &value);
+
+        /**
+         * @brief Read a 32 bits field (big-endian).
+         *
+         * @param[out] value value read.
+         *
+         * @return true if the field is inside the buffer.
+         * @return false otherwise.
+         */
+        bool getUint32(uint32_t &value);
+
+        /**
+         * @brief Read a field of size bytes, without copying it.
+         *
+         * @param[in] fieldSize field size in bytes.
+         * @param[out] field view of the field inside the buffer.
+         *
+         * @return true if the field is inside the buffer.
+         * @return false otherwise.
+         */
+        bool getField(size_t fieldSize, AuthenticationFieldView &field);
+
+        /**
+         * @brief Get the current read position.
+         *
+         * @return offset of the next field in the buffer.
+         */
+        size_t getOffset();
+
+private:
+        const uint8_t *buffer;
+        size_t size;
+        size_t offset;
+};
+
+#endif // AUTHENTICATIONBUFFERREADER_H
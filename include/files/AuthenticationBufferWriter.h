@@ -0,0 +1,107 @@
+#ifndef AUTHENTICATIONBUFFERWRITER_H
+#define AUTHENTICATIONBUFFERWRITER_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Bounds-checked cursor used to write big-endian fields into a caller
+ * provided buffer. It never allocates memory: if a field does not fit in the
+ * remaining capacity, nothing is written and the write fails.
+ */
+class AuthenticationBufferWriter
+{
+public:
+        AuthenticationBufferWriter(uint8_t *buffer, size_t capacity);
+        virtual ~AuthenticationBufferWriter();
+
+        /**
+         * @brief Write an 8 bits field.
+         *
+         * @param[in] value value to be written.
+         *
+         * @return true if the value fits in the buffer.
+         * @return false otherwise.
+         */
+        bool putUint8(uint8_t value);
+
+        /**
+         * @brief Write a 16 bits field (big-endian).
+         *
+         * @param[in] value value to be written.
+         *
+         * @return true if the value fits in the buffer.
+         * @return false otherwise.
+         */
+        bool putUint16(uint16_t value);
+
+        /**
+         * @brief Write the 24 least significant bits of value (big-endian).
+         *
+         * @param[in] value value to be written.
+         *
+         * @return true if the value fits in the buffer.
+         * @return false otherwise.
+         */
+        bool putUint24(uint32_t value);
+
+        /**
+         * @brief Write a 32 bits field (big-endian).
+         *
+         * @param[in] value value to be written.
+         *
+         * @return true if the value fits in the buffer.
+         * @return false otherwise.
+         */
+        bool putUint32(uint32_t value);
+
+        /**
+         * @brief Write raw bytes.
+         *
+         * @param[in] data bytes to be written.
+         * @param[in] size number of bytes to be written.
+         *
+         * @return true if the bytes fit in the buffer.
+         * @return false otherwise.
+         */
+        bool putBytes(const void *data, size_t size);
+
+        /**
+         * @brief Mark size bytes, written directly through getCursor(), as
+         * used.
+         *
+         * @param[in] size number of bytes written.
+         *
+         * @return true if size fits in the buffer.
+         * @return false otherwise.
+         */
+        bool advance(size_t size);
+
+        /**
+         * @brief Get the current write position.
+         *
+         * @return pointer to the first unused byte of the buffer.
+         */
+        uint8_t *getCursor();
+
+        /**
+         * @brief Get the number of bytes still available in the buffer.
+         *
+         * @return remaining capacity in bytes.
+         */
+        size_t getRemaining();
+
+        /**
+         * @brief Get the number of bytes written so far.
+         *
+         * @return written bytes.
+         */
+        size_t getWritten();
+
+private:
+        uint8_t *buffer;
+        size_t capacity;
+        size_t written;
+};
+
+#endif // AUTHENTICATIONBUFFERWRITER_H
@@ -0,0 +1,67 @@
+#ifndef AUTHENTICATIONFIELDVIEW_H
+#define AUTHENTICATIONFIELDVIEW_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief Non-owning view of a variable length field of an authentication
+ * file. The view points straight into the buffer it was built from, so that
+ * buffer must outlive the view.
+ */
+class AuthenticationFieldView
+{
+public:
+        AuthenticationFieldView(const uint8_t *data = nullptr, size_t size = 0);
+        virtual ~AuthenticationFieldView();
+
+        /**
+         * @brief Get a pointer to the first byte of the field.
+         *
+         * @return field data (nullptr if the field is empty).
+         */
+        const uint8_t *data() const;
+
+        /**
+         * @brief Get the field size in bytes, as found on the wire. String
+         * fields include their null terminator.
+         *
+         * @return field size in bytes.
+         */
+        size_t size() const;
+
+        /**
+         * @brief Check whether the field is empty.
+         *
+         * @return true if the field has no bytes.
+         * @return false otherwise.
+         */
+        bool empty() const;
+
+        /**
+         * @brief Copy a string field, up to its first null terminator.
+         *
+         * @return owned copy of the string.
+         */
+        std::string toString() const;
+
+        /**
+         * @brief Compare a string field with a string, without copying it.
+         *
+         * @param[in] value string to compare with.
+         *
+         * @return true if the field, up to its first null terminator, is
+         * equal to value.
+         * @return false otherwise.
+         */
+        bool equals(const std::string &value) const;
+
+private:
+        size_t stringLength() const;
+
+        const uint8_t *fieldData;
+        size_t fieldSize;
+};
+
+#endif // AUTHENTICATIONFIELDVIEW_H
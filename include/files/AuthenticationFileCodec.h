@@ -0,0 +1,525 @@
+#ifndef AUTHENTICATIONFILECODEC_H
+#define AUTHENTICATIONFILECODEC_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "AuthenticationBufferReader.h"
+#include "AuthenticationBufferWriter.h"
+#include "AuthenticationJsonWriter.h"
+#include <cjson/cJSON.h>
+
+/*
+ * Field descriptors of the authentication files.
+ *
+ * A file lists its wire fields once, in order, and AuthenticationCodec
+ * generates from that list the binary encoding, the binary decoding, the exact
+ * encoded size and the JSON mapping. Everything is resolved at compile time:
+ * each operation expands to one call per field, with no virtual dispatch.
+ *
+ * Encodings say how a member is laid out on the wire (and in JSON). Fields
+ * bind an encoding to a member and to the JSON names of that member. They are
+ * declared with AUTHENTICATION_CODEC_FIELD and AUTHENTICATION_CODEC_LIST,
+ * inside a struct that has access to the members and defines Owner:
+ *
+ *     struct LoadAuthenticationStatusHeaderFile::Codec
+ *     {
+ *         typedef LoadAuthenticationStatusHeaderFile Owner;
+ *         AUTHENTICATION_CODEC_FIELD(AuthenticationUint24Encoding, loadRatio);
+ *         AUTHENTICATION_CODEC_FIELD(AuthenticationUint16Encoding, loadStatus);
+ *         typedef AuthenticationCodec<Owner, loadRatioField, loadStatusField> Fields;
+ *     };
+ */
+
+/**
+ * @brief Read a JSON number member.
+ *
+ * @return true if the member exists and is a number.
+ */
+template <typename Type>
+inline bool authenticationCodecGetNumber(const cJSON *root, const char *name, Type &value)
+{
+        const cJSON *item = cJSON_GetObjectItemCaseSensitive(root, name);
+        if (!cJSON_IsNumber(item))
+        {
+                return false;
+        }
+        value = static_cast<Type>(item->valueint);
+        return true;
+}
+
+/**
+ * @brief 16 bits big-endian number.
+ */
+struct AuthenticationUint16Encoding
+{
+        typedef uint16_t Type;
+
+        static size_t size(const Type &)
+        {
+                return sizeof(uint16_t);
+        }
+
+        static bool encode(AuthenticationBufferWriter &writer, const Type &value)
+        {
+                return writer.putUint16(value);
+        }
+
+        static bool decode(AuthenticationBufferReader &reader, Type &value)
+        {
+                return reader.getUint16(value);
+        }
+
+        template <typename Names>
+        static void toJSON(AuthenticationJsonWriter &writer, const Type &value)
+        {
+                writer.addNumber(Names::name(), value);
+        }
+
+        template <typename Names>
+        static bool fromJSON(const cJSON *root, Type &value)
+        {
+                return authenticationCodecGetNumber(root, Names::name(), value);
+        }
+};
+
+/**
+ * @brief 24 bits big-endian number, held in the 24 least significant bits of
+ * a 32 bits member.
+ */
+struct AuthenticationUint24Encoding
+{
+        typedef uint32_t Type;
+
+        static size_t size(const Type &)
+        {
+                return 3;
+        }
+
+        static bool encode(AuthenticationBufferWriter &writer, const Type &value)
+        {
+                return writer.putUint24(value);
+        }
+
+        static bool decode(AuthenticationBufferReader &reader, Type &value)
+        {
+                return reader.getUint24(value);
+        }
+
+        template <typename Names>
+        static void toJSON(AuthenticationJsonWriter &writer, const Type &value)
+        {
+                writer.addNumber(Names::name(), value);
+        }
+
+        template <typename Names>
+        static bool fromJSON(const cJSON *root, Type &value)
+        {
+                return authenticationCodecGetNumber(root, Names::name(), value);
+        }
+};
+
+/**
+ * @brief String preceded by its 8 bits length. The member holds the exact
+ * wire bytes, null terminator included, so its size is the length sent.
+ * In JSON, the length is written as "<name>Length" before the string.
+ */
+struct AuthenticationString8Encoding
+{
+        typedef std::string Type;
+
+        static size_t size(const Type &value)
+        {
+                return sizeof(uint8_t) + value.size();
+        }
+
+        static bool encode(AuthenticationBufferWriter &writer, const Type &value)
+        {
+                return value.size() <= UINT8_MAX &&
+                       writer.putUint8(value.size()) &&
+                       writer.putBytes(value.data(), value.size());
+        }
+
+        static bool decode(AuthenticationBufferReader &reader, Type &value)
+        {
+                uint8_t length = 0;
+                AuthenticationFieldView field;
+                if (!reader.getUint8(length) || !reader.getField(length, field))
+                {
+                        return false;
+                }
+                value.assign(reinterpret_cast<const char *>(field.data()), field.size());
+                return true;
+        }
+
+        template <typename Names>
+        static void toJSON(AuthenticationJsonWriter &writer, const Type &value)
+        {
+                writer.addNumber(Names::lengthName(), value.size());
+                writer.addString(Names::name(), value.c_str());
+        }
+
+        template <typename Names>
+        static bool fromJSON(const cJSON *root, Type &value)
+        {
+                uint8_t length = 0;
+                const cJSON *item = cJSON_GetObjectItemCaseSensitive(root, Names::name());
+                if (!authenticationCodecGetNumber(root, Names::lengthName(), length) ||
+                    !cJSON_IsString(item))
+                {
+                        return false;
+                }
+                // Keep the declared length, even if the JSON string is shorter
+                value.assign(item->valuestring,
+                             std::min(static_cast<size_t>(length),
+                                      std::strlen(item->valuestring) + 1));
+                value.resize(length, '\0');
+                return true;
+        }
+};
+
+/**
+ * @brief Raw bytes preceded by their 16 bits length. In JSON, the length is
+ * written as "<name>Length" and the bytes as a lowercase hexadecimal string.
+ */
+struct AuthenticationBytes16Encoding
+{
+        typedef std::vector<uint8_t> Type;
+
+        static size_t size(const Type &value)
+        {
+                return sizeof(uint16_t) + value.size();
+        }
+
+        static bool encode(AuthenticationBufferWriter &writer, const Type &value)
+        {
+                return value.size() <= UINT16_MAX &&
+                       writer.putUint16(value.size()) &&
+                       writer.putBytes(value.data(), value.size());
+        }
+
+        static bool decode(AuthenticationBufferReader &reader, Type &value)
+        {
+                uint16_t length = 0;
+                AuthenticationFieldView field;
+                if (!reader.getUint16(length) || !reader.getField(length, field))
+                {
+                        return false;
+                }
+                value.assign(field.data(), field.data() + field.size());
+                return true;
+        }
+
+        template <typename Names>
+        static void toJSON(AuthenticationJsonWriter &writer, const Type &value)
+        {
+                static const char hexDigits[] = "0123456789abcdef";
+                std::string hex(value.size() * 2, '\0');
+                for (size_t i = 0; i < value.size(); i++)
+                {
+                        hex[i * 2] = hexDigits[value[i] >> 4];
+                        hex[i * 2 + 1] = hexDigits[value[i] & 0x0F];
+                }
+                writer.addNumber(Names::lengthName(), value.size());
+                writer.addString(Names::name(), hex.c_str());
+        }
+
+        template <typename Names>
+        static bool fromJSON(const cJSON *root, Type &value)
+        {
+                uint16_t length = 0;
+                const cJSON *item = cJSON_GetObjectItemCaseSensitive(root, Names::name());
+                if (!authenticationCodecGetNumber(root, Names::lengthName(), length) ||
+                    !cJSON_IsString(item) ||
+                    std::strlen(item->valuestring) != static_cast<size_t>(length) * 2)
+                {
+                        return false;
+                }
+
+                value.resize(length);
+                for (size_t i = 0; i < length; i++)
+                {
+                        int high = hexDigitValue(item->valuestring[i * 2]);
+                        int low = hexDigitValue(item->valuestring[i * 2 + 1]);
+                        if (high < 0 || low < 0)
+                        {
+                                return false;
+                        }
+                        value[i] = (high << 4) | low;
+                }
+                return true;
+        }
+
+private:
+        static int hexDigitValue(char digit)
+        {
+                if (digit >= '0' && digit <= '9')
+                {
+                        return digit - '0';
+                }
+                if (digit >= 'a' && digit <= 'f')
+                {
+                        return digit - 'a' + 10;
+                }
+                if (digit >= 'A' && digit <= 'F')
+                {
+                        return digit - 'A' + 10;
+                }
+                return -1;
+        }
+};
+
+/**
+ * @brief Member of Owner bound to an encoding. Names provides name() and
+ * lengthName(), the JSON member names.
+ */
+template <typename Names, typename Owner, typename Encoding,
+          typename Encoding::Type Owner::*Member>
+struct AuthenticationCodecField
+{
+        static size_t size(const Owner &owner)
+        {
+                return Encoding::size(owner.*Member);
+        }
+
+        static bool encode(AuthenticationBufferWriter &writer, const Owner &owner)
+        {
+                return Encoding::encode(writer, owner.*Member);
+        }
+
+        static bool decode(AuthenticationBufferReader &reader, Owner &owner)
+        {
+                return Encoding::decode(reader, owner.*Member);
+        }
+
+        static void toJSON(AuthenticationJsonWriter &writer, const Owner &owner)
+        {
+                Encoding::template toJSON<Names>(writer, owner.*Member);
+        }
+
+        static bool fromJSON(const cJSON *root, Owner &owner)
+        {
+                return Encoding::template fromJSON<Names>(root, owner.*Member);
+        }
+};
+
+/**
+ * @brief List of elements preceded by their 16 bits count. Elements are
+ * encoded with ElementCodec, an AuthenticationCodec of the element type.
+ * Decoding appends to the list. In JSON, the count is written as
+ * lengthName() and the elements as an array of objects.
+ */
+template <typename Names, typename Owner, typename ElementCodec, typename Element,
+          std::shared_ptr<std::vector<Element>> Owner::*Member>
+struct AuthenticationCodecListField
+{
+        static size_t size(const Owner &owner)
+        {
+                size_t size = sizeof(uint16_t);
+                for (typename std::vector<Element>::const_iterator it = (owner.*Member)->begin();
+                     it != (owner.*Member)->end(); ++it)
+                {
+                        size += ElementCodec::size(*it);
+                }
+                return size;
+        }
+
+        static bool encode(AuthenticationBufferWriter &writer, const Owner &owner)
+        {
+                const std::vector<Element> &elements = *(owner.*Member);
+                if (elements.size() > UINT16_MAX || !writer.putUint16(elements.size()))
+                {
+                        return false;
+                }
+                for (typename std::vector<Element>::const_iterator it = elements.begin();
+                     it != elements.end(); ++it)
+                {
+                        if (!ElementCodec::encode(writer, *it))
+                        {
+                                return false;
+                        }
+                }
+                return true;
+        }
+
+        static bool decode(AuthenticationBufferReader &reader, Owner &owner)
+        {
+                uint16_t count = 0;
+                if (!reader.getUint16(count))
+                {
+                        return false;
+                }
+
+                // Elements are decoded in place, one after the other
+                std::vector<Element> &elements = *(owner.*Member);
+                elements.reserve(elements.size() + count);
+                for (uint16_t i = 0; i < count; i++)
+                {
+                        elements.emplace_back();
+                        if (!ElementCodec::decode(reader, elements.back()))
+                        {
+                                elements.pop_back();
+                                return false;
+                        }
+                }
+                return true;
+        }
+
+        static void toJSON(AuthenticationJsonWriter &writer, const Owner &owner)
+        {
+                const std::vector<Element> &elements = *(owner.*Member);
+                writer.addNumber(Names::lengthName(), elements.size());
+                writer.beginArray(Names::name());
+                for (typename std::vector<Element>::const_iterator it = elements.begin();
+                     it != elements.end(); ++it)
+                {
+                        writer.beginObject();
+                        ElementCodec::toJSON(writer, *it);
+                        writer.endObject();
+                }
+                writer.endArray();
+        }
+
+        static bool fromJSON(const cJSON *root, Owner &owner)
+        {
+                uint16_t count = 0;
+                const cJSON *array = cJSON_GetObjectItemCaseSensitive(root, Names::name());
+                if (!authenticationCodecGetNumber(root, Names::lengthName(), count) ||
+                    !cJSON_IsArray(array) || cJSON_GetArraySize(array) != count)
+                {
+                        return false;
+                }
+
+                // Walk the array once, decoding every element in place
+                std::vector<Element> &elements = *(owner.*Member);
+                elements.reserve(elements.size() + count);
+                for (const cJSON *item = array->child; item != nullptr; item = item->next)
+                {
+                        elements.emplace_back();
+                        if (!ElementCodec::fromJSON(item, elements.back()))
+                        {
+                                elements.pop_back();
+                                return false;
+                        }
+                }
+                return true;
+        }
+};
+
+/**
+ * @brief Codec generated from an ordered list of fields of Owner.
+ */
+template <typename Owner, typename... Fields>
+struct AuthenticationCodec;
+
+template <typename Owner>
+struct AuthenticationCodec<Owner>
+{
+        static size_t size(const Owner &)
+        {
+                return 0;
+        }
+
+        static bool encode(AuthenticationBufferWriter &, const Owner &)
+        {
+                return true;
+        }
+
+        static bool decode(AuthenticationBufferReader &, Owner &)
+        {
+                return true;
+        }
+
+        static void toJSON(AuthenticationJsonWriter &, const Owner &)
+        {
+        }
+
+        static bool fromJSON(const cJSON *, Owner &)
+        {
+                return true;
+        }
+};
+
+template <typename Owner, typename Field, typename... Fields>
+struct AuthenticationCodec<Owner, Field, Fields...>
+{
+        typedef AuthenticationCodec<Owner, Fields...> Next;
+
+        /**
+         * @brief Exact encoded size of owner, in bytes.
+         */
+        static size_t size(const Owner &owner)
+        {
+                return Field::size(owner) + Next::size(owner);
+        }
+
+        /**
+         * @brief Encode owner at the writer cursor.
+         *
+         * @return false if a field does not fit or cannot be encoded.
+         */
+        static bool encode(AuthenticationBufferWriter &writer, const Owner &owner)
+        {
+                return Field::encode(writer, owner) && Next::encode(writer, owner);
+        }
+
+        /**
+         * @brief Decode owner from the reader cursor.
+         *
+         * @return false if the buffer ends before the last field.
+         */
+        static bool decode(AuthenticationBufferReader &reader, Owner &owner)
+        {
+                return Field::decode(reader, owner) && Next::decode(reader, owner);
+        }
+
+        /**
+         * @brief Write the fields of owner as members of the open JSON object.
+         */
+        static void toJSON(AuthenticationJsonWriter &writer, const Owner &owner)
+        {
+                Field::toJSON(writer, owner);
+                Next::toJSON(writer, owner);
+        }
+
+        /**
+         * @brief Read the fields of owner from the members of a JSON object.
+         *
+         * @return false if a member is missing or has the wrong type.
+         */
+        static bool fromJSON(const cJSON *root, Owner &owner)
+        {
+                return Field::fromJSON(root, owner) && Next::fromJSON(root, owner);
+        }
+};
+
+/**
+ * @brief Declare the descriptor memberField of Owner::member.
+ */
+#define AUTHENTICATION_CODEC_FIELD(Encoding, member)                              \
+        struct member##Field                                                      \
+            : AuthenticationCodecField<member##Field, Owner, Encoding, &Owner::member> \
+        {                                                                         \
+                static const char *name() { return #member; }                     \
+                static const char *lengthName() { return #member "Length"; }      \
+        }
+
+/**
+ * @brief Declare the descriptor memberField of the list Owner::member, whose
+ * count is named countName.
+ */
+#define AUTHENTICATION_CODEC_LIST(ElementCodec, Element, member, countName)         \
+        struct member##Field                                                        \
+            : AuthenticationCodecListField<member##Field, Owner, ElementCodec,      \
+                                           Element, &Owner::member>                 \
+        {                                                                           \
+                static const char *name() { return #member; }                       \
+                static const char *lengthName() { return #countName; }              \
+        }
+
+#endif // AUTHENTICATIONFILECODEC_H
@@ -0,0 +1,109 @@
+#ifndef AUTHENTICATIONFILEVALIDATOR_H
+#define AUTHENTICATIONFILEVALIDATOR_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "BaseAuthenticationFile.h"
+
+/**
+ * @brief Kind of authentication file to validate.
+ * Possible values are:
+ * - AUTHENTICATION_FILE_KIND_INITIALIZATION: Initialization file (.LAI).
+ * - AUTHENTICATION_FILE_KIND_LOAD_REQUEST:   Load Authentication Request file (.LAR).
+ * - AUTHENTICATION_FILE_KIND_LOAD_STATUS:    Load Authentication Status file (.LAS).
+ */
+enum class AuthenticationFileKind
+{
+    AUTHENTICATION_FILE_KIND_INITIALIZATION = 0,
+    AUTHENTICATION_FILE_KIND_LOAD_REQUEST,
+    AUTHENTICATION_FILE_KIND_LOAD_STATUS
+};
+
+/**
+ * @brief Result of the framing validation of a received file.
+ * Possible values are:
+ * - AUTHENTICATION_FILE_VALID:                    The framing is valid.
+ * - AUTHENTICATION_FILE_TRUNCATED:                The buffer is shorter than
+ *                                                 the File Length field or
+ *                                                 than the File Length.
+ * - AUTHENTICATION_FILE_INVALID_FILE_LENGTH:      File Length is shorter than
+ *                                                 the fixed fields of the file.
+ * - AUTHENTICATION_FILE_INVALID_PROTOCOL_VERSION: Unexpected protocol version.
+ * - AUTHENTICATION_FILE_INVALID_FIELD_LENGTH:     A length field points past
+ *                                                 the end of the file.
+ * - AUTHENTICATION_FILE_INVALID_HEADER_COUNT:     The file ends before the
+ *                                                 announced number of header
+ *                                                 files.
+ * - AUTHENTICATION_FILE_TRAILING_DATA:            The fields end before File
+ *                                                 Length.
+ */
+enum class AuthenticationFileValidationResult
+{
+    AUTHENTICATION_FILE_VALID = 0,
+    AUTHENTICATION_FILE_TRUNCATED,
+    AUTHENTICATION_FILE_INVALID_FILE_LENGTH,
+    AUTHENTICATION_FILE_INVALID_PROTOCOL_VERSION,
+    AUTHENTICATION_FILE_INVALID_FIELD_LENGTH,
+    AUTHENTICATION_FILE_INVALID_HEADER_COUNT,
+    AUTHENTICATION_FILE_TRAILING_DATA
+};
+
+#define AUTHENTICATION_FILE_VALIDATION_RESULTS 7
+
+/**
+ * @brief Framing validator for received authentication files.
+ *
+ * The length prefix, the protocol version, every nested length field and the
+ * number of header files are checked against the buffer bounds in a single
+ * pass, without allocating, so malformed files are rejected before anything
+ * is built from them. Every validation is counted by its result.
+ */
+class AuthenticationFileValidator
+{
+public:
+        AuthenticationFileValidator(std::string protocolVersion =
+                                        std::string(AUTHENTICATION_VERSION));
+        virtual ~AuthenticationFileValidator();
+
+        /**
+         * @brief Validate the framing of a serialized file. Only the first
+         * File Length bytes of data are part of the file, so data may be
+         * larger than the file.
+         *
+         * @param[in] data buffer holding the serialized file.
+         * @param[in] dataSize size of the buffer in bytes.
+         * @param[in] kind kind of file expected in the buffer.
+         *
+         * @return AUTHENTICATION_FILE_VALID if the framing is valid.
+         * @return the reason of the rejection otherwise.
+         */
+        AuthenticationFileValidationResult validate(const uint8_t *data, size_t dataSize,
+                                                    AuthenticationFileKind kind);
+
+        /**
+         * @brief Get how many validations ended with a given result.
+         *
+         * @param[in] result validation result.
+         *
+         * @return number of validations with this result.
+         */
+        uint32_t getNumberOfValidations(AuthenticationFileValidationResult result);
+
+        /**
+         * @brief Get how many files were rejected, whatever the reason.
+         *
+         * @return number of rejected files.
+         */
+        uint32_t getNumberOfRejectedFiles();
+
+private:
+        AuthenticationFileValidationResult check(const uint8_t *data, size_t dataSize,
+                                                 AuthenticationFileKind kind);
+
+        char protocolVersion[PROTOCOL_VERSION_SIZE];
+        std::atomic<uint32_t> validations[AUTHENTICATION_FILE_VALIDATION_RESULTS];
+};
+
+#endif // AUTHENTICATIONFILEVALIDATOR_H
@@ -0,0 +1,91 @@
+#ifndef AUTHENTICATIONHEADERVIEWITERATOR_H
+#define AUTHENTICATIONHEADERVIEWITERATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+/**
+ * @brief Forward iterator over the header files of an authentication file
+ * view. Each step decodes the next header view in place from the wire buffer.
+ * The buffer framing must have been validated by the owning view, so decoding
+ * a header never fails while iterating.
+ *
+ * @tparam HeaderView header view type. It must provide
+ *         parse(const uint8_t *data, size_t dataSize, size_t &offset).
+ */
+template <typename HeaderView>
+class AuthenticationHeaderViewIterator
+{
+public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef HeaderView value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const HeaderView *pointer;
+        typedef const HeaderView &reference;
+
+        AuthenticationHeaderViewIterator(const uint8_t *data = nullptr,
+                                         size_t dataSize = 0,
+                                         size_t offset = 0,
+                                         uint16_t remainingHeaderFiles = 0)
+            : data(data), dataSize(dataSize), offset(offset),
+              remainingHeaderFiles(remainingHeaderFiles)
+        {
+                decodeCurrent();
+        }
+
+        reference operator*() const
+        {
+                return current;
+        }
+
+        pointer operator->() const
+        {
+                return &current;
+        }
+
+        AuthenticationHeaderViewIterator &operator++()
+        {
+                if (remainingHeaderFiles > 0)
+                {
+                        remainingHeaderFiles--;
+                        decodeCurrent();
+                }
+                return *this;
+        }
+
+        AuthenticationHeaderViewIterator operator++(int)
+        {
+                AuthenticationHeaderViewIterator previous = *this;
+                ++(*this);
+                return previous;
+        }
+
+        bool operator==(const AuthenticationHeaderViewIterator &other) const
+        {
+                return remainingHeaderFiles == other.remainingHeaderFiles;
+        }
+
+        bool operator!=(const AuthenticationHeaderViewIterator &other) const
+        {
+                return !(*this == other);
+        }
+
+private:
+        void decodeCurrent()
+        {
+                if (remainingHeaderFiles > 0)
+                {
+                        // Advances offset to the beginning of the next header
+                        current.parse(data, dataSize, offset);
+                }
+        }
+
+        const uint8_t *data;
+        size_t dataSize;
+        size_t offset;
+        uint16_t remainingHeaderFiles;
+        HeaderView current;
+};
+
+#endif // AUTHENTICATIONHEADERVIEWITERATOR_H
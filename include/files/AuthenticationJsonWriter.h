@@ -0,0 +1,71 @@
+#ifndef AUTHENTICATIONJSONWRITER_H
+#define AUTHENTICATIONJSONWRITER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief Streaming JSON emitter used to serialize authentication files.
+ *
+ * Values are appended to the output string as they are written, without
+ * building a tree. The output is formatted exactly as cJSON_PrintUnformatted
+ * formats it, so it can replace a cJSON tree that is only built to be printed.
+ */
+class AuthenticationJsonWriter
+{
+public:
+        AuthenticationJsonWriter(std::string &output);
+        virtual ~AuthenticationJsonWriter();
+
+        /**
+         * @brief Open an object.
+         *
+         * @param[in] name member name, or nullptr if the object is an array
+         * element or the root value.
+         */
+        void beginObject(const char *name = nullptr);
+
+        /**
+         * @brief Close the last open object.
+         */
+        void endObject();
+
+        /**
+         * @brief Open an array.
+         *
+         * @param[in] name member name, or nullptr if the array is an array
+         * element or the root value.
+         */
+        void beginArray(const char *name = nullptr);
+
+        /**
+         * @brief Close the last open array.
+         */
+        void endArray();
+
+        /**
+         * @brief Write a string value.
+         *
+         * @param[in] name member name, or nullptr for an array element.
+         * @param[in] value null terminated string to be written.
+         */
+        void addString(const char *name, const char *value);
+
+        /**
+         * @brief Write a number value.
+         *
+         * @param[in] name member name, or nullptr for an array element.
+         * @param[in] value number to be written.
+         */
+        void addNumber(const char *name, double value);
+
+private:
+        void beginValue(const char *name);
+        void appendString(const char *value);
+
+        std::string &output;
+        bool firstValue;
+};
+
+#endif // AUTHENTICATIONJSONWRITER_H
@@ -7,6 +7,7 @@
 
 #include "ISerializableAuthentication.h"
 #include "IFileAuthentication.h"
+#include "AuthenticationJsonWriter.h"
 #include <cjson/cJSON.h>
 
 #define PROTOCOL_VERSION_SIZE static_cast<size_t>(2) // bytes
@@ -57,9 +58,15 @@ public:
         SerializableAuthenticationOperationResult serialize(
             std::shared_ptr<std::vector<uint8_t>> &data) override;
 
+        SerializableAuthenticationOperationResult serializeInto(
+            uint8_t *buffer, size_t capacity, size_t &written) override;
+
         SerializableAuthenticationOperationResult deserialize(
             std::shared_ptr<std::vector<uint8_t>> &data) override;
 
+        SerializableAuthenticationOperationResult deserializeFrom(
+            const uint8_t *data, size_t dataSize) override;
+
         SerializableAuthenticationOperationResult serializeJSON(
             std::string &data) override;
 
@@ -67,6 +74,31 @@ public:
             std::string &data) override;
 
 protected:
+        /**
+         * @brief Write the JSON members of the file. Derived files override
+         * it to append their own members after the ones of their parent.
+         *
+         * @param[in] writer writer positioned inside the file object.
+         *
+         * @return SERIALIZABLE_AUTHENTICATION_OK if success.
+         * @return SERIALIZABLE_AUTHENTICATION_ERROR otherwise.
+         */
+        virtual SerializableAuthenticationOperationResult serializeJSONFields(
+            AuthenticationJsonWriter &writer);
+
+        /**
+         * @brief Read the JSON members of the file from the parsed JSON.
+         * Derived files override it to read their own members after the ones
+         * of their parent.
+         *
+         * @param[in] root JSON object of the file.
+         *
+         * @return SERIALIZABLE_AUTHENTICATION_OK if success.
+         * @return SERIALIZABLE_AUTHENTICATION_ERROR otherwise.
+         */
+        virtual SerializableAuthenticationOperationResult deserializeJSONFields(
+            const cJSON *root);
+
         uint32_t fileLength;
         char protocolVersion[PROTOCOL_VERSION_SIZE];
 
@@ -2,6 +2,7 @@
 #define INITIALIZATIONAUTHENTICATIONFILE_H
 
 #include "BaseAuthenticationFile.h"
+#include "AuthenticationFieldView.h"
 
 //TODO: MAX_CRYPTOGRAPHIC_KEY_SIZE should be 512, but it's 65535 for now, as
 //      we're sending the whole S-expression, not only the key.
@@ -76,6 +77,17 @@ public:
         FileAuthenticationOperationResult setCryptographicKey(
             std::vector<uint8_t> &cryptographicKey);
 
+        /**
+         * @brief Set Cryptographic Key, taking ownership of its buffer.
+         *
+         * @param[in] cryptographicKey Cryptographic Key. Left empty on success.
+         *
+         * @return FILE_AUTHENTICATION_OPERATION_OK if success.
+         * @return FILE_AUTHENTICATION_OPERATION_ERROR otherwise.
+         */
+        FileAuthenticationOperationResult setCryptographicKey(
+            std::vector<uint8_t> &&cryptographicKey);
+
         /**
          * @brief Get Cryptographic Key.
          *
@@ -87,6 +99,29 @@ public:
         FileAuthenticationOperationResult getCryptographicKey(
             std::vector<uint8_t> &cryptographicKey);
 
+        /**
+         * @brief Get Cryptographic Key without copying it. The view is valid
+         * until the key is changed or the file is destroyed.
+         *
+         * @param[out] cryptographicKey Cryptographic Key.
+         *
+         * @return FILE_AUTHENTICATION_OPERATION_OK if success.
+         * @return FILE_AUTHENTICATION_OPERATION_ERROR otherwise.
+         */
+        FileAuthenticationOperationResult getCryptographicKey(
+            AuthenticationFieldView &cryptographicKey) const;
+
+        /**
+         * @brief Move the Cryptographic Key out of the file, leaving it empty.
+         *
+         * @param[out] cryptographicKey Cryptographic Key.
+         *
+         * @return FILE_AUTHENTICATION_OPERATION_OK if success.
+         * @return FILE_AUTHENTICATION_OPERATION_ERROR otherwise.
+         */
+        FileAuthenticationOperationResult releaseCryptographicKey(
+            std::vector<uint8_t> &cryptographicKey);
+
         /**
          * @brief Get Status Description Length
          *
@@ -122,24 +157,28 @@ public:
 
         FileAuthenticationOperationResult getFileSize(size_t &fileSize) override;
 
-        SerializableAuthenticationOperationResult serialize(
-            std::shared_ptr<std::vector<uint8_t>> &data) override;
+        SerializableAuthenticationOperationResult serializeInto(
+            uint8_t *buffer, size_t capacity, size_t &written) override;
 
-        SerializableAuthenticationOperationResult deserialize(
-            std::shared_ptr<std::vector<uint8_t>> &data) override;
+        SerializableAuthenticationOperationResult deserializeFrom(
+            const uint8_t *data, size_t dataSize) override;
 
-        SerializableAuthenticationOperationResult serializeJSON(
-            std::string &data) override;
+protected:
+        SerializableAuthenticationOperationResult serializeJSONFields(
+            AuthenticationJsonWriter &writer) override;
 
-        SerializableAuthenticationOperationResult deserializeJSON(
-            std::string &data) override;
+        SerializableAuthenticationOperationResult deserializeJSONFields(
+            const cJSON *root) override;
 
 private:
+        // Wire field layout, defined with the implementation
+        struct Codec;
+
         uint16_t operationAcceptanceStatusCode;
-        uint16_t cryptographicKeyLength;
-        uint8_t cryptographicKey[MAX_CRYPTOGRAPHIC_KEY_SIZE];
-        uint8_t statusDescriptionLength;
-        char statusDescription[MAX_STATUS_DESCRIPTION_SIZE];
+        // Sized to the actual key, its size is the length sent on the wire.
+        std::vector<uint8_t> cryptographicKey;
+        // Exact wire bytes, null terminator included.
+        std::string statusDescription;
 };
 
 #endif // INITIALIZATIONAUTHENTICATIONFILE_H
@@ -0,0 +1,143 @@
+#ifndef LOADAUTHENTICATIONREQUESTVIEW_H
+#define LOADAUTHENTICATIONREQUESTVIEW_H
+
+#include "LoadAuthenticationRequestFile.h"
+#include "AuthenticationFieldView.h"
+#include "AuthenticationHeaderViewIterator.h"
+
+/**
+ * @brief Read-only view of a serialized Load Authentication Request header
+ * file. Fields are read straight from the wire buffer.
+ */
+class LoadAuthenticationRequestHeaderView
+{
+public:
+        LoadAuthenticationRequestHeaderView();
+        virtual ~LoadAuthenticationRequestHeaderView();
+
+        /**
+         * @brief Get Header File Name
+         *
+         * @param[out] headerFileName Header File Name, including its null
+         * terminator.
+         *
+         * @return FILE_AUTHENTICATION_OPERATION_OK if success.
+         * @return FILE_AUTHENTICATION_OPERATION_ERROR otherwise.
+         */
+        FileAuthenticationOperationResult getHeaderFileName(
+            AuthenticationFieldView &headerFileName) const;
+
+        /**
+         * @brief Get Load Part Number Name
+         *
+         * @param[out] loadPartNumberName Load Part Number Name, including its
+         * null terminator.
+         *
+         * @return FILE_AUTHENTICATION_OPERATION_OK if success.
+         * @return FILE_AUTHENTICATION_OPERATION_ERROR otherwise.
+         */
+        FileAuthenticationOperationResult getLoadPartNumberName(
+            AuthenticationFieldView &loadPartNumberName) const;
+
+        /**
+         * @brief Parse a header file at offset of data. On success, offset is
+         * advanced past this header file.
+         *
+         * @param[in] data buffer holding the serialized header file.
+         * @param[in] dataSize size of the buffer in bytes.
+         * @param[in,out] offset position of the header file in the buffer.
+         *
+         * @return SERIALIZABLE_AUTHENTICATION_OK if success.
+         * @return SERIALIZABLE_AUTHENTICATION_ERROR otherwise.
+         */
+        SerializableAuthenticationOperationResult parse(
+            const uint8_t *data, size_t dataSize, size_t &offset);
+
+private:
+        AuthenticationFieldView headerFileName;
+        AuthenticationFieldView loadPartNumberName;
+};
+
+/**
+ * @brief Read-only view of a serialized Load Authentication Request file.
+ *
+ * The framing of the whole file, header files included, is validated once by
+ * parse(). After that, header files are read straight from the wire buffer
+ * without copying them. The buffer must outlive the view.
+ */
+class LoadAuthenticationRequestView
+{
+public:
+        typedef AuthenticationHeaderViewIterator<LoadAuthenticationRequestHeaderView>
+            HeaderFileIterator;
+
+        LoadAuthenticationRequestView();
+        virtual ~LoadAuthenticationRequestView();
+
+        /**
+         * @brief Validate the framing of a serialized file and bind the view
+         * to it. Only the first File Length bytes of data are used, so data
+         * may be larger than the file.
+         *
+         * @param[in] data buffer holding the serialized file.
+         * @param[in] dataSize size of the buffer in bytes.
+         *
+         * @return SERIALIZABLE_AUTHENTICATION_OK if success.
+         * @return SERIALIZABLE_AUTHENTICATION_ERROR otherwise.
+         */
+        SerializableAuthenticationOperationResult parse(
+            const uint8_t *data, size_t dataSize);
+
+        /**
+         * @brief Get File Length
+         *
+         * @param[out] fileLength File Length.
+         *
+         * @return FILE_AUTHENTICATION_OPERATION_OK if success.
+         * @return FILE_AUTHENTICATION_OPERATION_ERROR otherwise.
+         */
+        FileAuthenticationOperationResult getFileLength(uint32_t &fileLength) const;
+
+        /**
+         * @brief Get Protocol Version
+         *
+         * @param[out] protocolVersion Protocol Version (not null terminated).
+         *
+         * @return FILE_AUTHENTICATION_OPERATION_OK if success.
+         * @return FILE_AUTHENTICATION_OPERATION_ERROR otherwise.
+         */
+        FileAuthenticationOperationResult getProtocolVersion(
+            AuthenticationFieldView &protocolVersion) const;
+
+        /**
+         * @brief Get Number of Header Files
+         *
+         * @param[out] numberOfHeaderFiles Number of Header Files
+         *
+         * @return FILE_AUTHENTICATION_OPERATION_OK if success.
+         * @return FILE_AUTHENTICATION_OPERATION_ERROR otherwise.
+         */
+        FileAuthenticationOperationResult getNumberOfHeaderFiles(
+            uint16_t &numberOfHeaderFiles) const;
+
+        /**
+         * @brief Iterator to the first header file. Equal to end() if the
+         * view was not successfully parsed.
+         */
+        HeaderFileIterator begin() const;
+
+        /**
+         * @brief Iterator past the last header file.
+         */
+        HeaderFileIterator end() const;
+
+private:
+        bool valid;
+        const uint8_t *data;
+        uint32_t fileLength;
+        AuthenticationFieldView protocolVersion;
+        uint16_t numberOfHeaderFiles;
+        size_t headerFilesOffset;
+};
+
+#endif // LOADAUTHENTICATIONREQUESTVIEW_H
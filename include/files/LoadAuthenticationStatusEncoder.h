@@ -0,0 +1,195 @@
+#ifndef LOADAUTHENTICATIONSTATUSENCODER_H
+#define LOADAUTHENTICATIONSTATUSENCODER_H
+
+#include "LoadAuthenticationStatusFile.h"
+
+/**
+ * @brief Incremental encoder of Load Authentication Status files.
+ *
+ * The last encoded file is kept along with the offset of its fixed-width
+ * fields. Setting one of those fields patches it in the encoded file, so a
+ * status period where only counters, ratios and load statuses change costs
+ * the same whatever the size of the load list. The file is only encoded
+ * again when the length of a description or the load list itself changes.
+ */
+class LoadAuthenticationStatusEncoder
+{
+public:
+        LoadAuthenticationStatusEncoder(std::string protocolVersion =
+                                            std::string(AUTHENTICATION_VERSION));
+        virtual ~LoadAuthenticationStatusEncoder();
+
+        /**
+         * @brief Set Authentication Operation Status Code
+         *
+         * @param[in] authenticationOperationStatusCode Load Authentication Operation Status Code.
+         *
+         * @return FILE_AUTHENTICATION_OPERATION_OK if success.
+         * @return FILE_AUTHENTICATION_OPERATION_ERROR otherwise.
+         */
+        FileAuthenticationOperationResult setAuthenticationOperationStatusCode(
+            uint16_t authenticationOperationStatusCode);
+
+        /**
+         * @brief Set Authentication Status Description
+         *
+         * @param[in] authenticationStatusDescription Load Authentication Status Description.
+         *
+         * @return FILE_AUTHENTICATION_OPERATION_OK if success.
+         * @return FILE_AUTHENTICATION_OPERATION_ERROR otherwise.
+         */
+        FileAuthenticationOperationResult setAuthenticationStatusDescription(
+            std::string authenticationStatusDescription);
+
+        /**
+         * @brief Remove the Authentication Status Description, so it is sent
+         * with length zero.
+         *
+         * @return FILE_AUTHENTICATION_OPERATION_OK if success.
+         * @return FILE_AUTHENTICATION_OPERATION_ERROR otherwise.
+         */
+        FileAuthenticationOperationResult clearAuthenticationStatusDescription();
+
+        /**
+         * @brief Set Counter
+         *
+         * @param[in] counter Status counter
+         *
+         * @return FILE_AUTHENTICATION_OPERATION_OK if success.
+         * @return FILE_AUTHENTICATION_OPERATION_ERROR otherwise.
+         */
+        FileAuthenticationOperationResult setCounter(uint16_t counter);
+
+        /**
+         * @brief Get Counter
+         *
+         * @param[out] counter Status counter
+         *
+         * @return FILE_AUTHENTICATION_OPERATION_OK if success.
+         * @return FILE_AUTHENTICATION_OPERATION_ERROR otherwise.
+         */
+        FileAuthenticationOperationResult getCounter(uint16_t &counter);
+
+        /**
+         * @brief Set Exception Timer
+         *
+         * @param[in] exceptionTimer Exception Timer
+         *
+         * @return FILE_AUTHENTICATION_OPERATION_OK if success.
+         * @return FILE_AUTHENTICATION_OPERATION_ERROR otherwise.
+         */
+        FileAuthenticationOperationResult setExceptionTimer(uint16_t exceptionTimer);
+
+        /**
+         * @brief Set Estimated Time
+         *
+         * @param[in] estimatedTime Estimated Time
+         *
+         * @return FILE_AUTHENTICATION_OPERATION_OK if success.
+         * @return FILE_AUTHENTICATION_OPERATION_ERROR otherwise.
+         */
+        FileAuthenticationOperationResult setEstimatedTime(uint16_t estimatedTime);
+
+        /**
+         * @brief Set Load List Ratio
+         *
+         * @param[in] loadListRatio Load List Ratio
+         *
+         * @return FILE_AUTHENTICATION_OPERATION_OK if success.
+         * @return FILE_AUTHENTICATION_OPERATION_ERROR otherwise.
+         */
+        FileAuthenticationOperationResult setLoadListRatio(uint32_t loadListRatio);
+
+        /**
+         * @brief Set the header files. The list is shared, not copied: it
+         * must only be changed through this encoder from now on.
+         *
+         * @param[in] headerFiles List of header files.
+         *
+         * @return FILE_AUTHENTICATION_OPERATION_OK if success.
+         * @return FILE_AUTHENTICATION_OPERATION_ERROR otherwise.
+         */
+        FileAuthenticationOperationResult setHeaderFiles(
+            std::shared_ptr<std::vector<LoadAuthenticationStatusHeaderFile>> &headerFiles);
+
+        /**
+         * @brief Set the Load Ratio of a header file.
+         *
+         * @param[in] index position of the header file in the list.
+         * @param[in] loadRatio Load Ratio.
+         *
+         * @return FILE_AUTHENTICATION_OPERATION_OK if success.
+         * @return FILE_AUTHENTICATION_OPERATION_ERROR otherwise.
+         */
+        FileAuthenticationOperationResult setHeaderFileLoadRatio(size_t index,
+                                                                 uint32_t loadRatio);
+
+        /**
+         * @brief Set the Load Status of a header file.
+         *
+         * @param[in] index position of the header file in the list.
+         * @param[in] loadStatus Load Status.
+         *
+         * @return FILE_AUTHENTICATION_OPERATION_OK if success.
+         * @return FILE_AUTHENTICATION_OPERATION_ERROR otherwise.
+         */
+        FileAuthenticationOperationResult setHeaderFileLoadStatus(size_t index,
+                                                                  uint16_t loadStatus);
+
+        /**
+         * @brief Set the Load Status Description of a header file.
+         *
+         * @param[in] index position of the header file in the list.
+         * @param[in] loadStatusDescription Load Status Description.
+         *
+         * @return FILE_AUTHENTICATION_OPERATION_OK if success.
+         * @return FILE_AUTHENTICATION_OPERATION_ERROR otherwise.
+         */
+        FileAuthenticationOperationResult setHeaderFileLoadStatusDescription(
+            size_t index, std::string loadStatusDescription);
+
+        /**
+         * @brief Get the encoded file, encoding it again only if needed. The
+         * buffer is owned by the encoder and is valid until the next call to
+         * any of its methods.
+         *
+         * @param[out] data encoded file.
+         * @param[out] size size of the encoded file in bytes.
+         *
+         * @return SERIALIZABLE_AUTHENTICATION_OK if success.
+         * @return SERIALIZABLE_AUTHENTICATION_ERROR otherwise.
+         */
+        SerializableAuthenticationOperationResult encode(uint8_t *&data, size_t &size);
+
+        /**
+         * @brief Get how many times the whole file was encoded.
+         *
+         * @return number of full encodes.
+         */
+        uint32_t getNumberOfFullEncodes();
+
+private:
+        SerializableAuthenticationOperationResult encodeAll();
+        void patchUint16(size_t offset, uint16_t value);
+        void patchUint24(size_t offset, uint32_t value);
+
+        char protocolVersion[PROTOCOL_VERSION_SIZE];
+        uint16_t authenticationOperationStatusCode;
+        // Exact wire bytes, null terminator included.
+        std::string authenticationStatusDescription;
+        uint16_t counter;
+        uint16_t exceptionTimer;
+        uint16_t estimatedTime;
+        uint32_t loadListRatio; // This must be a 24-bit value
+        std::shared_ptr<std::vector<LoadAuthenticationStatusHeaderFile>> headerFiles;
+
+        // Last encoded file, only valid when encoded is true
+        bool encoded;
+        std::vector<uint8_t> image;
+        size_t counterOffset;
+        // Offset of the Load Ratio of each header file
+        std::vector<size_t> headerFileOffsets;
+        uint32_t numberOfFullEncodes;
+};
+
+#endif // LOADAUTHENTICATIONSTATUSENCODER_H
@@ -204,24 +204,72 @@ public:
         SerializableAuthenticationOperationResult serialize(
             std::shared_ptr<std::vector<uint8_t>> &data) override;
 
+        SerializableAuthenticationOperationResult serializeInto(
+            uint8_t *buffer, size_t capacity, size_t &written) override;
+
         SerializableAuthenticationOperationResult deserialize(
             std::shared_ptr<std::vector<uint8_t>> &data) override;
 
+        SerializableAuthenticationOperationResult deserializeFrom(
+            const uint8_t *data, size_t dataSize) override;
+
+        /**
+         * @brief Deserialize object in place from a larger buffer. Parsing
+         *        starts at offset and, on success, offset is advanced past
+         *        this header file, so consecutive headers can be decoded
+         *        from the same buffer without copying it.
+         *
+         * @param[in] data buffer holding the serialized object.
+         * @param[in] dataSize size of the buffer in bytes.
+         * @param[in,out] offset position of the header file in the buffer.
+         *
+         * @return SERIALIZABLE_AUTHENTICATION_OK if success.
+         * @return SERIALIZABLE_AUTHENTICATION_ERROR otherwise.
+         */
+        SerializableAuthenticationOperationResult deserialize(
+            const uint8_t *data, size_t dataSize, size_t &offset);
+
         SerializableAuthenticationOperationResult serializeJSON(
             std::string &data) override;
 
+        /**
+         * @brief Append the header file, as a JSON object, to the JSON being
+         * written by writer.
+         *
+         * @param[in] writer JSON writer.
+         *
+         * @return SERIALIZABLE_AUTHENTICATION_OK if success.
+         * @return SERIALIZABLE_AUTHENTICATION_ERROR otherwise.
+         */
+        SerializableAuthenticationOperationResult serializeJSON(
+            AuthenticationJsonWriter &writer);
+
         SerializableAuthenticationOperationResult deserializeJSON(
             std::string &data) override;
 
+        /**
+         * @brief Deserialize the header file from a JSON object that is
+         * already parsed, such as an element of its parent's header list.
+         *
+         * @param[in] root JSON object of the header file.
+         *
+         * @return SERIALIZABLE_AUTHENTICATION_OK if success.
+         * @return SERIALIZABLE_AUTHENTICATION_ERROR otherwise.
+         */
+        SerializableAuthenticationOperationResult deserializeJSON(const cJSON *root);
+
+        // Wire field layout, defined with the implementation. The parent
+        // file's layout uses it to encode its list of header files.
+        struct Codec;
+
 private:
-        uint8_t headerFileNameLength;
-        char headerFileName[MAX_HEADER_FILE_NAME_SIZE];
-        uint8_t loadPartNumberNameLength;
-        char loadPartNumberName[MAX_LOAD_PART_NUMBER_NAME_SIZE];
+        // Fields hold their exact wire bytes, null terminator included, so
+        // their size is the length sent on the wire.
+        std::string headerFileName;
+        std::string loadPartNumberName;
         uint32_t loadRatio; // This must be a 24-bit value
         uint16_t loadStatus;
-        uint8_t loadStatusDescriptionLength;
-        char loadStatusDescription[MAX_LOAD_STATUS_DESCRIPTION_SIZE];
+        std::string loadStatusDescription;
 };
 
 class LoadAuthenticationStatusFile : public BaseAuthenticationFile
@@ -393,27 +441,30 @@ public:
 
         FileAuthenticationOperationResult getFileSize(size_t &fileSize) override;
 
-        SerializableAuthenticationOperationResult serialize(
-            std::shared_ptr<std::vector<uint8_t>> &data) override;
+        SerializableAuthenticationOperationResult serializeInto(
+            uint8_t *buffer, size_t capacity, size_t &written) override;
 
-        SerializableAuthenticationOperationResult deserialize(
-            std::shared_ptr<std::vector<uint8_t>> &data) override;
+        SerializableAuthenticationOperationResult deserializeFrom(
+            const uint8_t *data, size_t dataSize) override;
 
-        SerializableAuthenticationOperationResult serializeJSON(
-            std::string &data) override;
+protected:
+        SerializableAuthenticationOperationResult serializeJSONFields(
+            AuthenticationJsonWriter &writer) override;
 
-        SerializableAuthenticationOperationResult deserializeJSON(
-            std::string &data) override;
+        SerializableAuthenticationOperationResult deserializeJSONFields(
+            const cJSON *root) override;
 
 private:
+        // Wire field layout, defined with the implementation
+        struct Codec;
+
         uint16_t authenticationOperationStatusCode;
-        uint8_t authenticationStatusDescriptionLength;
-        char authenticationStatusDescription[MAX_AUTHENTICATION_STATUS_DESCRIPTION_SIZE];
+        // Exact wire bytes, null terminator included.
+        std::string authenticationStatusDescription;
         uint16_t counter;
         uint16_t exceptionTimer;
         uint16_t estimatedTime;
         uint32_t loadListRatio; // This must be a 24-bit value
-        uint16_t numberOfHeaderFiles;
         std::shared_ptr<std::vector<LoadAuthenticationStatusHeaderFile>> headerFiles;
 };
 
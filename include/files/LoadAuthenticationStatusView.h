@@ -0,0 +1,262 @@
+#ifndef LOADAUTHENTICATIONSTATUSVIEW_H
+#define LOADAUTHENTICATIONSTATUSVIEW_H
+
+#include "LoadAuthenticationStatusFile.h"
+#include "AuthenticationFieldView.h"
+#include "AuthenticationHeaderViewIterator.h"
+
+/**
+ * @brief Read-only view of a serialized Load Authentication Status header
+ * file. Fields are read straight from the wire buffer.
+ */
+class LoadAuthenticationStatusHeaderView
+{
+public:
+        LoadAuthenticationStatusHeaderView();
+        virtual ~LoadAuthenticationStatusHeaderView();
+
+        /**
+         * @brief Get Header File Name
+         *
+         * @param[out] headerFileName Header File Name, including its null
+         * terminator.
+         *
+         * @return FILE_AUTHENTICATION_OPERATION_OK if success.
+         * @return FILE_AUTHENTICATION_OPERATION_ERROR otherwise.
+         */
+        FileAuthenticationOperationResult getHeaderFileName(
+            AuthenticationFieldView &headerFileName) const;
+
+        /**
+         * @brief Get Load Part Number Name
+         *
+         * @param[out] loadPartNumberName Load Part Number Name, including its
+         * null terminator.
+         *
+         * @return FILE_AUTHENTICATION_OPERATION_OK if success.
+         * @return FILE_AUTHENTICATION_OPERATION_ERROR otherwise.
+         */
+        FileAuthenticationOperationResult getLoadPartNumberName(
+            AuthenticationFieldView &loadPartNumberName) const;
+
+        /**
+         * @brief Get Load Ratio
+         *
+         * @param[out] loadRatio Load Ratio.
+         *
+         * @return FILE_AUTHENTICATION_OPERATION_OK if success.
+         * @return FILE_AUTHENTICATION_OPERATION_ERROR otherwise.
+         */
+        FileAuthenticationOperationResult getLoadRatio(uint32_t &loadRatio) const;
+
+        /**
+         * @brief Get Load Status
+         *
+         * @param[out] loadStatus Load Status.
+         *
+         * @return FILE_AUTHENTICATION_OPERATION_OK if success.
+         * @return FILE_AUTHENTICATION_OPERATION_ERROR otherwise.
+         */
+        FileAuthenticationOperationResult getLoadStatus(uint16_t &loadStatus) const;
+
+        /**
+         * @brief Get Load Status Description
+         *
+         * @param[out] loadStatusDescription Load Status Description, including
+         * its null terminator.
+         *
+         * @return FILE_AUTHENTICATION_OPERATION_OK if success.
+         * @return FILE_AUTHENTICATION_OPERATION_ERROR otherwise.
+         */
+        FileAuthenticationOperationResult getLoadStatusDescription(
+            AuthenticationFieldView &loadStatusDescription) const;
+
+        /**
+         * @brief Parse a header file at offset of data. On success, offset is
+         * advanced past this header file.
+         *
+         * @param[in] data buffer holding the serialized header file.
+         * @param[in] dataSize size of the buffer in bytes.
+         * @param[in,out] offset position of the header file in the buffer.
+         *
+         * @return SERIALIZABLE_AUTHENTICATION_OK if success.
+         * @return SERIALIZABLE_AUTHENTICATION_ERROR otherwise.
+         */
+        SerializableAuthenticationOperationResult parse(
+            const uint8_t *data, size_t dataSize, size_t &offset);
+
+private:
+        AuthenticationFieldView headerFileName;
+        AuthenticationFieldView loadPartNumberName;
+        uint32_t loadRatio;
+        uint16_t loadStatus;
+        AuthenticationFieldView loadStatusDescription;
+};
+
+/**
+ * @brief Read-only view of a serialized Load Authentication Status file.
+ *
+ * The framing of the whole file, header files included, is validated once by
+ * parse(). After that, fields and header files are read straight from the
+ * wire buffer without copying them. The buffer must outlive the view.
+ */
+class LoadAuthenticationStatusView
+{
+public:
+        typedef AuthenticationHeaderViewIterator<LoadAuthenticationStatusHeaderView>
+            HeaderFileIterator;
+
+        LoadAuthenticationStatusView();
+        virtual ~LoadAuthenticationStatusView();
+
+        /**
+         * @brief Validate the framing of a serialized file and bind the view
+         * to it. Only the first File Length bytes of data are used, so data
+         * may be larger than the file.
+         *
+         * @param[in] data buffer holding the serialized file.
+         * @param[in] dataSize size of the buffer in bytes.
+         *
+         * @return SERIALIZABLE_AUTHENTICATION_OK if success.
+         * @return SERIALIZABLE_AUTHENTICATION_ERROR otherwise.
+         */
+        SerializableAuthenticationOperationResult parse(
+            const uint8_t *data, size_t dataSize);
+
+        /**
+         * @brief Read the Counter of a serialized file without parsing it.
+         * Only the fixed fields up to the Counter are read, so a status file
+         * already seen can be dropped before it is validated.
+         *
+         * @param[in] data buffer holding the serialized file.
+         * @param[in] dataSize size of the buffer in bytes.
+         * @param[out] counter Status counter
+         *
+         * @return SERIALIZABLE_AUTHENTICATION_OK if success.
+         * @return SERIALIZABLE_AUTHENTICATION_ERROR otherwise.
+         */
+        static SerializableAuthenticationOperationResult peekCounter(
+            const uint8_t *data, size_t dataSize, uint16_t &counter);
+
+        /**
+         * @brief Get File Length
+         *
+         * @param[out] fileLength File Length.
+         *
+         * @return FILE_AUTHENTICATION_OPERATION_OK if success.
+         * @return FILE_AUTHENTICATION_OPERATION_ERROR otherwise.
+         */
+        FileAuthenticationOperationResult getFileLength(uint32_t &fileLength) const;
+
+        /**
+         * @brief Get Protocol Version
+         *
+         * @param[out] protocolVersion Protocol Version (not null terminated).
+         *
+         * @return FILE_AUTHENTICATION_OPERATION_OK if success.
+         * @return FILE_AUTHENTICATION_OPERATION_ERROR otherwise.
+         */
+        FileAuthenticationOperationResult getProtocolVersion(
+            AuthenticationFieldView &protocolVersion) const;
+
+        /**
+         * @brief Get Authentication Operation Status Code
+         *
+         * @param[out] authenticationOperationStatusCode Load Authentication Operation Status Code.
+         *
+         * @return FILE_AUTHENTICATION_OPERATION_OK if success.
+         * @return FILE_AUTHENTICATION_OPERATION_ERROR otherwise.
+         */
+        FileAuthenticationOperationResult getAuthenticationOperationStatusCode(
+            uint16_t &authenticationOperationStatusCode) const;
+
+        /**
+         * @brief Get Authentication Status Description
+         *
+         * @param[out] authenticationStatusDescription Load Authentication
+         * Status Description, including its null terminator.
+         *
+         * @return FILE_AUTHENTICATION_OPERATION_OK if success.
+         * @return FILE_AUTHENTICATION_OPERATION_ERROR otherwise.
+         */
+        FileAuthenticationOperationResult getAuthenticationStatusDescription(
+            AuthenticationFieldView &authenticationStatusDescription) const;
+
+        /**
+         * @brief Get Counter
+         *
+         * @param[out] counter Status counter
+         *
+         * @return FILE_AUTHENTICATION_OPERATION_OK if success.
+         * @return FILE_AUTHENTICATION_OPERATION_ERROR otherwise.
+         */
+        FileAuthenticationOperationResult getCounter(uint16_t &counter) const;
+
+        /**
+         * @brief Get Exception Timer
+         *
+         * @param[out] exceptionTimer Exception Timer
+         *
+         * @return FILE_AUTHENTICATION_OPERATION_OK if success.
+         * @return FILE_AUTHENTICATION_OPERATION_ERROR otherwise.
+         */
+        FileAuthenticationOperationResult getExceptionTimer(uint16_t &exceptionTimer) const;
+
+        /**
+         * @brief Get Estimated Time
+         *
+         * @param[out] estimatedTime Estimated Time
+         *
+         * @return FILE_AUTHENTICATION_OPERATION_OK if success.
+         * @return FILE_AUTHENTICATION_OPERATION_ERROR otherwise.
+         */
+        FileAuthenticationOperationResult getEstimatedTime(uint16_t &estimatedTime) const;
+
+        /**
+         * @brief Get Load List Ratio
+         *
+         * @param[out] loadListRatio Load List Ratio
+         *
+         * @return FILE_AUTHENTICATION_OPERATION_OK if success.
+         * @return FILE_AUTHENTICATION_OPERATION_ERROR otherwise.
+         */
+        FileAuthenticationOperationResult getLoadListRatio(uint32_t &loadListRatio) const;
+
+        /**
+         * @brief Get Number of Header Files
+         *
+         * @param[out] numberOfHeaderFiles Number of Header Files
+         *
+         * @return FILE_AUTHENTICATION_OPERATION_OK if success.
+         * @return FILE_AUTHENTICATION_OPERATION_ERROR otherwise.
+         */
+        FileAuthenticationOperationResult getNumberOfHeaderFiles(
+            uint16_t &numberOfHeaderFiles) const;
+
+        /**
+         * @brief Iterator to the first header file. Equal to end() if the
+         * view was not successfully parsed.
+         */
+        HeaderFileIterator begin() const;
+
+        /**
+         * @brief Iterator past the last header file.
+         */
+        HeaderFileIterator end() const;
+
+private:
+        bool valid;
+        const uint8_t *data;
+        uint32_t fileLength;
+        AuthenticationFieldView protocolVersion;
+        uint16_t authenticationOperationStatusCode;
+        AuthenticationFieldView authenticationStatusDescription;
+        uint16_t counter;
+        uint16_t exceptionTimer;
+        uint16_t estimatedTime;
+        uint32_t loadListRatio;
+        uint16_t numberOfHeaderFiles;
+        size_t headerFilesOffset;
+};
+
+#endif // LOADAUTHENTICATIONSTATUSVIEW_H
@@ -27,6 +27,21 @@ public:
         virtual SerializableAuthenticationOperationResult serialize(
             std::shared_ptr<std::vector<uint8_t>> &data) = 0;
 
+        /**
+         * @brief Serialize object to binary data, into a caller provided
+         * buffer. No memory is allocated. The required capacity is given by
+         * getFileSize().
+         *
+         * @param[out] buffer buffer where the serialized object is written.
+         * @param[in] capacity buffer size in bytes.
+         * @param[out] written number of bytes written to the buffer.
+         *
+         * @return SERIALIZABLE_AUTHENTICATION_OK if success.
+         * @return SERIALIZABLE_AUTHENTICATION_ERROR if the buffer is too small.
+         */
+        virtual SerializableAuthenticationOperationResult serializeInto(
+            uint8_t *buffer, size_t capacity, size_t &written) = 0;
+
         /**
          * @brief Serialize object to JSON string.
          *
@@ -49,6 +64,20 @@ public:
         virtual SerializableAuthenticationOperationResult deserialize(
             std::shared_ptr<std::vector<uint8_t>> &data) = 0;
 
+        /**
+         * @brief Deserialize object from binary data held by the caller, such
+         * as the buffer the file was received in. Only the decoded fields are
+         * copied.
+         *
+         * @param[in] data serialized object.
+         * @param[in] dataSize size of the serialized object in bytes.
+         *
+         * @return SERIALIZABLE_AUTHENTICATION_OK if success.
+         * @return SERIALIZABLE_AUTHENTICATION_ERROR otherwise.
+         */
+        virtual SerializableAuthenticationOperationResult deserializeFrom(
+            const uint8_t *data, size_t dataSize) = 0;
+
         /**
          * @brief Deserialize object from JSON string.
          *
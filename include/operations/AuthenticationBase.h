@@ -16,8 +16,8 @@
 #define DEFAULT_AUTHENTICATION_WAIT_TIME 1    // second
 #define MAX_DLP_TRIES 2
 
-// This size must be enough to store the certificate transmission.
-// TODO: make it dynamic?
+// Files are received in growable memory files (see AuthenticationMemoryFile).
+// Kept for applications sizing their own buffers.
 #define MAX_CERTIFICATE_BUFFER_SIZE (10 * 1024)
 
 /**
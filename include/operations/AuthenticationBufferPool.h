@@ -0,0 +1,92 @@
+#ifndef AUTHENTICATIONBUFFERPOOL_H
+#define AUTHENTICATIONBUFFERPOOL_H
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/**
+ * @brief Fixed capacity pool of equally sized buffers.
+ *
+ * Buffers are carved from slabs allocated the first time they are needed,
+ * and are recycled from then on, so a warm pool never touches the global
+ * allocator. When every buffer of the pool is in use, the pool falls back
+ * to the heap and counts the overflow.
+ */
+class AuthenticationBufferPool
+{
+public:
+    /**
+     * @brief Create an empty pool.
+     *
+     * @param[in] bufferSize size of each buffer, in bytes.
+     * @param[in] capacity maximum number of buffers held by the pool.
+     * @param[in] buffersPerSlab number of buffers allocated at once.
+     */
+    AuthenticationBufferPool(size_t bufferSize, size_t capacity, size_t buffersPerSlab);
+    ~AuthenticationBufferPool();
+
+    AuthenticationBufferPool(const AuthenticationBufferPool &) = delete;
+    AuthenticationBufferPool &operator=(const AuthenticationBufferPool &) = delete;
+
+    /**
+     * @brief Take a buffer. Safe to call from any thread.
+     *
+     * @return a buffer of getBufferSize() bytes.
+     * @return NULL if not even the heap could provide it.
+     */
+    char *acquire();
+
+    /**
+     * @brief Give back a buffer taken with acquire(). Safe to call from
+     *        any thread.
+     *
+     * @param[in] buffer the buffer. NULL is ignored.
+     */
+    void release(char *buffer);
+
+    size_t getBufferSize();
+    size_t getCapacity();
+
+    /**
+     * @brief Get how many buffers of the pool are handed out right now.
+     *        Heap buffers handed out on overflow are not counted.
+     */
+    size_t getNumberOfBuffersInUse();
+
+    /**
+     * @brief Get the most buffers of the pool ever handed out at once.
+     */
+    size_t getHighWaterMark();
+
+    /**
+     * @brief Get how many buffers came from the heap because the pool was
+     *        exhausted.
+     */
+    size_t getNumberOfOverflows();
+
+private:
+    struct Slab
+    {
+        std::unique_ptr<char[]> data;
+        size_t numberOfBuffers;
+    };
+
+    bool owns(char *buffer);
+
+    size_t bufferSize;
+    size_t capacity;
+    size_t buffersPerSlab;
+
+    // Everything below is guarded by mutex
+    std::mutex mutex;
+    std::vector<Slab> slabs;
+    std::vector<char *> freeBuffers;
+    size_t allocatedBuffers;
+    size_t buffersInUse;
+    size_t highWaterMark;
+    size_t overflows;
+};
+
+#endif // AUTHENTICATIONBUFFERPOOL_H
@@ -2,16 +2,44 @@
 #define AUTHENTICATIONDATALOADER_H
 
 #include <string>
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <map>
 #include <mutex>
+#include <thread>
 #include <unordered_map>
 #include <tuple>
 
 #include "TFTPServer.h"
 #include "AuthenticationBase.h"
+#include "AuthenticationBufferPool.h"
+#include "AuthenticationFileCache.h"
+#include "AuthenticationFileValidator.h"
+#include "AuthenticationLatencyHistogram.h"
+#include "AuthenticationMemoryFile.h"
+#include "AuthenticationMpscQueue.h"
+#include "AuthenticationRetryPolicy.h"
 
 #define DEFAULT_WAIT_TIME 1 // second
 
+// Threads exchanging the initialization and load list files with the
+// target hardwares. They are shared by every authentication in flight.
+#define DEFAULT_AUTHENTICATION_WORKERS 4
+
+// Buffers receiving the files sent by the target hardwares. Each file being
+// received holds one, allocated in slabs the first time they are needed.
+// Files larger than a buffer carry on in memory of their own.
+#define DEFAULT_RECEIVE_BUFFER_SIZE 1024
+#define DEFAULT_RECEIVE_BUFFER_POOL_CAPACITY 64
+#define DEFAULT_RECEIVE_BUFFER_POOL_SLAB 8
+
+// Memory the certificates read by the target hardwares may take once cached
+#define DEFAULT_CERTIFICATE_CACHE_BUDGET DEFAULT_FILE_CACHE_BUDGET
+
 /**
  * @brief This data type will be used to store a single load. The stored
  *        format must be <FileName, PartNumber>
@@ -20,7 +48,82 @@
 #define LOAD_PART_NUMBER_IDX 1
 typedef std::tuple<std::string, std::string> AuthenticationLoad;
 
+// Loads of one authentication, bounded by the Number of Header Files field
+// of the load authentication request
+#define MAX_AUTHENTICATION_LOADS 0xFFFF
+
+/**
+ * @brief Progress of one load of an authentication, as last reported by the
+ *        target hardware in the header files of its status files. Load status
+ *        and ratio stay 0 until the load is first reported.
+ */
+struct AuthenticationLoadProgress
+{
+    std::string headerFileName;
+    std::string loadPartNumberName;
+    uint16_t loadStatus;
+    uint32_t loadRatio;
+    std::string loadStatusDescription;
+};
+
 class LoadAuthenticationRequestFile;
+class LoadAuthenticationStatusView;
+
+/**
+ * @brief Authentication state of a target hardware.
+ * Possible values are:
+ * - AUTHENTICATION_TARGET_PENDING:      Target added, authentication not started.
+ * - AUTHENTICATION_TARGET_INITIALIZING: Waiting for the initialization to be
+ *                                       accepted.
+ * - AUTHENTICATION_TARGET_IN_PROGRESS:  Initialization accepted, waiting for
+ *                                       the authentication to end.
+ * - AUTHENTICATION_TARGET_COMPLETED:    Authentication completed.
+ * - AUTHENTICATION_TARGET_FAILED:       Authentication refused, aborted or
+ *                                       timed out.
+ */
+enum class AuthenticationTargetState
+{
+    AUTHENTICATION_TARGET_PENDING = 0,
+    AUTHENTICATION_TARGET_INITIALIZING,
+    AUTHENTICATION_TARGET_IN_PROGRESS,
+    AUTHENTICATION_TARGET_COMPLETED,
+    AUTHENTICATION_TARGET_FAILED
+};
+
+/**
+ * @brief Phases of an authentication, timed by the DataLoader.
+ *
+ * AUTHENTICATION_PHASE_TFTP_INIT: start of the DataLoader server and
+ *                                 threads, only when no authentication kept
+ *                                 them warm.
+ * AUTHENTICATION_PHASE_INITIALIZATION_FETCH: fetch of the initialization
+ *                                            file, retries included.
+ * AUTHENTICATION_PHASE_ACCEPTANCE_WAIT: wait for the status file accepting
+ *                                       the authentication, once the
+ *                                       initialization file is fetched.
+ * AUTHENTICATION_PHASE_LOAD_LIST_SEND: send of the load list, retries
+ *                                      included.
+ * AUTHENTICATION_PHASE_CERTIFICATE_READ: serving of a certificate read by a
+ *                                        target hardware, from its open to
+ *                                        its close. Certificates are shared
+ *                                        by every target, so it is only
+ *                                        timed for the whole DataLoader.
+ * AUTHENTICATION_PHASE_COMPLETION_WAIT: wait for the status file completing
+ *                                       the authentication, once the load
+ *                                       list is sent.
+ * AUTHENTICATION_PHASE_TOTAL: whole authentication, for the completed ones.
+ */
+enum class AuthenticationPhase
+{
+    AUTHENTICATION_PHASE_TFTP_INIT = 0,
+    AUTHENTICATION_PHASE_INITIALIZATION_FETCH,
+    AUTHENTICATION_PHASE_ACCEPTANCE_WAIT,
+    AUTHENTICATION_PHASE_LOAD_LIST_SEND,
+    AUTHENTICATION_PHASE_CERTIFICATE_READ,
+    AUTHENTICATION_PHASE_COMPLETION_WAIT,
+    AUTHENTICATION_PHASE_TOTAL
+};
+#define AUTHENTICATION_PHASES 7
 
 /**
  * @brief Callback for authentication initialization operation response.
@@ -89,6 +192,31 @@ typedef AuthenticationOperationResult (*certificateNotAvailableCallback)(
     uint16_t *waitTimeS,
     void *context);
 
+/**
+ * @brief Callback for the end of an authentication started by
+ *        authenticateAsync(). It is called from the DataLoader thread that
+ *        ended the session, most often the client processor which handles
+ *        the status files of every target, so a slow callback holds up the
+ *        status of all of them. It must not block, but it may start a new
+ *        authentication, unless the DataLoader is being destroyed.
+ *
+ * @param[in] targetHardwareId the TargetHardware ID.
+ * @param[in] targetHardwarePosition the TargetHardware position.
+ * @param[in] result AUTHENTICATION_OPERATION_OK if the authentication
+ *                   completed, AUTHENTICATION_OPERATION_ERROR otherwise.
+ * @param[in] context the user context.
+ *
+ * @return AUTHENTICATION_OPERATION_OK if success.
+ * @return AUTHENTICATION_OPERATION_ERROR otherwise.
+ */
+typedef AuthenticationOperationResult (*authenticationCompletedCallback)(
+    std::string targetHardwareId,
+    std::string targetHardwarePosition,
+    AuthenticationOperationResult result,
+    void *context);
+
+class AuthenticationHandle;
+
 /**
  * @brief Class to handle authentication operation on the DataLoader side.
  */
@@ -160,9 +288,12 @@ public:
     AuthenticationOperationResult setTftpTargetHardwareServerPort(uint16_t port);
 
     /**
-     * @brief Set load list.
+     * @brief Set load list. Every load is sent in the same load
+     *        authentication request, and the target hardware fetches them
+     *        one after the other.
      *
-     * @param[in] loadList the load list.
+     * @param[in] loadList the load list. Up to MAX_AUTHENTICATION_LOADS loads,
+     *                     with distinct file names.
      *
      * @return AUTHENTICATION_OPERATION_OK if success.
      * @return AUTHENTICATION_OPERATION_ERROR otherwise.
@@ -178,6 +309,100 @@ public:
      */
     AuthenticationOperationResult authenticate();
 
+    /**
+     * @brief Add a target hardware to be authenticated by authenticateTargets().
+     *        Targets are told apart by their <ID>_<POSITION> base file name,
+     *        which must be unique.
+     *
+     * @param[in] targetHardwareId the TargetHardware ID.
+     * @param[in] targetHardwarePosition the TargetHardware position.
+     * @param[in] targetHardwareIp the TargetHardware IP.
+     * @param[in] loadList the load list of this TargetHardware.
+     *
+     * @return AUTHENTICATION_OPERATION_OK if success.
+     * @return AUTHENTICATION_OPERATION_ERROR otherwise.
+     */
+    AuthenticationOperationResult addTarget(std::string targetHardwareId,
+                                            std::string targetHardwarePosition,
+                                            std::string targetHardwareIp,
+                                            std::vector<AuthenticationLoad> loadList);
+
+    /**
+     * @brief Remove all the targets added by addTarget().
+     *
+     * @return AUTHENTICATION_OPERATION_OK if success.
+     * @return AUTHENTICATION_OPERATION_ERROR otherwise.
+     */
+    AuthenticationOperationResult clearTargets();
+
+    /**
+     * @brief Authenticate all the targets added by addTarget() concurrently.
+     *        A single TFTP server receives the files of every target. This
+     *        call blocks until every authentication ends.
+     *
+     * @return AUTHENTICATION_OPERATION_OK if every target completed its
+     *         authentication.
+     * @return AUTHENTICATION_OPERATION_ERROR otherwise.
+     */
+    AuthenticationOperationResult authenticateTargets();
+
+    /**
+     * @brief Start the authentication of a target hardware and return right
+     *        away. The files of every authentication in flight are exchanged
+     *        by a few shared threads, none of them waits for a given target.
+     *
+     * @param[in] targetHardwareId the TargetHardware ID.
+     * @param[in] targetHardwarePosition the TargetHardware position.
+     * @param[in] targetHardwareIp the TargetHardware IP.
+     * @param[in] loadList the load list of this TargetHardware.
+     * @param[in] callback called when the authentication ends, may be nullptr.
+     * @param[in] context the user context of the callback.
+     * @param[out] handle handle to follow, wait for or cancel the
+     *                    authentication.
+     *
+     * @return AUTHENTICATION_OPERATION_OK if the authentication started.
+     * @return AUTHENTICATION_OPERATION_ERROR if the parameters are invalid or
+     *         this target is already being authenticated.
+     */
+    AuthenticationOperationResult authenticateAsync(std::string targetHardwareId,
+                                                    std::string targetHardwarePosition,
+                                                    std::string targetHardwareIp,
+                                                    std::vector<AuthenticationLoad> loadList,
+                                                    authenticationCompletedCallback callback,
+                                                    void *context,
+                                                    std::shared_ptr<AuthenticationHandle> &handle);
+
+    /**
+     * @brief Get the authentication state of a target added by addTarget().
+     *        It may be called while authenticateTargets() runs.
+     *
+     * @param[in] targetHardwareId the TargetHardware ID.
+     * @param[in] targetHardwarePosition the TargetHardware position.
+     * @param[out] state the authentication state of the target.
+     *
+     * @return AUTHENTICATION_OPERATION_OK if success.
+     * @return AUTHENTICATION_OPERATION_ERROR if the target is unknown.
+     */
+    AuthenticationOperationResult getTargetState(std::string targetHardwareId,
+                                                 std::string targetHardwarePosition,
+                                                 AuthenticationTargetState &state);
+
+    /**
+     * @brief Get the progress of each load of a target added by addTarget().
+     *        It may be called while authenticateTargets() runs.
+     *
+     * @param[in] targetHardwareId the TargetHardware ID.
+     * @param[in] targetHardwarePosition the TargetHardware position.
+     * @param[out] loadProgress the progress of each load, in load list order.
+     * @param[out] loadListRatio the progress of the whole load list.
+     *
+     * @return AUTHENTICATION_OPERATION_OK if success.
+     * @return AUTHENTICATION_OPERATION_ERROR if the target is unknown.
+     */
+    AuthenticationOperationResult getTargetLoadProgress(
+        std::string targetHardwareId, std::string targetHardwarePosition,
+        std::vector<AuthenticationLoadProgress> &loadProgress, uint32_t &loadListRatio);
+
     /**
      * Register a callback for authentication initialization response.
      *
@@ -230,34 +455,393 @@ public:
         certificateNotAvailableCallback callback,
         void *context);
 
+    /**
+     * @brief Get how many files received from the TargetHardware were
+     *        rejected by the framing validation for a given reason.
+     *
+     * @param[in] reason the rejection reason.
+     * @param[out] numberOfRejectedFiles number of files rejected for this reason.
+     *
+     * @return AUTHENTICATION_OPERATION_OK if success.
+     * @return AUTHENTICATION_OPERATION_ERROR otherwise.
+     */
+    AuthenticationOperationResult getNumberOfRejectedFiles(
+        AuthenticationFileValidationResult reason, uint32_t &numberOfRejectedFiles);
+
+    /**
+     * @brief Get the usage of the pool of buffers receiving the files sent
+     *        by the TargetHardwares.
+     *
+     * @param[out] buffersInUse number of buffers holding a file right now.
+     * @param[out] highWaterMark most buffers ever in use at once.
+     * @param[out] overflows number of buffers allocated out of the pool
+     *                       because it was exhausted.
+     *
+     * @return AUTHENTICATION_OPERATION_OK if success.
+     * @return AUTHENTICATION_OPERATION_ERROR otherwise.
+     */
+    AuthenticationOperationResult getReceiveBufferPoolUsage(
+        size_t &buffersInUse, size_t &highWaterMark, size_t &overflows);
+
+    /**
+     * @brief Set the policy retrying failed transfers with the target
+     *        hardwares and timing their status files. Authentications
+     *        already started keep the policy they started with.
+     *
+     * @param[in] retryPolicy the policy.
+     *
+     * @return AUTHENTICATION_OPERATION_OK if success.
+     * @return AUTHENTICATION_OPERATION_ERROR if retryPolicy is nullptr.
+     */
+    AuthenticationOperationResult setRetryPolicy(
+        std::shared_ptr<AuthenticationRetryPolicy> retryPolicy);
+
+    /**
+     * @brief Get how many times the transfers with a target added by
+     *        addTarget() were retried, and how many times the target
+     *        hardware asked to wait.
+     *
+     * @param[in] targetHardwareId the TargetHardware ID.
+     * @param[in] targetHardwarePosition the TargetHardware position.
+     * @param[out] retries transfers tried again after a failure.
+     * @param[out] waits transfers tried again after a WAIT answer.
+     *
+     * @return AUTHENTICATION_OPERATION_OK if success.
+     * @return AUTHENTICATION_OPERATION_ERROR if the target is unknown.
+     */
+    AuthenticationOperationResult getTargetRetryStatistics(
+        std::string targetHardwareId, std::string targetHardwarePosition,
+        uint32_t &retries, uint32_t &waits);
+
+    /**
+     * @brief Get how many status files of a target added by addTarget()
+     *        were dropped without being processed.
+     *
+     * @param[in] targetHardwareId the TargetHardware ID.
+     * @param[in] targetHardwarePosition the TargetHardware position.
+     * @param[out] duplicates status files repeating the counter of the
+     *                        last one processed.
+     * @param[out] dropped status files older than the last one processed,
+     *                     or than a newer one received along with them.
+     *
+     * @return AUTHENTICATION_OPERATION_OK if success.
+     * @return AUTHENTICATION_OPERATION_ERROR if the target is unknown.
+     */
+    AuthenticationOperationResult getTargetStatusStatistics(
+        std::string targetHardwareId, std::string targetHardwarePosition,
+        uint32_t &duplicates, uint32_t &dropped);
+
+    /**
+     * @brief Read a certificate into the cache before the target hardwares
+     *        request it, such as before authenticating a whole fleet.
+     *        Certificates are otherwise cached when first requested.
+     *
+     * @param[in] fileName path of the certificate, as requested by the
+     *                     target hardwares.
+     *
+     * @return AUTHENTICATION_OPERATION_OK if success.
+     * @return AUTHENTICATION_OPERATION_ERROR if it could not be read or is
+     *         larger than the cache budget.
+     */
+    AuthenticationOperationResult preloadCertificate(std::string fileName);
+
+    /**
+     * @brief Set the memory the cached certificates may take. The least
+     *        recently requested ones are evicted to stay within it.
+     *
+     * @param[in] budget the budget, in bytes. 0 disables the cache.
+     *
+     * @return AUTHENTICATION_OPERATION_OK if success.
+     * @return AUTHENTICATION_OPERATION_ERROR otherwise.
+     */
+    AuthenticationOperationResult setCertificateCacheBudget(size_t budget);
+
+    /**
+     * @brief Get the counters of the certificate cache.
+     *
+     * @param[out] hits certificates served from memory.
+     * @param[out] misses certificates read from disk.
+     * @param[out] evictions certificates evicted to stay within the budget.
+     *
+     * @return AUTHENTICATION_OPERATION_OK if success.
+     * @return AUTHENTICATION_OPERATION_ERROR otherwise.
+     */
+    AuthenticationOperationResult getCertificateCacheStatistics(
+        uint64_t &hits, uint64_t &misses, uint64_t &evictions);
+
+    /**
+     * @brief Get the latencies of a phase, over every authentication since
+     *        the DataLoader was created or the latencies were reset.
+     *
+     * @param[in] phase the phase.
+     * @param[out] summary the latencies of the phase.
+     *
+     * @return AUTHENTICATION_OPERATION_OK if success.
+     * @return AUTHENTICATION_OPERATION_ERROR if the phase is unknown.
+     */
+    AuthenticationOperationResult getPhaseLatency(AuthenticationPhase phase,
+                                                  AuthenticationLatencySummary &summary);
+
+    /**
+     * @brief Get the latencies of a phase, over every authentication of a
+     *        target hardware.
+     *
+     * @param[in] targetHardwareId the TargetHardware ID.
+     * @param[in] targetHardwarePosition the TargetHardware position.
+     * @param[in] phase the phase.
+     * @param[out] summary the latencies of the phase.
+     *
+     * @return AUTHENTICATION_OPERATION_OK if success.
+     * @return AUTHENTICATION_OPERATION_ERROR if the target was never
+     *         authenticated, the phase is unknown or is not timed per target
+     *         (AUTHENTICATION_PHASE_CERTIFICATE_READ).
+     */
+    AuthenticationOperationResult getTargetPhaseLatency(std::string targetHardwareId,
+                                                        std::string targetHardwarePosition,
+                                                        AuthenticationPhase phase,
+                                                        AuthenticationLatencySummary &summary);
+
+    /**
+     * @brief Write the latencies of every phase as a text table, for the
+     *        whole DataLoader then for each target hardware. The phases not
+     *        timed per target are left out of the target tables.
+     *
+     * @param[out] report the table.
+     *
+     * @return AUTHENTICATION_OPERATION_OK if success.
+     * @return AUTHENTICATION_OPERATION_ERROR otherwise.
+     */
+    AuthenticationOperationResult serializeLatencies(std::string &report);
+
+    /**
+     * @brief Write the latencies of every phase as JSON, for the whole
+     *        DataLoader then for each target hardware. Latencies are in
+     *        microseconds, and the phases not timed per target are left out
+     *        of the targets.
+     *
+     * @param[out] report the JSON.
+     *
+     * @return AUTHENTICATION_OPERATION_OK if success.
+     * @return AUTHENTICATION_OPERATION_ERROR otherwise.
+     */
+    AuthenticationOperationResult serializeLatenciesJSON(std::string &report);
+
+    /**
+     * @brief Forget the latencies recorded so far.
+     *
+     * @return AUTHENTICATION_OPERATION_OK if success.
+     * @return AUTHENTICATION_OPERATION_ERROR otherwise.
+     */
+    AuthenticationOperationResult resetLatencies();
+
+    /**
+     * @brief Stop the DataLoader server and the threads kept warm between
+     *        authentications. They start again with the next authentication.
+     *
+     * @return AUTHENTICATION_OPERATION_OK if success.
+     * @return AUTHENTICATION_OPERATION_ERROR if authentications are in flight.
+     */
+    AuthenticationOperationResult stop();
+
+    /**
+     * @brief Abort every authentication in flight. Authentications whose
+     *        initialization file was not requested yet end right away, and
+     *        transfers waiting to be retried give up. The other target
+     *        hardwares are told to abort on their next request, and their
+     *        authentications end when they report the abort. Authentications
+     *        started meanwhile are not aborted.
+     *
+     * @param[in] abortSource the abort source sent to the target hardwares.
+     *
+     * @return AUTHENTICATION_OPERATION_OK if success.
+     * @return AUTHENTICATION_OPERATION_ERROR otherwise.
+     */
     AuthenticationOperationResult abort(uint16_t abortSource) override;
 
 private:
-    class TargetClient
+    friend class AuthenticationHandle;
+
+    // One latency histogram per phase
+    struct PhaseLatencies
+    {
+        AuthenticationLatencyHistogram phases[AUTHENTICATION_PHASES];
+    };
+
+    // State of the authentication of one target hardware
+    class TargetSession
     {
     public:
-        TargetClient(TftpSectionId clientId);
+        TargetSession(std::string targetHardwareId, std::string targetHardwarePosition,
+                      std::string targetHardwareIp, std::vector<AuthenticationLoad> loadList);
+        ~TargetSession();
+
+        // Get ready for a new authentication
+        void reset();
+
+        std::string targetHardwareId;
+        std::string targetHardwarePosition;
+        std::string targetHardwareIp;
+        std::string baseFileName;
+        std::vector<AuthenticationLoad> loadList;
+
+        std::atomic<AuthenticationTargetState> state;
+        std::atomic<bool> toggleAbortSend;
+        std::atomic<uint16_t> abortSource;
+        std::atomic<bool> cancelled;
+
+        // Taken from the DataLoader when the session starts
+        std::shared_ptr<AuthenticationRetryPolicy> retryPolicy;
+        std::atomic<uint32_t> retries;
+        std::atomic<uint32_t> waits;
+        // Set by a WAIT answer to the transfer in progress
+        std::atomic<uint16_t> waitTimeS;
+        // Status files dropped because their counter was already applied,
+        // or older than the one applied or than another one queued
+        std::atomic<uint32_t> duplicateStatusFiles;
+        std::atomic<uint32_t> droppedStatusFiles;
+        // Latencies of every authentication of this target, taken from the
+        // DataLoader when the session starts
+        std::shared_ptr<PhaseLatencies> latencies;
+        std::chrono::steady_clock::time_point startedAt;
+
+        authenticationCompletedCallback completedCallback;
+        void *completedContext;
+        std::promise<AuthenticationOperationResult> promise;
+        std::shared_future<AuthenticationOperationResult> future;
+
+        // Everything below is guarded by mutex
+        std::mutex mutex;
+        // Set once the initialization file is asked for. From then on the
+        // target hardware may have accepted, and must be told of an abort.
+        bool initializationRequested;
+        bool authenticationInitializationAccepted;
+        bool authenticationInitialized;
+        bool loadListScheduled;
+        bool authenticationCompleted;
+        bool endAuthentication;
+        // Once the initialization is accepted, the next status file must
+        // arrive before statusDeadline, set by the retry policy from the
+        // last status file received
+        bool statusWatchdogArmed;
+        bool statusReceived;
+        std::chrono::steady_clock::time_point statusDeadline;
+        // Counter of the last status file applied, valid once statusReceived
+        uint16_t statusCounter;
+        // One entry per load, in load list order
+        std::vector<AuthenticationLoadProgress> loadProgress;
+        uint32_t loadListRatio;
+        // When the initialization file was fetched and the load list sent,
+        // the start of the two status waits
+        std::chrono::steady_clock::time_point initializedAt;
+        std::chrono::steady_clock::time_point loadListSentAt;
+    };
+
+    // Linked into finishedClients through itself
+    class TargetClient : public AuthenticationMpscLink<TargetClient>
+    {
+    public:
+        TargetClient(TftpSectionId clientId, AuthenticationBufferPool *bufferPool);
         ~TargetClient();
 
+        // Give the buffer back and get ready for another section
+        void reset(TftpSectionId clientId);
+
         AuthenticationOperationResult getClientId(TftpSectionId &clientId);
         AuthenticationOperationResult getClientFileBufferReference(FILE **fp);
-        AuthenticationOperationResult getClientBufferReference(char **buffer);
+        AuthenticationOperationResult getClientData(const uint8_t **data, size_t &size);
         AuthenticationOperationResult setFileName(std::string fileName);
         AuthenticationOperationResult getFileName(std::string &fileName);
-        AuthenticationOperationResult setSectionFinished();
-        AuthenticationOperationResult isSectionFinished(bool &sectionFinished);
+        AuthenticationOperationResult setSession(std::shared_ptr<TargetSession> session);
+        AuthenticationOperationResult getSession(std::shared_ptr<TargetSession> &session);
         AuthenticationOperationResult hasDataToProcess(bool &hasDataToProcess);
+        // Start of the certificate read by the section, if it reads one
+        AuthenticationOperationResult setReadStartedAt(
+            std::chrono::steady_clock::time_point readStartedAt);
+        AuthenticationOperationResult getReadStartedAt(
+            std::chrono::steady_clock::time_point &readStartedAt);
 
     private:
         TftpSectionId clientId;
         std::string fileName;
-        char *clientFileBuffer;
-        bool sectionFinished;
+        std::shared_ptr<TargetSession> session;
+        AuthenticationMemoryFile clientFile;
+        bool reading;
+        std::chrono::steady_clock::time_point readStartedAt;
     };
 
     AuthenticationOperationResult initTFTP();
     AuthenticationOperationResult initAuthenticationFiles(
+        std::shared_ptr<TargetSession> &session,
         LoadAuthenticationRequestFile &loadAuthenticationRequestFile);
+    static AuthenticationOperationResult checkLoadList(std::vector<AuthenticationLoad> &loadList);
+
+    AuthenticationOperationResult runSessions(
+        std::vector<std::shared_ptr<TargetSession>> &sessions);
+    AuthenticationOperationResult startSession(std::shared_ptr<TargetSession> &session);
+    // Called with engineMutex held, the session is not ended on failure
+    bool startSessionLocked(std::shared_ptr<TargetSession> &session);
+    AuthenticationOperationResult acquireClient(std::shared_ptr<TargetSession> &session,
+                                                std::unique_ptr<ITFTPClient> &client);
+    void releaseClient(std::unique_ptr<ITFTPClient> &client);
+    // A file exchanged with the target hardware of a session. Each try runs
+    // on a worker, and the wait before the next one is a timed task of the
+    // client processor, so no worker is held while a target hardware waits.
+    struct Transfer
+    {
+        std::shared_ptr<TargetSession> session;
+        bool fetch;
+        std::string fileName;
+        // Fetched into, or sent from
+        std::shared_ptr<std::vector<uint8_t>> fileBuffer;
+        std::chrono::steady_clock::time_point start;
+        uint16_t failedTries;
+        TftpClientOperationResult result;
+        // Called once on a worker, with the result of the last try
+        std::function<void(Transfer &)> completed;
+    };
+    void initializeSession(std::shared_ptr<TargetSession> session);
+    void initializationFetched(Transfer &transfer);
+    void sendLoadList(std::shared_ptr<TargetSession> session);
+    void loadListSent(Transfer &transfer);
+    void endSession(std::shared_ptr<TargetSession> &session);
+    void startTransfer(std::shared_ptr<Transfer> transfer);
+    void tryTransfer(std::shared_ptr<Transfer> transfer);
+    static TftpClientOperationResult targetHardwareErrorCallback(
+        short errorCode, std::string &errorMessage, void *context);
+    void setStatusDeadline(std::shared_ptr<TargetSession> &session,
+                           std::chrono::milliseconds timeout);
+    std::mutex retryPolicyMutex;
+    std::shared_ptr<AuthenticationRetryPolicy> retryPolicy;
+    std::atomic<bool> stopRetries;
+    std::shared_ptr<TargetSession> findTarget(std::string targetHardwareId,
+                                              std::string targetHardwarePosition);
+    void preloadLoads(std::shared_ptr<TargetSession> session);
+    static void updateLoadProgress(std::shared_ptr<TargetSession> &session,
+                                   const LoadAuthenticationStatusView &loadAuthenticationStatusView);
+    std::shared_ptr<TargetSession> findSession(std::string fileName);
+
+    // The server, the client processor and the workers are started with
+    // the first authentication, and kept warm until stop() or destruction.
+    AuthenticationOperationResult startEngine();
+    void stopEngine();
+    bool stopEngineIfIdle();
+    bool isIdle();
+    void submitTask(std::function<void()> task);
+    void worker();
+    std::mutex engineMutex;
+    bool engineRunning;
+    uint16_t engineServerPort;
+    std::thread serverThread;
+    std::thread clientProcessorThread;
+    std::vector<std::thread> workers;
+    std::mutex workerTasksMutex;
+    std::condition_variable workerTasksCV;
+    std::deque<std::function<void()>> workerTasks;
+    bool stopWorkers;
+
+    // Clients to the target hardwares not used by any worker right now
+    std::mutex idleClientsMutex;
+    std::vector<std::unique_ptr<ITFTPClient>> idleClients;
 
     static TftpServerOperationResult targetHardwareSectionStarted(
         ITFTPSection *sectionHandler, void *context);
@@ -269,25 +853,112 @@ private:
     static TftpServerOperationResult targetHardwareCloseFileRequest(
         ITFTPSection *sectionHandler, FILE *fp, void *context);
 
+    // Declared before every holder of a TargetClient, so it outlives them
+    AuthenticationBufferPool receiveBufferPool;
+    // Finished clients kept for the next sections
+    std::mutex idleTargetClientsMutex;
+    std::vector<std::shared_ptr<TargetClient>> idleTargetClients;
+    std::shared_ptr<TargetClient> acquireTargetClient(TftpSectionId id);
+    void releaseTargetClient(std::shared_ptr<TargetClient> &targetClient);
+
     std::mutex targetClientsMutex;
     std::unordered_map<TftpSectionId, std::shared_ptr<TargetClient>> targetClients;
+    // Certificates read by the target hardwares, validated against the disk
+    AuthenticationFileCache certificateCache;
+    AuthenticationFileValidator fileValidator;
     std::condition_variable clientProcessorCV;
     std::mutex clientProcessorMutex;
+    // Clients whose section finished, waiting for the client processor
+    AuthenticationMpscQueue<TargetClient> finishedClients;
+    bool stopClientProcessor;
+    // Earliest status deadline the client processor wakes up for. Sessions
+    // moving their deadline before it wake the client processor.
+    std::chrono::steady_clock::time_point processorStatusDeadline;
+    bool statusDeadlineMoved;
+    // Transfers waiting to be tried again, by deadline. The client processor
+    // hands them to the workers once their deadline expires.
+    struct ScheduledRetry
+    {
+        std::shared_ptr<TargetSession> session;
+        std::function<void()> task;
+    };
+    std::multimap<std::chrono::steady_clock::time_point, ScheduledRetry> scheduledRetries;
+    bool retriesMoved;
+    void scheduleRetry(std::shared_ptr<TargetSession> &session,
+                       std::chrono::steady_clock::time_point deadline,
+                       std::function<void()> task);
+    // The retries of a session run now, and give up as the session ended
+    void expediteRetries(std::shared_ptr<TargetSession> &session);
+    void runDueRetries();
     AuthenticationOperationResult clientProcessor();
-    AuthenticationOperationResult processFile(std::string fileName, char *buffer);
-    AuthenticationOperationResult processLoadAuthenticationStatusFile(char *buffer);
+    std::chrono::steady_clock::time_point nextStatusDeadline();
+    std::chrono::steady_clock::time_point refreshStatusDeadline();
+    void checkStatusDeadlines();
+    // Status files of a target queued in the same batch: all but the newest
+    // one are marked superseded
+    void findSupersededStatusFiles(const std::vector<std::shared_ptr<TargetClient>> &clients,
+                                   std::vector<bool> &superseded);
+    AuthenticationOperationResult processFile(std::shared_ptr<TargetSession> &session,
+                                              std::string fileName,
+                                              const uint8_t *data, size_t size);
+    AuthenticationOperationResult processLoadAuthenticationStatusFile(
+        std::shared_ptr<TargetSession> &session, const uint8_t *data, size_t size);
 
-    bool toggleAbortSend;
+    // Tell the target hardware of a session to abort and give up the retries
+    // of the session. endNow is set if the initialization file was never
+    // asked for, so the target hardware has nothing to abort and the session
+    // can end now. Otherwise it ends once the target hardware reports the
+    // abort, or stops sending status files.
+    AuthenticationOperationResult abortSession(std::shared_ptr<TargetSession> &session,
+                                               uint16_t abortSource, bool &endNow);
+    static void setAbortMessage(ITFTPSection *sectionHandler, uint16_t abortSource);
     AuthenticationOperationResult abortTargetRequest(uint16_t abortSource,
+                                                     std::shared_ptr<TargetSession> &session,
                                                      ITFTPSection *sectionHandler,
                                                      char *filename, char *mode);
-    uint16_t abortSource;
+    // Certificates are shared by every target, so a read can't be told
+    // apart. It is refused only while every session in flight is aborted.
+    uint16_t certificateAbortSource();
+
+    // Latencies of every phase, for the whole DataLoader and by base file
+    // name of the target hardwares. Recording them takes no lock.
+    void recordLatency(std::shared_ptr<TargetSession> &session, AuthenticationPhase phase,
+                       std::chrono::steady_clock::duration latency);
+    PhaseLatencies latencies;
+    std::mutex targetLatenciesMutex;
+    std::map<std::string, std::shared_ptr<PhaseLatencies>> targetLatencies;
 
     std::string targetHardwareId;
     std::string targetHardwarePosition;
     std::string targetHardwareIp;
     std::vector<AuthenticationLoad> loadList;
 
+    // Targets added by addTarget(), authenticating while
+    // authenticateTargets() runs them
+    std::mutex targetsMutex;
+    std::vector<std::shared_ptr<TargetSession>> targets;
+    std::atomic<bool> authenticating;
+
+    // Sessions being authenticated, by base file name. The TFTP server
+    // callbacks use it to hand each received file to its session.
+    std::mutex activeSessionsMutex;
+    std::unordered_map<std::string, std::shared_ptr<TargetSession>> activeSessions;
+    // Sessions ended whose completion callback still runs, and may start
+    // another session. The engine is not idle meanwhile.
+    size_t endingSessions;
+
+    // How the handles reach the DataLoader. Handles are owned by the caller
+    // and may outlive it, so it detaches before being destroyed and waits
+    // for the handles still using it.
+    struct HandleAnchor
+    {
+        std::mutex mutex;
+        std::condition_variable cv;
+        AuthenticationDataLoader *dataLoader;
+        uint32_t users;
+    };
+    std::shared_ptr<HandleAnchor> handleAnchor;
+
     void *_authenticationInitializationResponseContext;
     authenticationInitializationResponseCallback _authenticationInitializationResponseCallback;
 
@@ -303,16 +974,97 @@ private:
     uint16_t tftpTargetHardwareServerPort;
     uint16_t tftpDataLoaderServerPort;
     std::unique_ptr<ITFTPServer> tftpServer;
+};
+
+/**
+ * @brief Handle of an authentication started by
+ *        AuthenticationDataLoader::authenticateAsync().
+ */
+class AuthenticationHandle
+{
+public:
+    virtual ~AuthenticationHandle();
+
+    /**
+     * @brief Get the authentication state of the target.
+     *
+     * @param[out] state the authentication state.
+     *
+     * @return AUTHENTICATION_OPERATION_OK if success.
+     * @return AUTHENTICATION_OPERATION_ERROR otherwise.
+     */
+    AuthenticationOperationResult getState(AuthenticationTargetState &state);
+
+    /**
+     * @brief Get the future result of the authentication. Every call
+     *        returns the same shared future, so many threads may wait on it.
+     *
+     * @return the future result of the authentication.
+     */
+    std::shared_future<AuthenticationOperationResult> getFuture();
+
+    /**
+     * @brief Get the progress of each load of the authentication.
+     *
+     * @param[out] loadProgress the progress of each load, in load list order.
+     * @param[out] loadListRatio the progress of the whole load list.
+     *
+     * @return AUTHENTICATION_OPERATION_OK if success.
+     * @return AUTHENTICATION_OPERATION_ERROR otherwise.
+     */
+    AuthenticationOperationResult getLoadProgress(
+        std::vector<AuthenticationLoadProgress> &loadProgress, uint32_t &loadListRatio);
 
-    std::condition_variable filesProcessedCV;
-    std::mutex filesProcessedMutex;
+    /**
+     * @brief Get how many times the transfers of the authentication were
+     *        retried, and how many times the target hardware asked to wait.
+     *
+     * @param[out] retries transfers tried again after a failure.
+     * @param[out] waits transfers tried again after a WAIT answer.
+     *
+     * @return AUTHENTICATION_OPERATION_OK if success.
+     * @return AUTHENTICATION_OPERATION_ERROR otherwise.
+     */
+    AuthenticationOperationResult getRetryStatistics(uint32_t &retries, uint32_t &waits);
+
+    /**
+     * @brief Get how many status files of the authentication were dropped
+     *        without being processed.
+     *
+     * @param[out] duplicates status files repeating the counter of the
+     *                        last one processed.
+     * @param[out] dropped status files older than the last one processed,
+     *                     or than a newer one received along with them.
+     *
+     * @return AUTHENTICATION_OPERATION_OK if success.
+     * @return AUTHENTICATION_OPERATION_ERROR otherwise.
+     */
+    AuthenticationOperationResult getStatusStatistics(uint32_t &duplicates, uint32_t &dropped);
+
+    /**
+     * @brief Cancel the authentication. If the initialization file was not
+     *        requested yet, the authentication ends right away. Otherwise the
+     *        load list is not sent anymore, the target hardware is told to
+     *        abort on its next status file, and the authentication ends when
+     *        it reports the abort.
+     *
+     * @param[in] abortSource the abort source sent to the target hardware.
+     *
+     * @return AUTHENTICATION_OPERATION_OK if success.
+     * @return AUTHENTICATION_OPERATION_ERROR if the authentication already ended,
+     *         or the DataLoader was destroyed.
+     */
+    AuthenticationOperationResult cancel(
+        uint16_t abortSource = AUTHENTICATION_ABORT_SOURCE_OPERATOR);
+
+private:
+    friend class AuthenticationDataLoader;
 
-    std::condition_variable endAuthenticationCV;
-    std::mutex endAuthenticationMutex;
+    AuthenticationHandle(std::shared_ptr<AuthenticationDataLoader::TargetSession> session,
+                         std::weak_ptr<AuthenticationDataLoader::HandleAnchor> anchor);
 
-    bool authenticationInitializationAccepted;
-    bool authenticationCompleted;
-    bool endAuthentication;
+    std::shared_ptr<AuthenticationDataLoader::TargetSession> session;
+    std::weak_ptr<AuthenticationDataLoader::HandleAnchor> anchor;
 };
 
 #endif // AUTHENTICATIONDATALOADER_H
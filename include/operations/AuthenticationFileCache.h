@@ -0,0 +1,118 @@
+#ifndef AUTHENTICATIONFILECACHE_H
+#define AUTHENTICATIONFILECACHE_H
+
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Memory the cached files may take, in bytes
+#define DEFAULT_FILE_CACHE_BUDGET (4 * 1024 * 1024)
+
+/**
+ * @brief Cache of the content of files read from disk, by path.
+ *
+ * A cached file is served from memory as long as its modification time and
+ * size on disk are unchanged, otherwise it is read again. When the cached
+ * files take more than the budget, the least recently used ones are evicted.
+ * Files larger than the whole budget are never cached.
+ *
+ * Safe to use from any thread.
+ */
+class AuthenticationFileCache
+{
+public:
+    /**
+     * @brief Create an empty cache.
+     *
+     * @param[in] budget memory the cached files may take, in bytes.
+     */
+    AuthenticationFileCache(size_t budget = DEFAULT_FILE_CACHE_BUDGET);
+    ~AuthenticationFileCache();
+
+    AuthenticationFileCache(const AuthenticationFileCache &) = delete;
+    AuthenticationFileCache &operator=(const AuthenticationFileCache &) = delete;
+
+    /**
+     * @brief Open a file for reading.
+     *
+     * @param[in] path path of the file.
+     *
+     * @return a read-only FILE on the content of the file, to be closed with
+     *         fclose(). It stays valid if the file is evicted meanwhile.
+     * @return NULL if the file could not be read.
+     */
+    FILE *open(const std::string &path);
+
+    /**
+     * @brief Read a file into the cache before it is requested.
+     *
+     * @param[in] path path of the file.
+     *
+     * @return true if the file is cached.
+     * @return false if it could not be read or is larger than the budget.
+     */
+    bool preload(const std::string &path);
+
+    /**
+     * @brief Change the budget, evicting files until they fit in it.
+     */
+    void setBudget(size_t budget);
+    size_t getBudget();
+
+    /**
+     * @brief Get the memory taken by the cached files, in bytes.
+     */
+    size_t getSize();
+
+    /**
+     * @brief Get the cache counters.
+     *
+     * @param[out] hits files served from memory.
+     * @param[out] misses files read from disk, because they were not cached,
+     *                    were modified, or are larger than the budget.
+     * @param[out] evictions files evicted to stay within the budget.
+     */
+    void getStatistics(uint64_t &hits, uint64_t &misses, uint64_t &evictions);
+
+    /**
+     * @brief Drop every cached file. The counters are kept.
+     */
+    void clear();
+
+private:
+    typedef std::shared_ptr<const std::vector<uint8_t>> Content;
+
+    struct Entry
+    {
+        Content content;
+        struct timespec modificationTime;
+        off_t size;
+        std::list<std::string>::iterator lruPosition;
+    };
+
+    Content lookup(const std::string &path, bool &cacheable);
+    static Content readFile(const std::string &path, struct timespec &modificationTime,
+                            off_t &size);
+    void insert(const std::string &path, Content content,
+                const struct timespec &modificationTime, off_t size);
+    void evict(size_t budget);
+
+    // Everything below is guarded by mutex
+    std::mutex mutex;
+    std::unordered_map<std::string, Entry> entries;
+    // Most recently used first
+    std::list<std::string> lru;
+    size_t budget;
+    size_t size;
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+};
+
+#endif // AUTHENTICATIONFILECACHE_H
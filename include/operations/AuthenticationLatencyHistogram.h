@@ -0,0 +1,112 @@
+#ifndef AUTHENTICATIONLATENCYHISTOGRAM_H
+#define AUTHENTICATIONLATENCYHISTOGRAM_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+// Linear sub-buckets of each power of two. 3 bits keep every recorded value
+// within 12.5% of its bucket.
+#define LATENCY_HISTOGRAM_SUB_BUCKET_BITS 3
+#define LATENCY_HISTOGRAM_SUB_BUCKETS (1 << LATENCY_HISTOGRAM_SUB_BUCKET_BITS)
+// Latencies are recorded in nanoseconds, and clamped to 2^40 ns (about 18
+// minutes)
+#define LATENCY_HISTOGRAM_MAX_BITS 40
+#define LATENCY_HISTOGRAM_BUCKETS \
+    ((LATENCY_HISTOGRAM_MAX_BITS - LATENCY_HISTOGRAM_SUB_BUCKET_BITS + 1) * LATENCY_HISTOGRAM_SUB_BUCKETS)
+
+/**
+ * @brief Summary of the latencies recorded by a histogram. Percentiles are
+ *        the upper bound of the bucket holding them.
+ */
+struct AuthenticationLatencySummary
+{
+    uint64_t count;
+    std::chrono::nanoseconds min;
+    std::chrono::nanoseconds max;
+    std::chrono::nanoseconds mean;
+    std::chrono::nanoseconds p50;
+    std::chrono::nanoseconds p90;
+    std::chrono::nanoseconds p99;
+};
+
+/**
+ * @brief Log-linear histogram of latencies.
+ *
+ * Each power of two is split in LATENCY_HISTOGRAM_SUB_BUCKETS linear buckets,
+ * so the relative error stays the same from microseconds to minutes with a
+ * few hundred counters. Recording is lock-free and may be done from any
+ * thread, while another one reads the histogram.
+ */
+class AuthenticationLatencyHistogram
+{
+public:
+    AuthenticationLatencyHistogram();
+    virtual ~AuthenticationLatencyHistogram();
+
+    AuthenticationLatencyHistogram(const AuthenticationLatencyHistogram &) = delete;
+    AuthenticationLatencyHistogram &operator=(const AuthenticationLatencyHistogram &) = delete;
+
+    /**
+     * @brief Record a latency.
+     *
+     * @param[in] latency the latency, negative ones are recorded as 0.
+     */
+    void record(std::chrono::nanoseconds latency);
+
+    /**
+     * @brief Get the number of latencies recorded.
+     *
+     * @return the number of latencies recorded.
+     */
+    uint64_t getCount() const;
+
+    /**
+     * @brief Get a percentile of the latencies recorded.
+     *
+     * @param[in] percentile the percentile, from 0 to 100.
+     *
+     * @return the upper bound of the bucket holding the percentile, or 0 if
+     *         nothing was recorded.
+     */
+    std::chrono::nanoseconds getPercentile(double percentile) const;
+
+    /**
+     * @brief Get the summary of the latencies recorded.
+     *
+     * @param[out] summary the summary.
+     */
+    void getSummary(AuthenticationLatencySummary &summary) const;
+
+    /**
+     * @brief Forget every latency recorded.
+     */
+    void reset();
+
+    /**
+     * @brief Get the bucket of a latency.
+     *
+     * @param[in] nanoseconds the latency in nanoseconds.
+     *
+     * @return the bucket index.
+     */
+    static size_t getBucket(uint64_t nanoseconds);
+
+    /**
+     * @brief Get the highest latency of a bucket.
+     *
+     * @param[in] bucket the bucket index.
+     *
+     * @return the highest latency in nanoseconds.
+     */
+    static uint64_t getBucketUpperBound(size_t bucket);
+
+private:
+    std::atomic<uint64_t> buckets[LATENCY_HISTOGRAM_BUCKETS];
+    std::atomic<uint64_t> count;
+    std::atomic<uint64_t> sum;
+    std::atomic<uint64_t> min;
+    std::atomic<uint64_t> max;
+};
+
+#endif // AUTHENTICATIONLATENCYHISTOGRAM_H
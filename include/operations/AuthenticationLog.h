@@ -0,0 +1,392 @@
+#ifndef AUTHENTICATIONLOG_H
+#define AUTHENTICATIONLOG_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#define BLSEC_LOG_LEVEL_TRACE 0
+#define BLSEC_LOG_LEVEL_DEBUG 1
+#define BLSEC_LOG_LEVEL_INFO 2
+#define BLSEC_LOG_LEVEL_WARNING 3
+#define BLSEC_LOG_LEVEL_ERROR 4
+#define BLSEC_LOG_LEVEL_NONE 5
+
+// Lowest level built in. Log calls below it are stripped at compile time.
+#ifndef BLSEC_LOG_LEVEL
+#define BLSEC_LOG_LEVEL BLSEC_LOG_LEVEL_INFO
+#endif
+
+// Records each thread may hold before the drainer formats them. Records
+// logged while the ring of a thread is full are dropped.
+#define AUTHENTICATION_LOG_RING_SIZE 256
+#define AUTHENTICATION_LOG_MAX_ARGS 4
+// Size of a string argument, terminator included. Longer strings keep their
+// beginning and end with "..."
+#define AUTHENTICATION_LOG_STRING_SIZE 128
+#define AUTHENTICATION_LOG_ELLIPSIS "..."
+// Level logged until setLevel() is called, per-session logs are info
+#define AUTHENTICATION_LOG_DEFAULT_LEVEL BLSEC_LOG_LEVEL_WARNING
+
+/**
+ * @brief Log levels, from the most verbose.
+ */
+enum class AuthenticationLogLevel
+{
+    AUTHENTICATION_LOG_TRACE = BLSEC_LOG_LEVEL_TRACE,
+    AUTHENTICATION_LOG_DEBUG = BLSEC_LOG_LEVEL_DEBUG,
+    AUTHENTICATION_LOG_INFO = BLSEC_LOG_LEVEL_INFO,
+    AUTHENTICATION_LOG_WARNING = BLSEC_LOG_LEVEL_WARNING,
+    AUTHENTICATION_LOG_ERROR = BLSEC_LOG_LEVEL_ERROR,
+    AUTHENTICATION_LOG_NONE = BLSEC_LOG_LEVEL_NONE
+};
+
+/**
+ * @brief Callback receiving each formatted log line, from the drainer
+ *        thread.
+ *
+ * @param[in] level the level of the line.
+ * @param[in] line the formatted line, without line break.
+ * @param[in] context the user context.
+ */
+typedef void (*authenticationLogSink)(AuthenticationLogLevel level,
+                                      const char *line,
+                                      void *context);
+
+/**
+ * @brief Argument of a log record, copied by value.
+ */
+struct AuthenticationLogArg
+{
+    enum
+    {
+        LOG_ARG_SIGNED,
+        LOG_ARG_UNSIGNED,
+        LOG_ARG_DOUBLE,
+        LOG_ARG_STRING
+    } type;
+    union
+    {
+        int64_t signedValue;
+        uint64_t unsignedValue;
+        double doubleValue;
+        char stringValue[AUTHENTICATION_LOG_STRING_SIZE];
+    };
+};
+
+/**
+ * @brief Fixed-size binary log record. The format must be a string literal,
+ *        only its address is kept.
+ */
+struct AuthenticationLogRecord
+{
+    std::chrono::system_clock::time_point time;
+    AuthenticationLogLevel level;
+    uint32_t thread;
+    const char *format;
+    uint8_t numberOfArgs;
+    AuthenticationLogArg args[AUTHENTICATION_LOG_MAX_ARGS];
+};
+
+/**
+ * @brief Leveled logger kept off the protocol hot paths.
+ *
+ * Each thread writes fixed-size records into a ring of its own, without
+ * formatting. A drainer thread formats them in the background and hands each
+ * line to the sink, stdout by default. The drainer sleeps until a record is
+ * logged, and only the first record after it went idle takes a lock to wake
+ * it up. Formats use {} for each
+ * argument, which may be integers, floating points or strings.
+ *
+ * Use the BLSEC_LOG_* macros, so calls below BLSEC_LOG_LEVEL are not built.
+ */
+class AuthenticationLog
+{
+public:
+    /**
+     * @brief Get the logger of the process.
+     *
+     * @return the logger.
+     */
+    static AuthenticationLog &getInstance();
+
+    /**
+     * @brief Set the lowest level logged, AUTHENTICATION_LOG_DEFAULT_LEVEL
+     *        by default. Levels below BLSEC_LOG_LEVEL are never logged.
+     *
+     * @param[in] level the level.
+     */
+    void setLevel(AuthenticationLogLevel level);
+
+    /**
+     * @brief Check whether a level is logged.
+     *
+     * @param[in] level the level.
+     *
+     * @return true if the level is logged.
+     */
+    bool isEnabled(AuthenticationLogLevel level) const
+    {
+        return static_cast<int>(level) >= this->level.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Set the sink receiving the formatted lines.
+     *
+     * @param[in] sink the sink, nullptr to write to stdout.
+     * @param[in] context the user context.
+     */
+    void setSink(authenticationLogSink sink, void *context);
+
+    /**
+     * @brief Format and hand to the sink every record logged so far.
+     */
+    void flush();
+
+    /**
+     * @brief Get how many records were dropped because the ring of their
+     *        thread was full.
+     *
+     * @return number of records dropped.
+     */
+    uint64_t getNumberOfDroppedRecords() const;
+
+    /**
+     * @brief Log a record. Prefer the BLSEC_LOG_* macros.
+     *
+     * @param[in] level the level.
+     * @param[in] format the format, a string literal.
+     * @param[in] args the arguments, up to AUTHENTICATION_LOG_MAX_ARGS.
+     */
+    template <typename... Args>
+    void log(AuthenticationLogLevel level, const char *format, const Args &...args)
+    {
+        static_assert(sizeof...(Args) <= AUTHENTICATION_LOG_MAX_ARGS,
+                      "Too many log arguments");
+        if (!isEnabled(level))
+        {
+            return;
+        }
+
+        Ring *ring = getRing();
+        size_t tail = ring->tail.load(std::memory_order_relaxed);
+        if (tail - ring->head.load(std::memory_order_acquire) >= AUTHENTICATION_LOG_RING_SIZE)
+        {
+            droppedRecords.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        AuthenticationLogRecord &record = ring->records[tail % AUTHENTICATION_LOG_RING_SIZE];
+        record.time = std::chrono::system_clock::now();
+        record.level = level;
+        record.thread = ring->thread;
+        record.format = format;
+        record.numberOfArgs = 0;
+        capture(record, args...);
+        ring->tail.store(tail + 1, std::memory_order_release);
+
+        if (pendingRecords.fetch_add(1, std::memory_order_acq_rel) == 0)
+        {
+            wakeDrainer();
+        }
+    }
+
+private:
+    AuthenticationLog();
+    ~AuthenticationLog();
+
+    AuthenticationLog(const AuthenticationLog &) = delete;
+    AuthenticationLog &operator=(const AuthenticationLog &) = delete;
+
+    // Written by its thread only, read by the drainer only
+    struct Ring
+    {
+        Ring(uint32_t thread);
+
+        uint32_t thread;
+        std::atomic<size_t> head;
+        std::atomic<size_t> tail;
+        // Set when its thread exits, it is dropped once drained
+        std::atomic<bool> abandoned;
+        AuthenticationLogRecord records[AUTHENTICATION_LOG_RING_SIZE];
+    };
+
+    // Gives the ring back when its thread exits
+    struct RingHolder
+    {
+        ~RingHolder();
+        std::shared_ptr<Ring> ring;
+    };
+
+    Ring *getRing();
+    void wakeDrainer();
+    void drain();
+    void drainer();
+    static void format(const AuthenticationLogRecord &record, std::string &line);
+
+    static void capture(AuthenticationLogRecord &)
+    {
+    }
+
+    template <typename T, typename... Args>
+    static void capture(AuthenticationLogRecord &record, const T &arg, const Args &...args)
+    {
+        setArg(record.args[record.numberOfArgs++], arg);
+        capture(record, args...);
+    }
+
+    template <typename T>
+    static void setArg(AuthenticationLogArg &logArg, const T &value)
+    {
+        static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value,
+                      "Log arguments must be numbers or strings");
+        setNumber(logArg, value, std::is_floating_point<T>(), std::is_signed<T>());
+    }
+
+    static void setArg(AuthenticationLogArg &logArg, const char *value)
+    {
+        logArg.type = AuthenticationLogArg::LOG_ARG_STRING;
+        if (value == nullptr)
+        {
+            value = "(null)";
+        }
+
+        size_t length = strlen(value);
+        if (length < AUTHENTICATION_LOG_STRING_SIZE)
+        {
+            memcpy(logArg.stringValue, value, length + 1);
+            return;
+        }
+
+        // Keep both ends, the end of a path names the file
+        const size_t ellipsisLength = sizeof(AUTHENTICATION_LOG_ELLIPSIS) - 1;
+        const size_t kept = AUTHENTICATION_LOG_STRING_SIZE - 1 - ellipsisLength;
+        const size_t headLength = kept / 2;
+        const size_t tailLength = kept - headLength;
+        memcpy(logArg.stringValue, value, headLength);
+        memcpy(logArg.stringValue + headLength, AUTHENTICATION_LOG_ELLIPSIS, ellipsisLength);
+        memcpy(logArg.stringValue + headLength + ellipsisLength,
+               value + length - tailLength, tailLength + 1);
+    }
+
+    template <size_t N>
+    static void setArg(AuthenticationLogArg &logArg, const char (&value)[N])
+    {
+        setArg(logArg, static_cast<const char *>(value));
+    }
+
+    static void setArg(AuthenticationLogArg &logArg, char *value)
+    {
+        setArg(logArg, static_cast<const char *>(value));
+    }
+
+    static void setArg(AuthenticationLogArg &logArg, const std::string &value)
+    {
+        setArg(logArg, value.c_str());
+    }
+
+    template <typename T, bool Signed>
+    static void setNumber(AuthenticationLogArg &logArg, const T &value, std::true_type,
+                          std::integral_constant<bool, Signed>)
+    {
+        logArg.type = AuthenticationLogArg::LOG_ARG_DOUBLE;
+        logArg.doubleValue = static_cast<double>(value);
+    }
+
+    template <typename T>
+    static void setNumber(AuthenticationLogArg &logArg, const T &value, std::false_type,
+                          std::true_type)
+    {
+        logArg.type = AuthenticationLogArg::LOG_ARG_SIGNED;
+        logArg.signedValue = static_cast<int64_t>(value);
+    }
+
+    template <typename T>
+    static void setNumber(AuthenticationLogArg &logArg, const T &value, std::false_type,
+                          std::false_type)
+    {
+        logArg.type = AuthenticationLogArg::LOG_ARG_UNSIGNED;
+        logArg.unsignedValue = static_cast<uint64_t>(value);
+    }
+
+    std::atomic<int> level;
+    std::atomic<uint64_t> droppedRecords;
+    std::atomic<uint32_t> nextThread;
+    // Records logged since the drainer last woke up
+    std::atomic<uint64_t> pendingRecords;
+
+    // Rings of every thread that logged, guarded by ringsMutex. Only taken
+    // when a thread logs for the first time and by the drainer.
+    std::mutex ringsMutex;
+    std::vector<std::shared_ptr<Ring>> rings;
+
+    // Only one thread drains at a time, the drainer or flush()
+    std::mutex drainMutex;
+    authenticationLogSink sink;
+    void *sinkContext;
+
+    std::mutex drainerMutex;
+    std::condition_variable drainerCV;
+    bool stopDrainer;
+    std::thread drainerThread;
+};
+
+#if BLSEC_LOG_LEVEL <= BLSEC_LOG_LEVEL_TRACE
+#define BLSEC_LOG_TRACE(...) \
+    AuthenticationLog::getInstance().log(AuthenticationLogLevel::AUTHENTICATION_LOG_TRACE, __VA_ARGS__)
+#else
+#define BLSEC_LOG_TRACE(...) \
+    do                       \
+    {                        \
+    } while (0)
+#endif
+
+#if BLSEC_LOG_LEVEL <= BLSEC_LOG_LEVEL_DEBUG
+#define BLSEC_LOG_DEBUG(...) \
+    AuthenticationLog::getInstance().log(AuthenticationLogLevel::AUTHENTICATION_LOG_DEBUG, __VA_ARGS__)
+#else
+#define BLSEC_LOG_DEBUG(...) \
+    do                       \
+    {                        \
+    } while (0)
+#endif
+
+#if BLSEC_LOG_LEVEL <= BLSEC_LOG_LEVEL_INFO
+#define BLSEC_LOG_INFO(...) \
+    AuthenticationLog::getInstance().log(AuthenticationLogLevel::AUTHENTICATION_LOG_INFO, __VA_ARGS__)
+#else
+#define BLSEC_LOG_INFO(...) \
+    do                      \
+    {                       \
+    } while (0)
+#endif
+
+#if BLSEC_LOG_LEVEL <= BLSEC_LOG_LEVEL_WARNING
+#define BLSEC_LOG_WARNING(...) \
+    AuthenticationLog::getInstance().log(AuthenticationLogLevel::AUTHENTICATION_LOG_WARNING, __VA_ARGS__)
+#else
+#define BLSEC_LOG_WARNING(...) \
+    do                         \
+    {                          \
+    } while (0)
+#endif
+
+#if BLSEC_LOG_LEVEL <= BLSEC_LOG_LEVEL_ERROR
+#define BLSEC_LOG_ERROR(...) \
+    AuthenticationLog::getInstance().log(AuthenticationLogLevel::AUTHENTICATION_LOG_ERROR, __VA_ARGS__)
+#else
+#define BLSEC_LOG_ERROR(...) \
+    do                       \
+    {                        \
+    } while (0)
+#endif
+
+#endif // AUTHENTICATIONLOG_H
@@ -0,0 +1,112 @@
+#ifndef AUTHENTICATIONMEMORYFILE_H
+#define AUTHENTICATIONMEMORYFILE_H
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+#include "AuthenticationBufferPool.h"
+
+// Capacity reserved when a growable memory file is first written
+#define DEFAULT_MEMORY_FILE_CAPACITY 512
+// Largest file a memory file accepts, writes past it fail
+#define MAX_MEMORY_FILE_SIZE (16 * 1024 * 1024)
+
+/**
+ * @brief Growable memory backed FILE.
+ *
+ * Bytes written through the FILE land in a buffer that starts small and
+ * doubles when it runs out of room, so files of any size up to the maximum
+ * are received whole, and the exact number of bytes written is known.
+ *
+ * The buffer is either a vector, shared with the caller, or a buffer of a
+ * pool, moved to a private vector if the file outgrows it.
+ *
+ * Only one FILE may be open at a time, and it must be closed before the
+ * memory file is destroyed.
+ */
+class AuthenticationMemoryFile
+{
+public:
+    /**
+     * @brief Create a memory file stored in a vector.
+     *
+     * @param[in] buffer the vector. Its size is always the size of the file.
+     *                   A new one is created if nullptr.
+     * @param[in] maximumSize largest file accepted.
+     */
+    AuthenticationMemoryFile(std::shared_ptr<std::vector<uint8_t>> buffer = nullptr,
+                             size_t maximumSize = MAX_MEMORY_FILE_SIZE);
+
+    /**
+     * @brief Create a memory file stored in a buffer of a pool while it fits.
+     *
+     * @param[in] bufferPool the pool. It must outlive the memory file.
+     * @param[in] maximumSize largest file accepted.
+     */
+    AuthenticationMemoryFile(AuthenticationBufferPool *bufferPool,
+                             size_t maximumSize = MAX_MEMORY_FILE_SIZE);
+    ~AuthenticationMemoryFile();
+
+    AuthenticationMemoryFile(const AuthenticationMemoryFile &) = delete;
+    AuthenticationMemoryFile &operator=(const AuthenticationMemoryFile &) = delete;
+
+    /**
+     * @brief Open a FILE on the memory file.
+     *
+     * @param[in] mode "w" empties the file and writes it, "r" reads it.
+     *
+     * @return the FILE, to be closed with fclose().
+     * @return NULL if it could not be opened.
+     */
+    FILE *open(const char *mode);
+
+    /**
+     * @brief Get the content of the file. Only valid until the next write.
+     */
+    const uint8_t *getData();
+
+    /**
+     * @brief Get the size of the file: the position after the last write.
+     */
+    size_t getSize();
+
+    /**
+     * @brief Get the vector holding the file. Stored in the pool buffer, the
+     *        file is copied to the vector first.
+     */
+    std::shared_ptr<std::vector<uint8_t>> getBuffer();
+
+    /**
+     * @brief Check if a write was refused because the file would have grown
+     *        past the maximum size.
+     */
+    bool isOverflowed();
+
+    /**
+     * @brief Empty the file. The vector keeps its capacity, the pool buffer
+     *        goes back to the pool.
+     */
+    void clear();
+
+private:
+    static ssize_t readFile(void *cookie, char *data, size_t size);
+    static ssize_t writeFile(void *cookie, const char *data, size_t size);
+    static int seekFile(void *cookie, off64_t *offset, int whence);
+    static int closeFile(void *cookie);
+
+    bool reserve(size_t capacity);
+
+    std::shared_ptr<std::vector<uint8_t>> buffer;
+    AuthenticationBufferPool *bufferPool;
+    char *poolBuffer;
+    bool pooled;
+
+    size_t size;
+    size_t position;
+    size_t maximumSize;
+    bool overflowed;
+};
+
+#endif // AUTHENTICATIONMEMORYFILE_H
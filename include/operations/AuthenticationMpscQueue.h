@@ -0,0 +1,136 @@
+#ifndef AUTHENTICATIONMPSCQUEUE_H
+#define AUTHENTICATIONMPSCQUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Link of an element of an AuthenticationMpscQueue. Elements derive
+ *        from it, so pushing them allocates nothing.
+ */
+template <typename T>
+class AuthenticationMpscLink
+{
+public:
+    AuthenticationMpscLink() : mpscNext(nullptr)
+    {
+    }
+
+    AuthenticationMpscLink(const AuthenticationMpscLink &) : mpscNext(nullptr)
+    {
+    }
+
+    AuthenticationMpscLink &operator=(const AuthenticationMpscLink &)
+    {
+        return *this;
+    }
+
+private:
+    template <typename>
+    friend class AuthenticationMpscQueue;
+
+    T *mpscNext;
+    // Keeps the element alive while it is queued
+    std::shared_ptr<T> mpscSelf;
+};
+
+/**
+ * @brief Lock-free multiple producer, single consumer queue.
+ *
+ * Producers push onto an atomic stack. The consumer takes the whole stack at
+ * once and hands it back in push order, so it pays one atomic exchange per
+ * batch instead of one per element. The stack is linked through the
+ * elements themselves, which derive from AuthenticationMpscLink, and an
+ * element is in at most one queue at a time.
+ */
+template <typename T>
+class AuthenticationMpscQueue
+{
+public:
+    AuthenticationMpscQueue() : head(nullptr)
+    {
+    }
+
+    ~AuthenticationMpscQueue()
+    {
+        std::vector<std::shared_ptr<T>> values;
+        drain(values);
+    }
+
+    AuthenticationMpscQueue(const AuthenticationMpscQueue &) = delete;
+    AuthenticationMpscQueue &operator=(const AuthenticationMpscQueue &) = delete;
+
+    /**
+     * @brief Push an element. Safe to call from any number of threads.
+     *
+     * @param[in] value the element to push, not queued already.
+     *
+     * @return true if the queue was empty, and the consumer may need a wake up.
+     * @return false otherwise.
+     */
+    bool push(const std::shared_ptr<T> &value)
+    {
+        T *node = value.get();
+        node->mpscSelf = value;
+        // Once pushed the node belongs to the consumer, so the previous
+        // head is kept aside rather than read back from it
+        T *next = head.load(std::memory_order_relaxed);
+        do
+        {
+            node->mpscNext = next;
+        } while (!head.compare_exchange_weak(next, node,
+                                             std::memory_order_release,
+                                             std::memory_order_relaxed));
+        return next == nullptr;
+    }
+
+    /**
+     * @brief Take every element pushed so far. Only the consumer may call it.
+     *
+     * @param[out] values the elements are appended here, in push order.
+     *
+     * @return number of elements taken.
+     */
+    size_t drain(std::vector<std::shared_ptr<T>> &values)
+    {
+        T *node = head.exchange(nullptr, std::memory_order_acquire);
+
+        // The stack holds the newest element first
+        T *reversed = nullptr;
+        while (node != nullptr)
+        {
+            T *next = node->mpscNext;
+            node->mpscNext = reversed;
+            reversed = node;
+            node = next;
+        }
+
+        size_t numberOfValues = 0;
+        while (reversed != nullptr)
+        {
+            T *next = reversed->mpscNext;
+            reversed->mpscNext = nullptr;
+            values.push_back(std::move(reversed->mpscSelf));
+            reversed = next;
+            numberOfValues++;
+        }
+        return numberOfValues;
+    }
+
+    /**
+     * @brief Check if there is nothing to drain.
+     *
+     * @return true if the queue is empty.
+     */
+    bool empty() const
+    {
+        return head.load(std::memory_order_acquire) == nullptr;
+    }
+
+private:
+    std::atomic<T *> head;
+};
+
+#endif // AUTHENTICATIONMPSCQUEUE_H
@@ -0,0 +1,93 @@
+#ifndef AUTHENTICATIONRETRYPOLICY_H
+#define AUTHENTICATIONRETRYPOLICY_H
+
+#include <chrono>
+#include <cstdint>
+
+#include "AuthenticationBase.h"
+
+// First delay between two tries of a failed transfer, doubled on each try
+#define DEFAULT_RETRY_INITIAL_BACKOFF_MS 100
+#define DEFAULT_RETRY_MAX_BACKOFF_MS 2000
+// Fraction of each delay drawn at random, so targets failing together do
+// not retry together
+#define DEFAULT_RETRY_JITTER 0.5
+// Longest a transfer is retried, waits asked by the target hardware included
+#define DEFAULT_RETRY_DEADLINE_S 60
+
+/**
+ * @brief Decides when a failed transfer with a target hardware is tried
+ *        again, and how long the DataLoader waits for the next status file.
+ *
+ * Failed tries are retried with an exponential backoff and jitter, up to a
+ * number of tries. A target hardware answering WAIT:<s> is tried again after
+ * the time it asked for, which does not count as a failed try. Nothing is
+ * retried past the deadline.
+ *
+ * Subclass it and give it to the DataLoader to change the policy. It is
+ * shared by every authentication, so it must be safe to call from any
+ * thread.
+ */
+class AuthenticationRetryPolicy
+{
+public:
+    /**
+     * @brief Create a retry policy.
+     *
+     * @param[in] maxTries tries of a transfer, WAIT answers not counted.
+     * @param[in] initialBackoff delay after the first failed try.
+     * @param[in] maxBackoff longest delay between two tries.
+     * @param[in] jitter fraction of each delay drawn at random, from 0 to 1.
+     * @param[in] deadline longest a transfer is retried.
+     */
+    AuthenticationRetryPolicy(
+        uint16_t maxTries = MAX_DLP_TRIES,
+        std::chrono::milliseconds initialBackoff =
+            std::chrono::milliseconds(DEFAULT_RETRY_INITIAL_BACKOFF_MS),
+        std::chrono::milliseconds maxBackoff =
+            std::chrono::milliseconds(DEFAULT_RETRY_MAX_BACKOFF_MS),
+        double jitter = DEFAULT_RETRY_JITTER,
+        std::chrono::milliseconds deadline =
+            std::chrono::seconds(DEFAULT_RETRY_DEADLINE_S));
+    virtual ~AuthenticationRetryPolicy();
+
+    /**
+     * @brief Decide whether a failed transfer is tried again.
+     *
+     * @param[in] failedTries failed tries so far, WAIT answers not counted.
+     * @param[in] waitTimeS time asked by a WAIT answer to the last try, in
+     *                      seconds. 0 if the last try failed otherwise.
+     * @param[in] elapsed time since the first try.
+     * @param[out] delay time to wait before the next try.
+     *
+     * @return true if the transfer is tried again after delay.
+     * @return false if it is given up.
+     */
+    virtual bool nextTry(uint16_t failedTries, uint16_t waitTimeS,
+                         std::chrono::milliseconds elapsed,
+                         std::chrono::milliseconds &delay);
+
+    /**
+     * @brief Get how long to wait for the next status file of a target
+     *        hardware, from the fields of its last status file.
+     *
+     * @param[in] exceptionTimer Exception Timer of the last status file, in
+     *                           seconds. 0 if not set.
+     * @param[in] estimatedTime Estimated Time of the last status file, in
+     *                          seconds. 0 if not set.
+     *
+     * @return the time to wait. DEFAULT_AUTHENTICATION_DLP_TIMEOUT unless
+     *         the target hardware set its Exception Timer.
+     */
+    virtual std::chrono::milliseconds statusTimeout(uint16_t exceptionTimer,
+                                                    uint16_t estimatedTime);
+
+private:
+    uint16_t maxTries;
+    std::chrono::milliseconds initialBackoff;
+    std::chrono::milliseconds maxBackoff;
+    double jitter;
+    std::chrono::milliseconds deadline;
+};
+
+#endif // AUTHENTICATIONRETRYPOLICY_H
@@ -3,6 +3,9 @@
 
 #include "AuthenticationBase.h"
 #include "LoadAuthenticationStatusFile.h"
+#include "LoadAuthenticationStatusEncoder.h"
+#include "AuthenticationFileValidator.h"
+#include "AuthenticationMemoryFile.h"
 #include "INotifierAuthentication.h"
 
 #include <thread>
@@ -162,6 +165,19 @@ public:
      */
     AuthenticationOperationResult getState(AuthenticationTargetHardwareState &state);
 
+    /**
+     * @brief Get how many files received from the dataloader were rejected
+     * by the framing validation for a given reason.
+     *
+     * @param[in] reason the rejection reason.
+     * @param[out] numberOfRejectedFiles number of files rejected for this reason.
+     *
+     * @return AUTHENTICATION_OPERATION_OK if success.
+     * @return AUTHENTICATION_OPERATION_ERROR otherwise.
+     */
+    AuthenticationOperationResult getNumberOfRejectedFiles(
+        AuthenticationFileValidationResult reason, uint32_t &numberOfRejectedFiles);
+
     NotifierAuthenticationOperationResult notify(NotifierAuthenticationEventType event) override;
 
     AuthenticationOperationResult abort(uint16_t abortSource) override;
@@ -186,9 +202,21 @@ private:
     std::string baseFileName;
     std::shared_ptr<std::vector<uint8_t>> loadAuthenticationInitializationFileBuffer;
     std::shared_ptr<std::vector<uint8_t>> loadAuthenticationRequestFileBuffer;
+    // Receives the load list into loadAuthenticationRequestFileBuffer
+    std::unique_ptr<AuthenticationMemoryFile> loadAuthenticationRequestMemoryFile;
 
     std::shared_ptr<std::vector<LoadAuthenticationStatusHeaderFile>> statusHeaderFiles;
 
+    // Status header files are shared with the encoder, so once notified they
+    // are only changed through it, with statusEncoderMutex held.
+    LoadAuthenticationStatusEncoder statusEncoder;
+    std::mutex statusEncoderMutex;
+    // Copy of the encoded status file, sent once statusEncoderMutex is
+    // released. Only used by the status thread.
+    std::vector<uint8_t> statusFileImage;
+
+    AuthenticationFileValidator fileValidator;
+
     AuthenticationOperationResult checkAuthenticationConditions();
 
     // Current state holds the last state successfully sent to the dataloader
@@ -0,0 +1,257 @@
+#ifndef FLEETAUTHENTICATOR_H
+#define FLEETAUTHENTICATOR_H
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "AuthenticationDataLoader.h"
+
+// Targets authenticated at once when no concurrency cap is given
+#define DEFAULT_FLEET_CONCURRENCY 8
+
+/**
+ * @brief Result of the authentication of one target of a fleet.
+ */
+struct FleetTargetResult
+{
+    std::string targetHardwareId;
+    std::string targetHardwarePosition;
+    std::string targetHardwareIp;
+    AuthenticationOperationResult result;
+    AuthenticationTargetState state;
+    // Since the fleet authentication started
+    std::chrono::duration<double> startedAt;
+    std::chrono::duration<double> endedAt;
+    uint32_t retries;
+    uint32_t waits;
+    // Never started, since the fleet authentication was aborted first
+    bool aborted;
+};
+
+/**
+ * @brief Aggregate report of a fleet authentication.
+ */
+struct FleetReport
+{
+    size_t numberOfTargets;
+    size_t numberOfCompletedTargets;
+    size_t numberOfFailedTargets;
+    // Never started, since the fleet authentication was aborted first
+    size_t numberOfAbortedTargets;
+    size_t concurrency;
+    // From the start of the fleet authentication to the end of the last target
+    std::chrono::duration<double> makespan;
+    // Sum, mean and longest authentication time of the targets started
+    std::chrono::duration<double> totalTargetTime;
+    std::chrono::duration<double> meanTargetTime;
+    std::chrono::duration<double> longestTargetTime;
+    // Targets started per second of makespan
+    double throughput;
+};
+
+/**
+ * @brief Callback for the end of the authentication of one target of a
+ *        fleet. It is called from a DataLoader thread as soon as the target
+ *        ends, before the next target is started, so it must not block.
+ *
+ * @param[in] result the result of the target.
+ * @param[in] context the user context.
+ *
+ * @return AUTHENTICATION_OPERATION_OK if success.
+ * @return AUTHENTICATION_OPERATION_ERROR otherwise.
+ */
+typedef AuthenticationOperationResult (*fleetTargetCompletedCallback)(
+    const FleetTargetResult &result,
+    void *context);
+
+/**
+ * @brief Authenticates a batch of target hardwares, such as a whole
+ *        aircraft, through one DataLoader.
+ *
+ * At most the concurrency cap of targets are authenticated at once. No
+ * thread waits for a given target: the end of each target starts the next
+ * one left, so a slow target holds up nothing but its own slot.
+ *
+ * AuthenticationDataLoader::abort() only aborts the targets in flight, and
+ * the fleet goes on with the next ones. Use abort() to stop the fleet.
+ */
+class FleetAuthenticator
+{
+public:
+    /**
+     * @brief Create a fleet authenticator.
+     *
+     * @param[in] dataLoader the DataLoader authenticating the targets, with
+     *                       its ports and callbacks set. It must outlive the
+     *                       fleet authenticator.
+     * @param[in] concurrency most targets authenticated at once.
+     */
+    FleetAuthenticator(AuthenticationDataLoader *dataLoader,
+                       size_t concurrency = DEFAULT_FLEET_CONCURRENCY);
+    virtual ~FleetAuthenticator();
+
+    FleetAuthenticator(const FleetAuthenticator &) = delete;
+    FleetAuthenticator &operator=(const FleetAuthenticator &) = delete;
+
+    /**
+     * @brief Set the most targets authenticated at once.
+     *
+     * @param[in] concurrency the concurrency cap, at least 1.
+     *
+     * @return AUTHENTICATION_OPERATION_OK if success.
+     * @return AUTHENTICATION_OPERATION_ERROR if 0 or while authenticating.
+     */
+    AuthenticationOperationResult setConcurrency(size_t concurrency);
+
+    /**
+     * @brief Add a target hardware to the fleet.
+     *
+     * @param[in] targetHardwareId the TargetHardware ID.
+     * @param[in] targetHardwarePosition the TargetHardware position.
+     * @param[in] targetHardwareIp the TargetHardware IP.
+     * @param[in] loadList the load list of this TargetHardware.
+     *
+     * @return AUTHENTICATION_OPERATION_OK if success.
+     * @return AUTHENTICATION_OPERATION_ERROR if a parameter is empty, the
+     *         target was already added, or while authenticating.
+     */
+    AuthenticationOperationResult addTarget(std::string targetHardwareId,
+                                            std::string targetHardwarePosition,
+                                            std::string targetHardwareIp,
+                                            std::vector<AuthenticationLoad> loadList);
+
+    /**
+     * @brief Remove all the targets of the fleet.
+     *
+     * @return AUTHENTICATION_OPERATION_OK if success.
+     * @return AUTHENTICATION_OPERATION_ERROR while authenticating.
+     */
+    AuthenticationOperationResult clearTargets();
+
+    /**
+     * @brief Register a callback for the end of each target.
+     *
+     * @param[in] callback the callback.
+     * @param[in] context the user context.
+     *
+     * @return AUTHENTICATION_OPERATION_OK if success.
+     * @return AUTHENTICATION_OPERATION_ERROR otherwise.
+     */
+    AuthenticationOperationResult registerTargetCompletedCallback(
+        fleetTargetCompletedCallback callback, void *context);
+
+    /**
+     * @brief Authenticate every target of the fleet. This call blocks until
+     *        every authentication ends.
+     *
+     * @return AUTHENTICATION_OPERATION_OK if every target completed its
+     *         authentication.
+     * @return AUTHENTICATION_OPERATION_ERROR otherwise.
+     */
+    AuthenticationOperationResult authenticate();
+
+    /**
+     * @brief Abort the fleet authentication in progress. No other target is
+     *        started, the targets in flight are cancelled, and the targets
+     *        never started are added to the results as aborted, without
+     *        calling the target completed callback. authenticate() returns
+     *        once the targets in flight end.
+     *
+     * @param[in] abortSource the abort source sent to the target hardwares.
+     *
+     * @return AUTHENTICATION_OPERATION_OK if success.
+     * @return AUTHENTICATION_OPERATION_ERROR if no fleet authentication is
+     *         in progress, or it is already aborted.
+     */
+    AuthenticationOperationResult abort(
+        uint16_t abortSource = AUTHENTICATION_ABORT_SOURCE_OPERATOR);
+
+    /**
+     * @brief Get the results of the last fleet authentication, in the order
+     *        the targets ended.
+     *
+     * @param[out] results the results.
+     *
+     * @return AUTHENTICATION_OPERATION_OK if success.
+     * @return AUTHENTICATION_OPERATION_ERROR otherwise.
+     */
+    AuthenticationOperationResult getResults(std::vector<FleetTargetResult> &results);
+
+    /**
+     * @brief Get the report of the last fleet authentication.
+     *
+     * @param[out] report the report.
+     *
+     * @return AUTHENTICATION_OPERATION_OK if success.
+     * @return AUTHENTICATION_OPERATION_ERROR if nothing was authenticated yet.
+     */
+    AuthenticationOperationResult getReport(FleetReport &report);
+
+private:
+    struct FleetTarget
+    {
+        std::string targetHardwareId;
+        std::string targetHardwarePosition;
+        std::string targetHardwareIp;
+        std::vector<AuthenticationLoad> loadList;
+    };
+
+    // A target of the running fleet authentication, handed to the
+    // DataLoader as the context of its completion callback
+    struct FleetRun
+    {
+        FleetAuthenticator *fleet;
+        size_t target;
+        std::shared_ptr<AuthenticationHandle> handle;
+        std::chrono::steady_clock::time_point startedAt;
+        std::chrono::steady_clock::time_point endedAt;
+        AuthenticationOperationResult result;
+        // The target is done once authenticateAsync() returned and the
+        // authentication ended, whichever comes last
+        bool returned;
+        bool ended;
+        bool aborted;
+    };
+
+    static AuthenticationOperationResult targetCompleted(
+        std::string targetHardwareId, std::string targetHardwarePosition,
+        AuthenticationOperationResult result, void *context);
+    void runTargets(size_t target);
+    bool startTarget(size_t target);
+    bool finishTarget(size_t target, size_t &next);
+    void recordResult(size_t target);
+
+    AuthenticationDataLoader *dataLoader;
+
+    // Everything below is guarded by targetsMutex, and only read while
+    // authenticating
+    std::mutex targetsMutex;
+    size_t concurrency;
+    fleetTargetCompletedCallback _targetCompletedCallback;
+    void *_targetCompletedContext;
+    std::vector<FleetTarget> targets;
+    bool authenticating;
+
+    // Everything below is guarded by runsMutex
+    std::mutex runsMutex;
+    std::condition_variable runsCV;
+    std::vector<FleetRun> runs;
+    size_t pendingTargets;
+    size_t nextTarget;
+    bool aborted;
+    uint16_t abortSource;
+
+    std::chrono::steady_clock::time_point start;
+
+    // Everything below is guarded by resultsMutex
+    std::mutex resultsMutex;
+    std::vector<FleetTargetResult> results;
+    bool hasReport;
+    FleetReport report;
+};
+
+#endif // FLEETAUTHENTICATOR_H
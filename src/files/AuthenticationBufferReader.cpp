@@ -0,0 +1,74 @@
+#include "AuthenticationBufferReader.h"
+
+AuthenticationBufferReader::AuthenticationBufferReader(const uint8_t *buffer,
+                                                       size_t size, size_t offset)
+{
+    this->buffer = buffer;
+    this->size = (buffer == nullptr) ? 0 : size;
+    this->offset = (offset > this->size) ? this->size : offset;
+}
+
+AuthenticationBufferReader::~AuthenticationBufferReader()
+{
+}
+
+bool AuthenticationBufferReader::getUint8(uint8_t &value)
+{
+    if (size - offset < sizeof(value))
+    {
+        return false;
+    }
+    value = buffer[offset];
+    offset += sizeof(value);
+    return true;
+}
+
+bool AuthenticationBufferReader::getUint16(uint16_t &value)
+{
+    if (size - offset < sizeof(value))
+    {
+        return false;
+    }
+    value = (buffer[offset] << 8) | buffer[offset + 1];
+    offset += sizeof(value);
+    return true;
+}
+
+bool AuthenticationBufferReader::getUint24(uint32_t &value)
+{
+    if (size - offset < sizeof(value) - sizeof(uint8_t))
+    {
+        return false;
+    }
+    value = (buffer[offset] << 16) | (buffer[offset + 1] << 8) | buffer[offset + 2];
+    offset += sizeof(value) - sizeof(uint8_t);
+    return true;
+}
+
+bool AuthenticationBufferReader::getUint32(uint32_t &value)
+{
+    if (size - offset < sizeof(value))
+    {
+        return false;
+    }
+    value = (static_cast<uint32_t>(buffer[offset]) << 24) | (buffer[offset + 1] << 16) |
+            (buffer[offset + 2] << 8) | buffer[offset + 3];
+    offset += sizeof(value);
+    return true;
+}
+
+bool AuthenticationBufferReader::getField(size_t fieldSize, AuthenticationFieldView &field)
+{
+    if (size - offset < fieldSize)
+    {
+        return false;
+    }
+    field = AuthenticationFieldView(buffer + offset, fieldSize);
+    offset += fieldSize;
+    return true;
+}
+
+size_t AuthenticationBufferReader::getOffset()
+{
+    return offset;
+}
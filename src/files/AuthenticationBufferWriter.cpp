@@ -0,0 +1,98 @@
+#include "AuthenticationBufferWriter.h"
+#include <cstring>
+
+AuthenticationBufferWriter::AuthenticationBufferWriter(uint8_t *buffer, size_t capacity)
+{
+    this->buffer = buffer;
+    this->capacity = (buffer == nullptr) ? 0 : capacity;
+    written = 0;
+}
+
+AuthenticationBufferWriter::~AuthenticationBufferWriter()
+{
+}
+
+bool AuthenticationBufferWriter::putUint8(uint8_t value)
+{
+    if (capacity - written < sizeof(value))
+    {
+        return false;
+    }
+    buffer[written++] = value;
+    return true;
+}
+
+bool AuthenticationBufferWriter::putUint16(uint16_t value)
+{
+    if (capacity - written < sizeof(value))
+    {
+        return false;
+    }
+    buffer[written++] = (value >> 8) & 0xFF;
+    buffer[written++] = value & 0xFF;
+    return true;
+}
+
+bool AuthenticationBufferWriter::putUint24(uint32_t value)
+{
+    if (capacity - written < sizeof(value) - sizeof(uint8_t))
+    {
+        return false;
+    }
+    buffer[written++] = (value >> 16) & 0xFF;
+    buffer[written++] = (value >> 8) & 0xFF;
+    buffer[written++] = value & 0xFF;
+    return true;
+}
+
+bool AuthenticationBufferWriter::putUint32(uint32_t value)
+{
+    if (capacity - written < sizeof(value))
+    {
+        return false;
+    }
+    buffer[written++] = (value >> 24) & 0xFF;
+    buffer[written++] = (value >> 16) & 0xFF;
+    buffer[written++] = (value >> 8) & 0xFF;
+    buffer[written++] = value & 0xFF;
+    return true;
+}
+
+bool AuthenticationBufferWriter::putBytes(const void *data, size_t size)
+{
+    if (capacity - written < size)
+    {
+        return false;
+    }
+    if (size > 0)
+    {
+        std::memcpy(buffer + written, data, size);
+        written += size;
+    }
+    return true;
+}
+
+bool AuthenticationBufferWriter::advance(size_t size)
+{
+    if (capacity - written < size)
+    {
+        return false;
+    }
+    written += size;
+    return true;
+}
+
+uint8_t *AuthenticationBufferWriter::getCursor()
+{
+    return buffer + written;
+}
+
+size_t AuthenticationBufferWriter::getRemaining()
+{
+    return capacity - written;
+}
+
+size_t AuthenticationBufferWriter::getWritten()
+{
+    return written;
+}
@@ -0,0 +1,54 @@
+#include "AuthenticationFieldView.h"
+#include <cstring>
+
+AuthenticationFieldView::AuthenticationFieldView(const uint8_t *data, size_t size)
+{
+    fieldData = data;
+    fieldSize = (data == nullptr) ? 0 : size;
+}
+
+AuthenticationFieldView::~AuthenticationFieldView()
+{
+}
+
+const uint8_t *AuthenticationFieldView::data() const
+{
+    return fieldData;
+}
+
+size_t AuthenticationFieldView::size() const
+{
+    return fieldSize;
+}
+
+bool AuthenticationFieldView::empty() const
+{
+    return fieldSize == 0;
+}
+
+std::string AuthenticationFieldView::toString() const
+{
+    return std::string(reinterpret_cast<const char *>(fieldData), stringLength());
+}
+
+bool AuthenticationFieldView::equals(const std::string &value) const
+{
+    size_t length = stringLength();
+    return (value.size() == length) &&
+           (length == 0 || std::memcmp(value.data(), fieldData, length) == 0);
+}
+
+size_t AuthenticationFieldView::stringLength() const
+{
+    if (fieldSize == 0)
+    {
+        return 0;
+    }
+
+    const void *terminator = std::memchr(fieldData, '\0', fieldSize);
+    if (terminator == nullptr)
+    {
+        return fieldSize;
+    }
+    return static_cast<const uint8_t *>(terminator) - fieldData;
+}
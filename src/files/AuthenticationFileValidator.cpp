@@ -0,0 +1,198 @@
+#include "AuthenticationFileValidator.h"
+#include "AuthenticationBufferReader.h"
+#include <algorithm>
+#include <cstring>
+
+// Size of the fixed fields of each file, with every variable field empty
+#define BASE_FIXED_SIZE (sizeof(uint32_t) + PROTOCOL_VERSION_SIZE)
+#define INITIALIZATION_FIXED_SIZE \
+    (BASE_FIXED_SIZE + sizeof(uint16_t) + sizeof(uint16_t) + sizeof(uint8_t))
+#define LOAD_REQUEST_FIXED_SIZE (BASE_FIXED_SIZE + sizeof(uint16_t))
+#define LOAD_STATUS_FIXED_SIZE \
+    (BASE_FIXED_SIZE + sizeof(uint16_t) + sizeof(uint8_t) + 3 * sizeof(uint16_t) + 3 + \
+     sizeof(uint16_t))
+
+// Size of the smallest header file of each list
+#define LOAD_REQUEST_HEADER_MIN_SIZE (2 * sizeof(uint8_t))
+#define LOAD_STATUS_HEADER_MIN_SIZE (3 * sizeof(uint8_t) + 3 + sizeof(uint16_t))
+
+static bool skipField8(AuthenticationBufferReader &reader)
+{
+    uint8_t length = 0;
+    AuthenticationFieldView field;
+    return reader.getUint8(length) && reader.getField(length, field);
+}
+
+static bool skipField16(AuthenticationBufferReader &reader)
+{
+    uint16_t length = 0;
+    AuthenticationFieldView field;
+    return reader.getUint16(length) && reader.getField(length, field);
+}
+
+static bool skipLoadRequestHeaderFile(AuthenticationBufferReader &reader)
+{
+    return skipField8(reader) && skipField8(reader);
+}
+
+static bool skipLoadStatusHeaderFile(AuthenticationBufferReader &reader)
+{
+    uint32_t loadRatio = 0;
+    uint16_t loadStatus = 0;
+    return skipField8(reader) && skipField8(reader) &&
+           reader.getUint24(loadRatio) && reader.getUint16(loadStatus) &&
+           skipField8(reader);
+}
+
+static AuthenticationFileValidationResult checkHeaderFiles(
+    AuthenticationBufferReader &reader, size_t fileLength, size_t headerFileMinSize,
+    bool (*skipHeaderFile)(AuthenticationBufferReader &))
+{
+    uint16_t numberOfHeaderFiles = 0;
+    if (!reader.getUint16(numberOfHeaderFiles))
+    {
+        // Only a description running over the count gets here
+        return AuthenticationFileValidationResult::AUTHENTICATION_FILE_INVALID_FIELD_LENGTH;
+    }
+
+    // Reject counts that can not fit before walking the list
+    if (numberOfHeaderFiles * headerFileMinSize > fileLength - reader.getOffset())
+    {
+        return AuthenticationFileValidationResult::AUTHENTICATION_FILE_INVALID_HEADER_COUNT;
+    }
+
+    for (uint16_t i = 0; i < numberOfHeaderFiles; i++)
+    {
+        size_t headerFileOffset = reader.getOffset();
+        if (!skipHeaderFile(reader))
+        {
+            return (headerFileOffset == fileLength)
+                       ? AuthenticationFileValidationResult::AUTHENTICATION_FILE_INVALID_HEADER_COUNT
+                       : AuthenticationFileValidationResult::AUTHENTICATION_FILE_INVALID_FIELD_LENGTH;
+        }
+    }
+
+    return AuthenticationFileValidationResult::AUTHENTICATION_FILE_VALID;
+}
+
+AuthenticationFileValidator::AuthenticationFileValidator(std::string protocolVersion)
+{
+    std::memset(this->protocolVersion, 0, PROTOCOL_VERSION_SIZE);
+    size_t protocolVersionSize = std::min(protocolVersion.size(), PROTOCOL_VERSION_SIZE);
+    std::memcpy(this->protocolVersion, protocolVersion.c_str(), protocolVersionSize);
+
+    for (size_t i = 0; i < AUTHENTICATION_FILE_VALIDATION_RESULTS; i++)
+    {
+        validations[i] = 0;
+    }
+}
+
+AuthenticationFileValidator::~AuthenticationFileValidator()
+{
+}
+
+AuthenticationFileValidationResult AuthenticationFileValidator::validate(
+    const uint8_t *data, size_t dataSize, AuthenticationFileKind kind)
+{
+    AuthenticationFileValidationResult result = check(data, dataSize, kind);
+    validations[static_cast<size_t>(result)]++;
+    return result;
+}
+
+uint32_t AuthenticationFileValidator::getNumberOfValidations(
+    AuthenticationFileValidationResult result)
+{
+    size_t index = static_cast<size_t>(result);
+    if (index >= AUTHENTICATION_FILE_VALIDATION_RESULTS)
+    {
+        return 0;
+    }
+    return validations[index];
+}
+
+uint32_t AuthenticationFileValidator::getNumberOfRejectedFiles()
+{
+    uint32_t rejectedFiles = 0;
+    for (size_t i = 1; i < AUTHENTICATION_FILE_VALIDATION_RESULTS; i++)
+    {
+        rejectedFiles += validations[i];
+    }
+    return rejectedFiles;
+}
+
+AuthenticationFileValidationResult AuthenticationFileValidator::check(
+    const uint8_t *data, size_t dataSize, AuthenticationFileKind kind)
+{
+    AuthenticationBufferReader reader(data, dataSize);
+    uint32_t fileLength = 0;
+    if (!reader.getUint32(fileLength) || fileLength > dataSize)
+    {
+        return AuthenticationFileValidationResult::AUTHENTICATION_FILE_TRUNCATED;
+    }
+
+    size_t fixedSize = 0;
+    switch (kind)
+    {
+    case AuthenticationFileKind::AUTHENTICATION_FILE_KIND_INITIALIZATION:
+        fixedSize = INITIALIZATION_FIXED_SIZE;
+        break;
+    case AuthenticationFileKind::AUTHENTICATION_FILE_KIND_LOAD_REQUEST:
+        fixedSize = LOAD_REQUEST_FIXED_SIZE;
+        break;
+    case AuthenticationFileKind::AUTHENTICATION_FILE_KIND_LOAD_STATUS:
+        fixedSize = LOAD_STATUS_FIXED_SIZE;
+        break;
+    }
+    if (fileLength < fixedSize)
+    {
+        return AuthenticationFileValidationResult::AUTHENTICATION_FILE_INVALID_FILE_LENGTH;
+    }
+
+    // From now on, nothing past the file length is part of the file
+    reader = AuthenticationBufferReader(data, fileLength, reader.getOffset());
+
+    AuthenticationFieldView protocolVersion;
+    reader.getField(PROTOCOL_VERSION_SIZE, protocolVersion);
+    if (std::memcmp(protocolVersion.data(), this->protocolVersion, PROTOCOL_VERSION_SIZE) != 0)
+    {
+        return AuthenticationFileValidationResult::AUTHENTICATION_FILE_INVALID_PROTOCOL_VERSION;
+    }
+
+    AuthenticationFileValidationResult result =
+        AuthenticationFileValidationResult::AUTHENTICATION_FILE_VALID;
+    uint16_t value16 = 0;
+    uint32_t value24 = 0;
+    switch (kind)
+    {
+    case AuthenticationFileKind::AUTHENTICATION_FILE_KIND_INITIALIZATION:
+        if (!reader.getUint16(value16) || !skipField16(reader) || !skipField8(reader))
+        {
+            return AuthenticationFileValidationResult::AUTHENTICATION_FILE_INVALID_FIELD_LENGTH;
+        }
+        break;
+    case AuthenticationFileKind::AUTHENTICATION_FILE_KIND_LOAD_REQUEST:
+        result = checkHeaderFiles(reader, fileLength, LOAD_REQUEST_HEADER_MIN_SIZE,
+                                  skipLoadRequestHeaderFile);
+        break;
+    case AuthenticationFileKind::AUTHENTICATION_FILE_KIND_LOAD_STATUS:
+        if (!reader.getUint16(value16) || !skipField8(reader) ||
+            !reader.getUint16(value16) || !reader.getUint16(value16) ||
+            !reader.getUint16(value16) || !reader.getUint24(value24))
+        {
+            return AuthenticationFileValidationResult::AUTHENTICATION_FILE_INVALID_FIELD_LENGTH;
+        }
+        result = checkHeaderFiles(reader, fileLength, LOAD_STATUS_HEADER_MIN_SIZE,
+                                  skipLoadStatusHeaderFile);
+        break;
+    }
+
+    if (result != AuthenticationFileValidationResult::AUTHENTICATION_FILE_VALID)
+    {
+        return result;
+    }
+    if (reader.getOffset() != fileLength)
+    {
+        return AuthenticationFileValidationResult::AUTHENTICATION_FILE_TRAILING_DATA;
+    }
+    return AuthenticationFileValidationResult::AUTHENTICATION_FILE_VALID;
+}
@@ -0,0 +1,160 @@
+#include "AuthenticationJsonWriter.h"
+
+#include <climits>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+AuthenticationJsonWriter::AuthenticationJsonWriter(std::string &output) : output(output)
+{
+    firstValue = true;
+}
+
+AuthenticationJsonWriter::~AuthenticationJsonWriter()
+{
+}
+
+void AuthenticationJsonWriter::beginObject(const char *name)
+{
+    beginValue(name);
+    output.push_back('{');
+    firstValue = true;
+}
+
+void AuthenticationJsonWriter::endObject()
+{
+    output.push_back('}');
+    firstValue = false;
+}
+
+void AuthenticationJsonWriter::beginArray(const char *name)
+{
+    beginValue(name);
+    output.push_back('[');
+    firstValue = true;
+}
+
+void AuthenticationJsonWriter::endArray()
+{
+    output.push_back(']');
+    firstValue = false;
+}
+
+void AuthenticationJsonWriter::addString(const char *name, const char *value)
+{
+    beginValue(name);
+    appendString(value);
+}
+
+void AuthenticationJsonWriter::addNumber(const char *name, double value)
+{
+    beginValue(name);
+
+    // Same rules as cJSON: integers that fit in an int are printed as such,
+    // anything else with the shortest precision that reads back the same.
+    char number[26];
+    int valueInt = 0;
+    if (value >= INT_MAX)
+    {
+        valueInt = INT_MAX;
+    }
+    else if (value <= (double)INT_MIN)
+    {
+        valueInt = INT_MIN;
+    }
+    else
+    {
+        valueInt = (int)value;
+    }
+
+    if (std::isnan(value) || std::isinf(value))
+    {
+        std::strcpy(number, "null");
+    }
+    else if (value == (double)valueInt)
+    {
+        std::snprintf(number, sizeof(number), "%d", valueInt);
+    }
+    else
+    {
+        double test = 0;
+        std::snprintf(number, sizeof(number), "%1.15g", value);
+        if ((std::sscanf(number, "%lg", &test) != 1) || (test != value))
+        {
+            std::snprintf(number, sizeof(number), "%1.17g", value);
+        }
+    }
+    output.append(number);
+}
+
+void AuthenticationJsonWriter::beginValue(const char *name)
+{
+    if (!firstValue)
+    {
+        output.push_back(',');
+    }
+    firstValue = false;
+
+    if (name != nullptr)
+    {
+        appendString(name);
+        output.push_back(':');
+    }
+}
+
+void AuthenticationJsonWriter::appendString(const char *value)
+{
+    output.push_back('"');
+    if (value == nullptr)
+    {
+        output.push_back('"');
+        return;
+    }
+
+    // Copy runs of characters that need no escaping at once
+    const char *run = value;
+    for (const char *it = value; *it != '\0'; it++)
+    {
+        unsigned char character = static_cast<unsigned char>(*it);
+        if (character >= 32 && character != '"' && character != '\\')
+        {
+            continue;
+        }
+
+        output.append(run, it - run);
+        run = it + 1;
+        switch (character)
+        {
+        case '"':
+            output.append("\\\"");
+            break;
+        case '\\':
+            output.append("\\\\");
+            break;
+        case '\b':
+            output.append("\\b");
+            break;
+        case '\f':
+            output.append("\\f");
+            break;
+        case '\n':
+            output.append("\\n");
+            break;
+        case '\r':
+            output.append("\\r");
+            break;
+        case '\t':
+            output.append("\\t");
+            break;
+        default:
+        {
+            char escaped[7];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", character);
+            output.append(escaped);
+            break;
+        }
+        }
+    }
+    output.append(run);
+    output.push_back('"');
+}
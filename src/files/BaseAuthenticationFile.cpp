@@ -1,6 +1,12 @@
 #include "BaseAuthenticationFile.h"
+#include "AuthenticationBufferWriter.h"
 #include <cstring>
 
+// Member names and decimal numbers make the JSON a few times bigger than the
+// binary file
+#define JSON_RESERVE_BYTES_PER_FILE_BYTE static_cast<size_t>(4)
+#define JSON_RESERVE_BYTES static_cast<size_t>(256)
+
 BaseAuthenticationFile::BaseAuthenticationFile(std::string fileName,
                                                std::string protocolVersion)
 {
@@ -39,82 +45,108 @@ FileAuthenticationOperationResult BaseAuthenticationFile::getFileName(std::strin
 SerializableAuthenticationOperationResult BaseAuthenticationFile::serialize(
     std::shared_ptr<std::vector<uint8_t>> &data)
 {
-    data->push_back((fileLength >> 24) & 0xFF);
-    data->push_back((fileLength >> 16) & 0xFF);
-    data->push_back((fileLength >> 8) & 0xFF);
-    data->push_back(fileLength & 0xFF);
-    data->insert(data->end(), protocolVersion,
-                 protocolVersion + PROTOCOL_VERSION_SIZE);
+    // The whole file is written at once, through serializeInto(), after a
+    // single resize of the output vector.
+    size_t fileSize = 0;
+    if (getFileSize(fileSize) != FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK)
+    {
+        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
+    }
+
+    size_t offset = data->size();
+    data->resize(offset + fileSize);
+
+    size_t written = 0;
+    SerializableAuthenticationOperationResult result =
+        serializeInto(data->data() + offset, fileSize, written);
+    if (result != SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK)
+    {
+        data->resize(offset);
+        return result;
+    }
+    data->resize(offset + written);
+
+    return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK;
+}
+
+SerializableAuthenticationOperationResult BaseAuthenticationFile::serializeInto(
+    uint8_t *buffer, size_t capacity, size_t &written)
+{
+    AuthenticationBufferWriter writer(buffer, capacity);
+    written = 0;
+
+    if (!writer.putUint32(fileLength) ||
+        !writer.putBytes(protocolVersion, PROTOCOL_VERSION_SIZE))
+    {
+        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
+    }
 
+    written = writer.getWritten();
     return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK;
 }
 
 SerializableAuthenticationOperationResult BaseAuthenticationFile::deserialize(
     std::shared_ptr<std::vector<uint8_t>> &data)
+{
+    return deserializeFrom(data->data(), data->size());
+}
+
+SerializableAuthenticationOperationResult BaseAuthenticationFile::deserializeFrom(
+    const uint8_t *data, size_t dataSize)
 {
     size_t offset = 0;
-    if (data->size() < offset + sizeof(fileLength))
+    if (dataSize < offset + sizeof(fileLength))
     {
         return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
     }
-    fileLength = (data->at(offset) << 24) | (data->at(offset + 1) << 16) |
-                 (data->at(offset + 2) << 8) | data->at(offset + 3);
+    fileLength = (data[offset] << 24) | (data[offset + 1] << 16) |
+                 (data[offset + 2] << 8) | data[offset + 3];
     offset += sizeof(fileLength);
 
-    if (data->size() < offset + PROTOCOL_VERSION_SIZE)
+    if (dataSize < offset + PROTOCOL_VERSION_SIZE)
     {
         return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
     }
-    std::memcpy(protocolVersion, data->data() + offset, PROTOCOL_VERSION_SIZE);
+    std::memcpy(protocolVersion, data + offset, PROTOCOL_VERSION_SIZE);
 
     return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK;
 }
 
 SerializableAuthenticationOperationResult BaseAuthenticationFile::serializeJSON(std::string &data)
 {
-    cJSON *root = cJSON_CreateObject();
-    if (root == NULL)
+    // Reserve the whole JSON at once, so appending to it rarely reallocates.
+    // It is sized from the fields held, not from the length read from a
+    // received file, which is not trusted.
+    data.clear();
+    size_t fileSize = 0;
+    if (getFileSize(fileSize) == FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK)
     {
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
+        data.reserve(JSON_RESERVE_BYTES_PER_FILE_BYTE * fileSize + JSON_RESERVE_BYTES);
     }
 
-    cJSON *fileNameJSON = cJSON_CreateString(fileName.c_str());
-    if (fileNameJSON == NULL)
+    AuthenticationJsonWriter writer(data);
+    writer.beginObject();
+    SerializableAuthenticationOperationResult result = serializeJSONFields(writer);
+    if (result != SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK)
     {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
+        data.clear();
+        return result;
     }
-    cJSON_AddItemToObject(root, "fileName", fileNameJSON);
+    writer.endObject();
 
-    cJSON *fileLengthJSON = cJSON_CreateNumber(fileLength);
-    if (fileLengthJSON == NULL)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    cJSON_AddItemToObject(root, "fileLength", fileLengthJSON);
+    return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK;
+}
 
-    // Remember: protocolVersion is not null terminated
-    std::string protocolVersionStr(3, '\0');
-    protocolVersionStr[0] = protocolVersion[0];
-    protocolVersionStr[1] = protocolVersion[1];
-    cJSON *protocolVersionJSON = cJSON_CreateString(protocolVersionStr.c_str());
-    if (protocolVersionJSON == NULL)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    cJSON_AddItemToObject(root, "protocolVersion", protocolVersionJSON);
+SerializableAuthenticationOperationResult BaseAuthenticationFile::serializeJSONFields(
+    AuthenticationJsonWriter &writer)
+{
+    writer.addString("fileName", fileName.c_str());
+    writer.addNumber("fileLength", fileLength);
 
-    char *serializedJSON = cJSON_PrintUnformatted(root);
-    if (serializedJSON == NULL)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    data = std::string(serializedJSON);
-    free(serializedJSON);
-    cJSON_Delete(root);
+    // Remember: protocolVersion is not null terminated
+    char protocolVersionStr[PROTOCOL_VERSION_SIZE + 1] = {0};
+    std::memcpy(protocolVersionStr, protocolVersion, PROTOCOL_VERSION_SIZE);
+    writer.addString("protocolVersion", protocolVersionStr);
 
     return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK;
 }
@@ -127,6 +159,15 @@ SerializableAuthenticationOperationResult BaseAuthenticationFile::deserializeJSO
         return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
     }
 
+    SerializableAuthenticationOperationResult result = deserializeJSONFields(root);
+    cJSON_Delete(root);
+
+    return result;
+}
+
+SerializableAuthenticationOperationResult BaseAuthenticationFile::deserializeJSONFields(
+    const cJSON *root)
+{
     cJSON *fileNameJSON = cJSON_GetObjectItemCaseSensitive(root, "fileName");
     if (cJSON_IsString(fileNameJSON) && (fileNameJSON->valuestring != NULL))
     {
@@ -156,7 +197,6 @@ SerializableAuthenticationOperationResult BaseAuthenticationFile::deserializeJSO
     {
         return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
     }
-    cJSON_Delete(root);
 
     return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK;
 }
@@ -1,23 +1,30 @@
 #include "InitializationAuthenticationFile.h"
+#include "AuthenticationFileCodec.h"
 #include <algorithm>
 #include <cstring>
-#include <sstream>
-#include <iomanip>
+#include <utility>
+
+struct InitializationAuthenticationFile::Codec
+{
+    typedef InitializationAuthenticationFile Owner;
+
+    AUTHENTICATION_CODEC_FIELD(AuthenticationUint16Encoding, operationAcceptanceStatusCode);
+    AUTHENTICATION_CODEC_FIELD(AuthenticationBytes16Encoding, cryptographicKey);
+    AUTHENTICATION_CODEC_FIELD(AuthenticationString8Encoding, statusDescription);
+
+    typedef AuthenticationCodec<Owner,
+                                operationAcceptanceStatusCodeField,
+                                cryptographicKeyField,
+                                statusDescriptionField>
+        Fields;
+};
 
 InitializationAuthenticationFile::InitializationAuthenticationFile(
     std::string fileName, std::string protocolVersion) : BaseAuthenticationFile(fileName, protocolVersion)
 {
     operationAcceptanceStatusCode = 0;
 
-    cryptographicKeyLength = 0;
-    std::memset(cryptographicKey, 0, MAX_CRYPTOGRAPHIC_KEY_SIZE);
-
-    statusDescriptionLength = 0;
-    std::memset(statusDescription, 0, MAX_STATUS_DESCRIPTION_SIZE);
-
-    fileLength += sizeof(operationAcceptanceStatusCode) +
-                  sizeof(cryptographicKeyLength) +
-                  sizeof(statusDescriptionLength);
+    fileLength += Codec::Fields::size(*this);
 }
 
 InitializationAuthenticationFile::~InitializationAuthenticationFile()
@@ -41,7 +48,7 @@ FileAuthenticationOperationResult InitializationAuthenticationFile::getOperation
 FileAuthenticationOperationResult InitializationAuthenticationFile::getCryptographicKeyLength(
     uint16_t &cryptographicKeyLength)
 {
-    cryptographicKeyLength = this->cryptographicKeyLength;
+    cryptographicKeyLength = cryptographicKey.size();
     return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
 }
 
@@ -53,37 +60,65 @@ FileAuthenticationOperationResult InitializationAuthenticationFile::setCryptogra
         return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_ERROR;
     }
 
-    fileLength -= cryptographicKeyLength;
-    cryptographicKeyLength = cryptographicKey.size();
-    std::memcpy(this->cryptographicKey, cryptographicKey.data(), cryptographicKeyLength);
-    fileLength += cryptographicKeyLength;
-    printf("setCryptographicKey: %s\n", this->cryptographicKey);
+    fileLength -= this->cryptographicKey.size();
+    this->cryptographicKey = cryptographicKey;
+    fileLength += this->cryptographicKey.size();
+    return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
+}
+
+FileAuthenticationOperationResult InitializationAuthenticationFile::setCryptographicKey(
+    std::vector<uint8_t> &&cryptographicKey)
+{
+    if (cryptographicKey.size() > MAX_CRYPTOGRAPHIC_KEY_SIZE)
+    {
+        return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_ERROR;
+    }
+
+    fileLength -= this->cryptographicKey.size();
+    this->cryptographicKey = std::move(cryptographicKey);
+    cryptographicKey.clear();
+    fileLength += this->cryptographicKey.size();
     return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
 }
 
 FileAuthenticationOperationResult InitializationAuthenticationFile::getCryptographicKey(
     std::vector<uint8_t> &cryptographicKey)
 {
-    cryptographicKey = std::vector<uint8_t>(this->cryptographicKey, 
-    this->cryptographicKey + cryptographicKeyLength);
+    cryptographicKey = this->cryptographicKey;
+    return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
+}
+
+FileAuthenticationOperationResult InitializationAuthenticationFile::getCryptographicKey(
+    AuthenticationFieldView &cryptographicKey) const
+{
+    cryptographicKey = AuthenticationFieldView(this->cryptographicKey.data(),
+                                               this->cryptographicKey.size());
+    return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
+}
+
+FileAuthenticationOperationResult InitializationAuthenticationFile::releaseCryptographicKey(
+    std::vector<uint8_t> &cryptographicKey)
+{
+    fileLength -= this->cryptographicKey.size();
+    cryptographicKey = std::move(this->cryptographicKey);
+    this->cryptographicKey.clear();
     return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
 }
 
 FileAuthenticationOperationResult InitializationAuthenticationFile::getStatusDescriptionLength(
     uint8_t &statusDescriptionLength)
 {
-    statusDescriptionLength = this->statusDescriptionLength;
+    statusDescriptionLength = this->statusDescription.size();
     return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
 }
 
 FileAuthenticationOperationResult InitializationAuthenticationFile::setStatusDescription(
     std::string statusDescription)
 {
-    fileLength -= statusDescriptionLength;
-    statusDescriptionLength = std::min(statusDescription.length() + 1,
-                                       MAX_STATUS_DESCRIPTION_SIZE);
-    std::memcpy(this->statusDescription, statusDescription.c_str(),
-                statusDescriptionLength);
+    fileLength -= this->statusDescription.size();
+    size_t statusDescriptionLength = std::min(statusDescription.length() + 1,
+                                              MAX_STATUS_DESCRIPTION_SIZE);
+    this->statusDescription.assign(statusDescription.c_str(), statusDescriptionLength);
     if (statusDescriptionLength == MAX_STATUS_DESCRIPTION_SIZE)
     {
         // If the string is too long, we need to add a null terminator to the end
@@ -96,35 +131,38 @@ FileAuthenticationOperationResult InitializationAuthenticationFile::setStatusDes
 FileAuthenticationOperationResult InitializationAuthenticationFile::getStatusDescription(
     std::string &statusDescription)
 {
-    statusDescription = std::string(this->statusDescription);
+    statusDescription = std::string(this->statusDescription.c_str());
     return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
 }
 
-SerializableAuthenticationOperationResult InitializationAuthenticationFile::serialize(
-    std::shared_ptr<std::vector<uint8_t>> &data)
+SerializableAuthenticationOperationResult InitializationAuthenticationFile::serializeInto(
+    uint8_t *buffer, size_t capacity, size_t &written)
 {
-    SerializableAuthenticationOperationResult result = BaseAuthenticationFile::serialize(data);
+    SerializableAuthenticationOperationResult result =
+        BaseAuthenticationFile::serializeInto(buffer, capacity, written);
     if (result != SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK)
     {
         return result;
     }
 
-    data->push_back((operationAcceptanceStatusCode >> 8) & 0xFF);
-    data->push_back(operationAcceptanceStatusCode & 0xFF);
-    data->push_back((cryptographicKeyLength >> 8) & 0xFF);
-    data->push_back(cryptographicKeyLength & 0xFF);
-    data->insert(data->end(), cryptographicKey, cryptographicKey + cryptographicKeyLength);
-    data->push_back(statusDescriptionLength);
-    data->insert(data->end(), statusDescription,
-                 statusDescription + statusDescriptionLength);
+    AuthenticationBufferWriter writer(buffer, capacity);
+    writer.advance(written);
+    written = 0;
 
+    if (!Codec::Fields::encode(writer, *this))
+    {
+        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
+    }
+
+    written = writer.getWritten();
     return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK;
 }
 
-SerializableAuthenticationOperationResult InitializationAuthenticationFile::deserialize(
-    std::shared_ptr<std::vector<uint8_t>> &data)
+SerializableAuthenticationOperationResult InitializationAuthenticationFile::deserializeFrom(
+    const uint8_t *data, size_t dataSize)
 {
-    SerializableAuthenticationOperationResult result = BaseAuthenticationFile::deserialize(data);
+    SerializableAuthenticationOperationResult result =
+        BaseAuthenticationFile::deserializeFrom(data, dataSize);
     if (result != SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK)
     {
         return result;
@@ -132,195 +170,45 @@ SerializableAuthenticationOperationResult InitializationAuthenticationFile::dese
 
     size_t parentSize = 0;
     BaseAuthenticationFile::getFileSize(parentSize);
-    size_t offset = parentSize;
-
-    if (data->size() < offset + sizeof(operationAcceptanceStatusCode))
-    {
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    operationAcceptanceStatusCode = (data->at(offset) << 8) | data->at(offset + 1);
-    offset += sizeof(operationAcceptanceStatusCode);
-
-    if (data->size() < offset + sizeof(cryptographicKeyLength))
-    {
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    cryptographicKeyLength = (data->at(offset) << 8) | data->at(offset + 1);
-    offset += sizeof(cryptographicKeyLength);
+    AuthenticationBufferReader reader(data, dataSize, parentSize);
 
-    if (data->size() < offset + cryptographicKeyLength)
+    if (!Codec::Fields::decode(reader, *this))
     {
         return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
     }
-    std::memcpy(cryptographicKey, data->data() + offset, cryptographicKeyLength);
-    offset += cryptographicKeyLength;
-
-    if (data->size() < offset + sizeof(statusDescriptionLength))
-    {
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    statusDescriptionLength = data->at(offset);
-    offset += sizeof(statusDescriptionLength);
-
-    if (data->size() < offset + statusDescriptionLength)
-    {
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    std::memcpy(statusDescription, data->data() + offset, statusDescriptionLength);
 
     return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK;
 }
 
-SerializableAuthenticationOperationResult InitializationAuthenticationFile::serializeJSON(
-    std::string &data)
+SerializableAuthenticationOperationResult InitializationAuthenticationFile::serializeJSONFields(
+    AuthenticationJsonWriter &writer)
 {
-    SerializableAuthenticationOperationResult result = BaseAuthenticationFile::serializeJSON(data);
+    SerializableAuthenticationOperationResult result =
+        BaseAuthenticationFile::serializeJSONFields(writer);
     if (result != SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK)
     {
         return result;
     }
 
-    cJSON *root = cJSON_Parse(data.c_str());
-    if (root == nullptr)
-    {
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-
-    cJSON *operationAcceptanceStatusCodeJSON = cJSON_CreateNumber(
-        operationAcceptanceStatusCode);
-    if (operationAcceptanceStatusCodeJSON == NULL)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    cJSON_AddItemToObject(root, "operationAcceptanceStatusCode",
-                          operationAcceptanceStatusCodeJSON);
-
-    cJSON *cryptographicKeyLengthJSON = cJSON_CreateNumber(cryptographicKeyLength);
-    if (cryptographicKeyLengthJSON == NULL)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    cJSON_AddItemToObject(root, "cryptographicKeyLength", cryptographicKeyLengthJSON);
-
-    std::stringstream cryptographicKeyStream;
-    for (size_t i = 0; i < cryptographicKeyLength; i++)
-    {
-        cryptographicKeyStream << std::hex << std::setfill('0') << std::setw(2)
-                        << (int)cryptographicKey[i];
-    }
-    std::string cryptographicKeyString = cryptographicKeyStream.str();
-    cJSON *cryptographicKeyJSON = cJSON_CreateString(cryptographicKeyString.c_str());
-    if (cryptographicKeyJSON == NULL)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    cJSON_AddItemToObject(root, "cryptographicKey", cryptographicKeyJSON);
-
-    cJSON *statusDescriptionLengthJSON = cJSON_CreateNumber(
-        statusDescriptionLength);
-    if (statusDescriptionLengthJSON == NULL)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    cJSON_AddItemToObject(root, "statusDescriptionLength",
-                          statusDescriptionLengthJSON);
-
-    cJSON *statusDescriptionJSON = cJSON_CreateString(statusDescription);
-    if (statusDescriptionJSON == NULL)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    cJSON_AddItemToObject(root, "statusDescription", statusDescriptionJSON);
-
-    char *serializedJSON = cJSON_PrintUnformatted(root);
-    if (serializedJSON == NULL)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    data = std::string(serializedJSON);
-    free(serializedJSON);
-    cJSON_Delete(root);
-
+    Codec::Fields::toJSON(writer, *this);
     return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK;
 }
 
-SerializableAuthenticationOperationResult InitializationAuthenticationFile::deserializeJSON(
-    std::string &data)
+SerializableAuthenticationOperationResult InitializationAuthenticationFile::deserializeJSONFields(
+    const cJSON *root)
 {
-    SerializableAuthenticationOperationResult result = BaseAuthenticationFile::deserializeJSON(data);
+    SerializableAuthenticationOperationResult result =
+        BaseAuthenticationFile::deserializeJSONFields(root);
     if (result != SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK)
     {
         return result;
     }
 
-    cJSON *root = cJSON_Parse(data.c_str());
-    if (root == nullptr)
+    if (!Codec::Fields::fromJSON(root, *this))
     {
         return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
     }
 
-    cJSON *operationAcceptanceStatusCodeJSON = cJSON_GetObjectItem(root,
-                                                                   "operationAcceptanceStatusCode");
-    if (operationAcceptanceStatusCodeJSON == nullptr)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    operationAcceptanceStatusCode = operationAcceptanceStatusCodeJSON->valueint;
-
-    cJSON *cryptographicKeyLengthJSON = cJSON_GetObjectItem(root, "cryptographicKeyLength");
-    if (cryptographicKeyLengthJSON == nullptr)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    cryptographicKeyLength = cryptographicKeyLengthJSON->valueint;
-
-    cJSON *cryptographicKeyJSON = cJSON_GetObjectItem(root, "cryptographicKey");
-    if (cryptographicKeyJSON == nullptr)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    std::string cryptographicKeyString = std::string(cryptographicKeyJSON->valuestring);
-    if (cryptographicKeyString.length() != cryptographicKeyLength * 2)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    for (size_t i = 0; i < cryptographicKeyLength; i++)
-    {
-        std::string byteString = cryptographicKeyString.substr(i * 2, 2);
-        cryptographicKey[i] = (uint8_t)std::stoi(byteString, nullptr, 16);
-    }
-
-    cJSON *statusDescriptionLengthJSON = cJSON_GetObjectItem(root,
-                                                             "statusDescriptionLength");
-    if (statusDescriptionLengthJSON == nullptr)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    statusDescriptionLength = statusDescriptionLengthJSON->valueint;
-
-    cJSON *statusDescriptionJSON = cJSON_GetObjectItem(root,
-                                                       "statusDescription");
-    if (statusDescriptionJSON == nullptr)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    std::string statusDescription = statusDescriptionJSON->valuestring;
-    std::memcpy(this->statusDescription, statusDescription.c_str(),
-                statusDescriptionLength);
-    cJSON_Delete(root);
-
     return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK;
 }
 
@@ -332,11 +220,6 @@ FileAuthenticationOperationResult InitializationAuthenticationFile::getFileSize(
         return result;
     }
 
-    fileSize += sizeof(operationAcceptanceStatusCode);
-    fileSize += sizeof(cryptographicKeyLength);
-    fileSize += cryptographicKeyLength;
-    fileSize += sizeof(statusDescriptionLength);
-    fileSize += statusDescriptionLength;
-
+    fileSize += Codec::Fields::size(*this);
     return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
 }
\ No newline at end of file
@@ -1,13 +1,37 @@
 #include "LoadAuthenticationRequestFile.h"
+#include "AuthenticationFileCodec.h"
 #include <cstring>
 
+struct LoadAuthenticationRequestHeaderFile::Codec
+{
+    typedef LoadAuthenticationRequestHeaderFile Owner;
+
+    AUTHENTICATION_CODEC_FIELD(AuthenticationString8Encoding, headerFileName);
+    AUTHENTICATION_CODEC_FIELD(AuthenticationString8Encoding, loadPartNumberName);
+
+    typedef AuthenticationCodec<Owner,
+                                headerFileNameField,
+                                loadPartNumberNameField>
+        Fields;
+};
+
+struct LoadAuthenticationRequestFile::Codec
+{
+    typedef LoadAuthenticationRequestFile Owner;
+
+    AUTHENTICATION_CODEC_LIST(LoadAuthenticationRequestHeaderFile::Codec::Fields,
+                              LoadAuthenticationRequestHeaderFile,
+                              headerFiles, numberOfHeaderFiles);
+
+    typedef AuthenticationCodec<Owner, headerFilesField> Fields;
+};
+
 LoadAuthenticationRequestFile::LoadAuthenticationRequestFile(
     std::string fileName, std::string protocolVersion) : BaseAuthenticationFile(fileName, protocolVersion)
 {
     headerFiles = std::make_shared<std::vector<LoadAuthenticationRequestHeaderFile>>();
     headerFiles->clear();
-    numberOfHeaderFiles = 0;
-    fileLength += sizeof(numberOfHeaderFiles);
+    fileLength += Codec::Fields::size(*this);
 }
 
 LoadAuthenticationRequestFile::~LoadAuthenticationRequestFile()
@@ -32,7 +56,6 @@ LoadAuthenticationRequestFile::addHeaderFile(
     }
 
     headerFiles->push_back(headerFile);
-    numberOfHeaderFiles++;
 
     size_t headerFileSize = 0;
     headerFile.getFileSize(headerFileSize);
@@ -49,40 +72,35 @@ LoadAuthenticationRequestFile::getHeaderFiles(
 }
 
 SerializableAuthenticationOperationResult
-LoadAuthenticationRequestFile::serialize(
-    std::shared_ptr<std::vector<uint8_t>> &data)
+LoadAuthenticationRequestFile::serializeInto(
+    uint8_t *buffer, size_t capacity, size_t &written)
 {
-    SerializableAuthenticationOperationResult result = BaseAuthenticationFile::serialize(data);
+    SerializableAuthenticationOperationResult result =
+        BaseAuthenticationFile::serializeInto(buffer, capacity, written);
     if (result != SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK)
     {
         return result;
     }
 
-    uint16_t numberOfHeaderFiles = headerFiles->size();
-    data->push_back((numberOfHeaderFiles >> 8) & 0xFF);
-    data->push_back(numberOfHeaderFiles & 0xFF);
+    AuthenticationBufferWriter writer(buffer, capacity);
+    writer.advance(written);
+    written = 0;
 
-    for (std::vector<LoadAuthenticationRequestHeaderFile>::iterator it =
-             headerFiles->begin();
-         it != headerFiles->end(); ++it)
+    if (!Codec::Fields::encode(writer, *this))
     {
-        std::shared_ptr<std::vector<uint8_t>> headerFileData = std::make_shared<std::vector<uint8_t>>();
-        result = it->serialize(headerFileData);
-        if (result != SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK)
-        {
-            return result;
-        }
-        data->insert(data->end(), headerFileData->begin(), headerFileData->end());
+        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
     }
 
+    written = writer.getWritten();
     return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK;
 }
 
 SerializableAuthenticationOperationResult
-LoadAuthenticationRequestFile::deserialize(
-    std::shared_ptr<std::vector<uint8_t>> &data)
+LoadAuthenticationRequestFile::deserializeFrom(
+    const uint8_t *data, size_t dataSize)
 {
-    SerializableAuthenticationOperationResult result = BaseAuthenticationFile::deserialize(data);
+    SerializableAuthenticationOperationResult result =
+        BaseAuthenticationFile::deserializeFrom(data, dataSize);
     if (result != SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK)
     {
         return result;
@@ -90,186 +108,47 @@ LoadAuthenticationRequestFile::deserialize(
 
     size_t parentSize = 0;
     BaseAuthenticationFile::getFileSize(parentSize);
-    size_t offset = parentSize;
-
-    if (data->size() < offset + sizeof(numberOfHeaderFiles))
-    {
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
+    AuthenticationBufferReader reader(data, dataSize, parentSize);
 
-    numberOfHeaderFiles = (data->at(offset) << 8) | data->at(offset + 1);
-    offset += sizeof(numberOfHeaderFiles);
-
-    if ((data->size() - offset) <= 0)
+    if (!Codec::Fields::decode(reader, *this))
     {
         return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
     }
 
-    for (uint16_t i = 0; i < numberOfHeaderFiles; i++)
-    {
-        std::vector<uint8_t> headerFileData(data->begin() + offset, data->end());
-        std::shared_ptr<std::vector<uint8_t>> headerFileDataPtr =
-            std::make_shared<std::vector<uint8_t>>(headerFileData);
-        LoadAuthenticationRequestHeaderFile headerFile;
-        result = headerFile.deserialize(headerFileDataPtr);
-        if (result != SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK)
-        {
-            return result;
-        }
-
-        std::string headerFileName;
-        std::string loadPartNumberName;
-        headerFile.getHeaderFileName(headerFileName);
-        headerFile.getLoadPartNumberName(loadPartNumberName);
-        headerFiles->emplace_back();
-        headerFiles->back().setHeaderFileName(headerFileName);
-        headerFiles->back().setLoadPartNumberName(loadPartNumberName);
-
-        uint8_t headerFileNameLength;
-        uint8_t loadPartNumberNameLength;
-        headerFile.getHeaderFileNameLength(headerFileNameLength);
-        headerFile.getLoadPartNumberNameLength(loadPartNumberNameLength);
-
-        size_t childSize = 0;
-        headerFile.getFileSize(childSize);
-        offset += childSize;
-    }
-
     return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK;
 }
 
 SerializableAuthenticationOperationResult
-LoadAuthenticationRequestFile::serializeJSON(std::string &data)
+LoadAuthenticationRequestFile::serializeJSONFields(
+    AuthenticationJsonWriter &writer)
 {
-    SerializableAuthenticationOperationResult result = BaseAuthenticationFile::serializeJSON(data);
+    SerializableAuthenticationOperationResult result =
+        BaseAuthenticationFile::serializeJSONFields(writer);
     if (result != SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK)
     {
         return result;
     }
 
-    cJSON *root = cJSON_Parse(data.c_str());
-    if (root == nullptr)
-    {
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-
-    cJSON *numberOfHeaderFilesJSON = cJSON_CreateNumber(numberOfHeaderFiles);
-    if (numberOfHeaderFilesJSON == nullptr)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    cJSON_AddItemToObject(root, "numberOfHeaderFiles", numberOfHeaderFilesJSON);
-
-    cJSON *headerFilesJSON = cJSON_CreateArray();
-    if (headerFilesJSON == nullptr)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    cJSON_AddItemToObject(root, "headerFiles", headerFilesJSON);
-
-    for (std::vector<LoadAuthenticationRequestHeaderFile>::iterator it =
-             headerFiles->begin();
-         it != headerFiles->end(); ++it)
-    {
-        std::string headerFileData;
-        result = it->serializeJSON(headerFileData);
-        if (result != SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK)
-        {
-            cJSON_Delete(root);
-            return result;
-        }
-        cJSON *headerFileJSON = cJSON_Parse(headerFileData.c_str());
-        if (headerFileJSON == nullptr)
-        {
-            cJSON_Delete(root);
-            return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-        }
-        cJSON_AddItemToArray(headerFilesJSON, headerFileJSON);
-    }
-
-    char *serializedData = cJSON_PrintUnformatted(root);
-    if (serializedData == nullptr)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    data = std::string(serializedData);
-    free(serializedData);
-    cJSON_Delete(root);
-
+    Codec::Fields::toJSON(writer, *this);
     return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK;
 }
 
 SerializableAuthenticationOperationResult
-LoadAuthenticationRequestFile::deserializeJSON(std::string &data)
+LoadAuthenticationRequestFile::deserializeJSONFields(
+    const cJSON *root)
 {
-    SerializableAuthenticationOperationResult result = BaseAuthenticationFile::deserializeJSON(data);
+    SerializableAuthenticationOperationResult result =
+        BaseAuthenticationFile::deserializeJSONFields(root);
     if (result != SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK)
     {
         return result;
     }
 
-    cJSON *root = cJSON_Parse(data.c_str());
-    if (root == nullptr)
+    if (!Codec::Fields::fromJSON(root, *this))
     {
         return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
     }
 
-    cJSON *numberOfHeaderFilesJSON = cJSON_GetObjectItem(root, "numberOfHeaderFiles");
-    if (numberOfHeaderFilesJSON == nullptr)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    numberOfHeaderFiles = numberOfHeaderFilesJSON->valueint;
-
-    cJSON *headerFilesJSON = cJSON_GetObjectItem(root, "headerFiles");
-    if (headerFilesJSON == nullptr)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    int headerArraySize = cJSON_GetArraySize(headerFilesJSON);
-    if (headerArraySize != numberOfHeaderFiles)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    for (int i = 0; i < numberOfHeaderFiles; i++)
-    {
-        cJSON *headerFileJSON = cJSON_GetArrayItem(headerFilesJSON, i);
-        if (headerFileJSON == nullptr)
-        {
-            cJSON_Delete(root);
-            return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-        }
-        char *headerFileData = cJSON_PrintUnformatted(headerFileJSON);
-        if (headerFileData == nullptr)
-        {
-            cJSON_Delete(root);
-            return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-        }
-        std::string data = std::string(headerFileData);
-        LoadAuthenticationRequestHeaderFile headerFile;
-        result = headerFile.deserializeJSON(data);
-        free(headerFileData);
-        if (result != SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK)
-        {
-            cJSON_Delete(root);
-            return result;
-        }
-        std::string headerFileName;
-        std::string loadPartNumberName;
-        headerFile.getHeaderFileName(headerFileName);
-        headerFile.getLoadPartNumberName(loadPartNumberName);
-        headerFiles->emplace_back();
-        headerFiles->back().setHeaderFileName(headerFileName);
-        headerFiles->back().setLoadPartNumberName(loadPartNumberName);
-    }
-    cJSON_Delete(root);
-
     return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK;
 }
 
@@ -281,29 +160,12 @@ FileAuthenticationOperationResult LoadAuthenticationRequestFile::getFileSize(siz
         return result;
     }
 
-    fileSize += sizeof(numberOfHeaderFiles);
-    for (std::vector<LoadAuthenticationRequestHeaderFile>::iterator it =
-             headerFiles->begin();
-         it != headerFiles->end(); ++it)
-    {
-        size_t headerFileSize = 0;
-        result = (*it).getFileSize(headerFileSize);
-        if (result != FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK)
-        {
-            return result;
-        }
-        fileSize += headerFileSize;
-    }
-
+    fileSize += Codec::Fields::size(*this);
     return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
 }
 
 LoadAuthenticationRequestHeaderFile::LoadAuthenticationRequestHeaderFile()
 {
-    std::memset(headerFileName, 0, sizeof(headerFileName));
-    std::memset(loadPartNumberName, 0, sizeof(loadPartNumberName));
-    headerFileNameLength = 0;
-    loadPartNumberNameLength = 0;
 }
 
 LoadAuthenticationRequestHeaderFile::~LoadAuthenticationRequestHeaderFile()
@@ -318,10 +180,9 @@ FileAuthenticationOperationResult LoadAuthenticationRequestHeaderFile::setHeader
         return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_ERROR;
     }
 
-    headerFileNameLength = std::min(headerFileName.length() + 1,
-                                    MAX_HEADER_FILE_NAME_SIZE);
-    std::memcpy(this->headerFileName, headerFileName.c_str(),
-                headerFileNameLength);
+    size_t headerFileNameLength = std::min(headerFileName.length() + 1,
+                                           MAX_HEADER_FILE_NAME_SIZE);
+    this->headerFileName.assign(headerFileName.c_str(), headerFileNameLength);
     if (headerFileNameLength == MAX_HEADER_FILE_NAME_SIZE)
     {
         // If the string is too long, we need to add a null terminator to the end
@@ -334,7 +195,7 @@ FileAuthenticationOperationResult LoadAuthenticationRequestHeaderFile::setHeader
 FileAuthenticationOperationResult
 LoadAuthenticationRequestHeaderFile::getHeaderFileName(std::string &headerFileName)
 {
-    headerFileName = this->headerFileName;
+    headerFileName = std::string(this->headerFileName.c_str());
     return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
 }
 
@@ -346,10 +207,9 @@ FileAuthenticationOperationResult LoadAuthenticationRequestHeaderFile::setLoadPa
         return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_ERROR;
     }
 
-    loadPartNumberNameLength = std::min(loadPartNumberName.length() + 1,
-                                        MAX_LOAD_PART_NUMBER_NAME_SIZE);
-    std::memcpy(this->loadPartNumberName, loadPartNumberName.c_str(),
-                loadPartNumberNameLength);
+    size_t loadPartNumberNameLength = std::min(loadPartNumberName.length() + 1,
+                                               MAX_LOAD_PART_NUMBER_NAME_SIZE);
+    this->loadPartNumberName.assign(loadPartNumberName.c_str(), loadPartNumberNameLength);
     if (loadPartNumberNameLength == MAX_LOAD_PART_NUMBER_NAME_SIZE)
     {
         // If the string is too long, we need to add a null terminator to the end
@@ -362,7 +222,7 @@ FileAuthenticationOperationResult LoadAuthenticationRequestHeaderFile::setLoadPa
 FileAuthenticationOperationResult
 LoadAuthenticationRequestHeaderFile::getLoadPartNumberName(std::string &loadPartNumberName)
 {
-    loadPartNumberName = this->loadPartNumberName;
+    loadPartNumberName = std::string(this->loadPartNumberName.c_str());
     return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
 }
 
@@ -370,7 +230,7 @@ FileAuthenticationOperationResult
 LoadAuthenticationRequestHeaderFile::getHeaderFileNameLength(
     uint8_t &headerFileNameLength)
 {
-    headerFileNameLength = this->headerFileNameLength;
+    headerFileNameLength = this->headerFileName.size();
     return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
 }
 
@@ -378,7 +238,7 @@ FileAuthenticationOperationResult
 LoadAuthenticationRequestHeaderFile::getLoadPartNumberNameLength(
     uint8_t &loadPartNumberNameLength)
 {
-    loadPartNumberNameLength = this->loadPartNumberNameLength;
+    loadPartNumberNameLength = this->loadPartNumberName.size();
     return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
 }
 
@@ -386,103 +246,83 @@ SerializableAuthenticationOperationResult
 LoadAuthenticationRequestHeaderFile::serialize(
     std::shared_ptr<std::vector<uint8_t>> &data)
 {
-    data->push_back(headerFileNameLength);
-    data->insert(data->end(), headerFileName,
-                 headerFileName + headerFileNameLength);
-    data->push_back(loadPartNumberNameLength);
-    data->insert(data->end(), loadPartNumberName,
-                 loadPartNumberName + loadPartNumberNameLength);
-    return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK;
-}
+    size_t fileSize = 0;
+    getFileSize(fileSize);
 
-SerializableAuthenticationOperationResult
-LoadAuthenticationRequestHeaderFile::deserialize(
-    std::shared_ptr<std::vector<uint8_t>> &data)
-{
-    size_t offset = 0;
+    size_t offset = data->size();
+    data->resize(offset + fileSize);
 
-    if (data->size() < offset + sizeof(headerFileNameLength))
-    {
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-
-    headerFileNameLength = data->at(offset);
-    offset += sizeof(headerFileNameLength);
-
-    if (data->size() < offset + headerFileNameLength)
+    size_t written = 0;
+    SerializableAuthenticationOperationResult result =
+        serializeInto(data->data() + offset, fileSize, written);
+    if (result != SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK)
     {
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
+        data->resize(offset);
+        return result;
     }
-    std::memcpy(headerFileName, data->data() + offset, headerFileNameLength);
-    offset += headerFileNameLength;
+    data->resize(offset + written);
 
-    if (data->size() < offset + sizeof(loadPartNumberNameLength))
-    {
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
+    return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK;
+}
 
-    loadPartNumberNameLength = data->at(offset);
-    offset += sizeof(loadPartNumberNameLength);
+SerializableAuthenticationOperationResult
+LoadAuthenticationRequestHeaderFile::serializeInto(
+    uint8_t *buffer, size_t capacity, size_t &written)
+{
+    AuthenticationBufferWriter writer(buffer, capacity);
+    written = 0;
 
-    if (data->size() < offset + loadPartNumberNameLength)
+    if (!Codec::Fields::encode(writer, *this))
     {
         return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
     }
 
-    std::memcpy(loadPartNumberName, data->data() + offset, loadPartNumberNameLength);
+    written = writer.getWritten();
     return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK;
 }
 
 SerializableAuthenticationOperationResult
-LoadAuthenticationRequestHeaderFile::serializeJSON(std::string &data)
+LoadAuthenticationRequestHeaderFile::deserialize(
+    std::shared_ptr<std::vector<uint8_t>> &data)
 {
-    cJSON *root = cJSON_CreateObject();
-    if (root == NULL)
-    {
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
+    return deserializeFrom(data->data(), data->size());
+}
 
-    cJSON *headerFileNameLengthJSON = cJSON_CreateNumber(headerFileNameLength);
-    if (headerFileNameLengthJSON == NULL)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    cJSON_AddItemToObject(root, "headerFileNameLength", headerFileNameLengthJSON);
+SerializableAuthenticationOperationResult
+LoadAuthenticationRequestHeaderFile::deserializeFrom(const uint8_t *data, size_t dataSize)
+{
+    size_t offset = 0;
+    return deserialize(data, dataSize, offset);
+}
 
-    cJSON *headerFileNameJSON = cJSON_CreateString(headerFileName);
-    if (headerFileNameJSON == NULL)
+SerializableAuthenticationOperationResult
+LoadAuthenticationRequestHeaderFile::deserialize(
+    const uint8_t *data, size_t dataSize, size_t &offset)
+{
+    AuthenticationBufferReader reader(data, dataSize, offset);
+    if (!Codec::Fields::decode(reader, *this))
     {
-        cJSON_Delete(root);
         return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
     }
-    cJSON_AddItemToObject(root, "headerFileName", headerFileNameJSON);
 
-    cJSON *loadPartNumberNameLengthJSON = cJSON_CreateNumber(loadPartNumberNameLength);
-    if (loadPartNumberNameLengthJSON == NULL)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    cJSON_AddItemToObject(root, "loadPartNumberNameLength", loadPartNumberNameLengthJSON);
+    offset = reader.getOffset();
+    return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK;
+}
 
-    cJSON *loadPartNumberNameJSON = cJSON_CreateString(loadPartNumberName);
-    if (loadPartNumberNameJSON == NULL)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    cJSON_AddItemToObject(root, "loadPartNumberName", loadPartNumberNameJSON);
+SerializableAuthenticationOperationResult
+LoadAuthenticationRequestHeaderFile::serializeJSON(std::string &data)
+{
+    data.clear();
+    AuthenticationJsonWriter writer(data);
+    return serializeJSON(writer);
+}
 
-    char *serializedJSON = cJSON_PrintUnformatted(root);
-    if (serializedJSON == NULL)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    data = std::string(serializedJSON);
-    free(serializedJSON);
-    cJSON_Delete(root);
+SerializableAuthenticationOperationResult
+LoadAuthenticationRequestHeaderFile::serializeJSON(AuthenticationJsonWriter &writer)
+{
+    writer.beginObject();
+    Codec::Fields::toJSON(writer, *this);
+    writer.endObject();
     return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK;
 }
 
@@ -495,47 +335,25 @@ LoadAuthenticationRequestHeaderFile::deserializeJSON(std::string &data)
         return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
     }
 
-    cJSON *headerFileNameLengthJSON = cJSON_GetObjectItemCaseSensitive(root, "headerFileNameLength");
-    if (headerFileNameLengthJSON == NULL)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    headerFileNameLength = headerFileNameLengthJSON->valueint;
-
-    cJSON *headerFileNameJSON = cJSON_GetObjectItemCaseSensitive(root, "headerFileName");
-    if (headerFileNameJSON == NULL)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    std::memcpy(headerFileName, headerFileNameJSON->valuestring, headerFileNameLength);
-
-    cJSON *loadPartNumberNameLengthJSON = cJSON_GetObjectItemCaseSensitive(root, "loadPartNumberNameLength");
-    if (loadPartNumberNameLengthJSON == NULL)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    loadPartNumberNameLength = loadPartNumberNameLengthJSON->valueint;
+    SerializableAuthenticationOperationResult result = deserializeJSON(root);
+    cJSON_Delete(root);
+    return result;
+}
 
-    cJSON *loadPartNumberNameJSON = cJSON_GetObjectItemCaseSensitive(root, "loadPartNumberName");
-    if (loadPartNumberNameJSON == NULL)
+SerializableAuthenticationOperationResult
+LoadAuthenticationRequestHeaderFile::deserializeJSON(const cJSON *root)
+{
+    if (!Codec::Fields::fromJSON(root, *this))
     {
-        cJSON_Delete(root);
         return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
     }
-    std::memcpy(loadPartNumberName, loadPartNumberNameJSON->valuestring, loadPartNumberNameLength);
 
-    cJSON_Delete(root);
     return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK;
 }
 
 FileAuthenticationOperationResult LoadAuthenticationRequestHeaderFile::getFileSize(
     size_t &fileSize)
 {
-    fileSize = sizeof(headerFileNameLength) + headerFileNameLength +
-               sizeof(loadPartNumberNameLength) + loadPartNumberNameLength;
-
+    fileSize = Codec::Fields::size(*this);
     return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
 }
\ No newline at end of file
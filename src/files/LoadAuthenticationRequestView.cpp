@@ -0,0 +1,141 @@
+#include "LoadAuthenticationRequestView.h"
+#include "AuthenticationBufferReader.h"
+
+LoadAuthenticationRequestHeaderView::LoadAuthenticationRequestHeaderView()
+{
+}
+
+LoadAuthenticationRequestHeaderView::~LoadAuthenticationRequestHeaderView()
+{
+}
+
+FileAuthenticationOperationResult LoadAuthenticationRequestHeaderView::getHeaderFileName(
+    AuthenticationFieldView &headerFileName) const
+{
+    headerFileName = this->headerFileName;
+    return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
+}
+
+FileAuthenticationOperationResult LoadAuthenticationRequestHeaderView::getLoadPartNumberName(
+    AuthenticationFieldView &loadPartNumberName) const
+{
+    loadPartNumberName = this->loadPartNumberName;
+    return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
+}
+
+SerializableAuthenticationOperationResult LoadAuthenticationRequestHeaderView::parse(
+    const uint8_t *data, size_t dataSize, size_t &offset)
+{
+    AuthenticationBufferReader reader(data, dataSize, offset);
+
+    uint8_t headerFileNameLength = 0;
+    uint8_t loadPartNumberNameLength = 0;
+    if (!reader.getUint8(headerFileNameLength) ||
+        !reader.getField(headerFileNameLength, headerFileName) ||
+        !reader.getUint8(loadPartNumberNameLength) ||
+        !reader.getField(loadPartNumberNameLength, loadPartNumberName))
+    {
+        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
+    }
+
+    offset = reader.getOffset();
+    return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK;
+}
+
+LoadAuthenticationRequestView::LoadAuthenticationRequestView()
+{
+    valid = false;
+    data = nullptr;
+    fileLength = 0;
+    numberOfHeaderFiles = 0;
+    headerFilesOffset = 0;
+}
+
+LoadAuthenticationRequestView::~LoadAuthenticationRequestView()
+{
+}
+
+SerializableAuthenticationOperationResult LoadAuthenticationRequestView::parse(
+    const uint8_t *data, size_t dataSize)
+{
+    valid = false;
+
+    AuthenticationBufferReader reader(data, dataSize);
+    if (!reader.getUint32(fileLength) || fileLength > dataSize)
+    {
+        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
+    }
+
+    // From now on, nothing past the file length is part of the file
+    reader = AuthenticationBufferReader(data, fileLength, reader.getOffset());
+
+    if (!reader.getField(PROTOCOL_VERSION_SIZE, protocolVersion) ||
+        !reader.getUint16(numberOfHeaderFiles))
+    {
+        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
+    }
+
+    // Validate all header files once, so iterating them can not fail
+    headerFilesOffset = reader.getOffset();
+    size_t offset = headerFilesOffset;
+    for (uint16_t i = 0; i < numberOfHeaderFiles; i++)
+    {
+        LoadAuthenticationRequestHeaderView headerFile;
+        if (headerFile.parse(data, fileLength, offset) !=
+            SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK)
+        {
+            return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
+        }
+    }
+
+    this->data = data;
+    valid = true;
+    return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK;
+}
+
+FileAuthenticationOperationResult LoadAuthenticationRequestView::getFileLength(
+    uint32_t &fileLength) const
+{
+    if (!valid)
+    {
+        return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_ERROR;
+    }
+    fileLength = this->fileLength;
+    return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
+}
+
+FileAuthenticationOperationResult LoadAuthenticationRequestView::getProtocolVersion(
+    AuthenticationFieldView &protocolVersion) const
+{
+    if (!valid)
+    {
+        return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_ERROR;
+    }
+    protocolVersion = this->protocolVersion;
+    return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
+}
+
+FileAuthenticationOperationResult LoadAuthenticationRequestView::getNumberOfHeaderFiles(
+    uint16_t &numberOfHeaderFiles) const
+{
+    if (!valid)
+    {
+        return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_ERROR;
+    }
+    numberOfHeaderFiles = this->numberOfHeaderFiles;
+    return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
+}
+
+LoadAuthenticationRequestView::HeaderFileIterator LoadAuthenticationRequestView::begin() const
+{
+    if (!valid)
+    {
+        return end();
+    }
+    return HeaderFileIterator(data, fileLength, headerFilesOffset, numberOfHeaderFiles);
+}
+
+LoadAuthenticationRequestView::HeaderFileIterator LoadAuthenticationRequestView::end() const
+{
+    return HeaderFileIterator();
+}
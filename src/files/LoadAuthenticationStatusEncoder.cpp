@@ -0,0 +1,298 @@
+#include "LoadAuthenticationStatusEncoder.h"
+#include "AuthenticationBufferWriter.h"
+#include <algorithm>
+#include <cstring>
+
+// Fixed-width fields are found relative to these offsets in the encoded file
+#define STATUS_CODE_OFFSET (sizeof(uint32_t) + PROTOCOL_VERSION_SIZE)
+#define EXCEPTION_TIMER_OFFSET(counterOffset) ((counterOffset) + sizeof(uint16_t))
+#define ESTIMATED_TIME_OFFSET(counterOffset) ((counterOffset) + 2 * sizeof(uint16_t))
+#define LOAD_LIST_RATIO_OFFSET(counterOffset) ((counterOffset) + 3 * sizeof(uint16_t))
+#define HEADER_FILES_OFFSET(counterOffset) ((counterOffset) + 4 * sizeof(uint16_t) + 3)
+#define LOAD_STATUS_OFFSET(loadRatioOffset) ((loadRatioOffset) + 3)
+#define LOAD_STATUS_DESCRIPTION_OFFSET(loadRatioOffset) \
+    ((loadRatioOffset) + 3 + sizeof(uint16_t) + sizeof(uint8_t))
+
+LoadAuthenticationStatusEncoder::LoadAuthenticationStatusEncoder(std::string protocolVersion)
+{
+    std::memset(this->protocolVersion, 0, PROTOCOL_VERSION_SIZE);
+    size_t protocolVersionSize = std::min(protocolVersion.size(), PROTOCOL_VERSION_SIZE);
+    std::memcpy(this->protocolVersion, protocolVersion.c_str(), protocolVersionSize);
+
+    authenticationOperationStatusCode = 0;
+    counter = 0;
+    exceptionTimer = 0;
+    estimatedTime = 0;
+    loadListRatio = 0;
+    headerFiles = std::make_shared<std::vector<LoadAuthenticationStatusHeaderFile>>();
+
+    encoded = false;
+    counterOffset = 0;
+    numberOfFullEncodes = 0;
+}
+
+LoadAuthenticationStatusEncoder::~LoadAuthenticationStatusEncoder()
+{
+}
+
+FileAuthenticationOperationResult LoadAuthenticationStatusEncoder::setAuthenticationOperationStatusCode(
+    uint16_t authenticationOperationStatusCode)
+{
+    this->authenticationOperationStatusCode = authenticationOperationStatusCode;
+    patchUint16(STATUS_CODE_OFFSET, authenticationOperationStatusCode);
+    return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
+}
+
+FileAuthenticationOperationResult LoadAuthenticationStatusEncoder::setAuthenticationStatusDescription(
+    std::string authenticationStatusDescription)
+{
+    size_t authenticationStatusDescriptionLength =
+        std::min(authenticationStatusDescription.length() + 1,
+                 MAX_AUTHENTICATION_STATUS_DESCRIPTION_SIZE);
+    if (authenticationStatusDescriptionLength != this->authenticationStatusDescription.size())
+    {
+        encoded = false;
+    }
+
+    this->authenticationStatusDescription.assign(authenticationStatusDescription.c_str(),
+                                                 authenticationStatusDescriptionLength);
+    if (authenticationStatusDescriptionLength == MAX_AUTHENTICATION_STATUS_DESCRIPTION_SIZE)
+    {
+        // If the string is too long, we need to add a null terminator to the end
+        this->authenticationStatusDescription[authenticationStatusDescriptionLength - 1] = '\0';
+    }
+
+    if (encoded)
+    {
+        std::memcpy(image.data() + STATUS_CODE_OFFSET + sizeof(uint16_t) + sizeof(uint8_t),
+                    this->authenticationStatusDescription.data(),
+                    authenticationStatusDescriptionLength);
+    }
+    return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
+}
+
+FileAuthenticationOperationResult LoadAuthenticationStatusEncoder::clearAuthenticationStatusDescription()
+{
+    if (!authenticationStatusDescription.empty())
+    {
+        authenticationStatusDescription.clear();
+        encoded = false;
+    }
+    return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
+}
+
+FileAuthenticationOperationResult LoadAuthenticationStatusEncoder::setCounter(uint16_t counter)
+{
+    this->counter = counter;
+    patchUint16(counterOffset, counter);
+    return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
+}
+
+FileAuthenticationOperationResult LoadAuthenticationStatusEncoder::getCounter(uint16_t &counter)
+{
+    counter = this->counter;
+    return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
+}
+
+FileAuthenticationOperationResult LoadAuthenticationStatusEncoder::setExceptionTimer(
+    uint16_t exceptionTimer)
+{
+    this->exceptionTimer = exceptionTimer;
+    patchUint16(EXCEPTION_TIMER_OFFSET(counterOffset), exceptionTimer);
+    return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
+}
+
+FileAuthenticationOperationResult LoadAuthenticationStatusEncoder::setEstimatedTime(
+    uint16_t estimatedTime)
+{
+    this->estimatedTime = estimatedTime;
+    patchUint16(ESTIMATED_TIME_OFFSET(counterOffset), estimatedTime);
+    return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
+}
+
+FileAuthenticationOperationResult LoadAuthenticationStatusEncoder::setLoadListRatio(
+    uint32_t loadListRatio)
+{
+    this->loadListRatio = loadListRatio;
+    patchUint24(LOAD_LIST_RATIO_OFFSET(counterOffset), loadListRatio);
+    return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
+}
+
+FileAuthenticationOperationResult LoadAuthenticationStatusEncoder::setHeaderFiles(
+    std::shared_ptr<std::vector<LoadAuthenticationStatusHeaderFile>> &headerFiles)
+{
+    if (headerFiles == nullptr)
+    {
+        return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_ERROR;
+    }
+    this->headerFiles = headerFiles;
+    encoded = false;
+    return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
+}
+
+FileAuthenticationOperationResult LoadAuthenticationStatusEncoder::setHeaderFileLoadRatio(
+    size_t index, uint32_t loadRatio)
+{
+    if (index >= headerFiles->size())
+    {
+        return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_ERROR;
+    }
+    headerFiles->at(index).setLoadRatio(loadRatio);
+    if (encoded)
+    {
+        patchUint24(headerFileOffsets[index], loadRatio);
+    }
+    return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
+}
+
+FileAuthenticationOperationResult LoadAuthenticationStatusEncoder::setHeaderFileLoadStatus(
+    size_t index, uint16_t loadStatus)
+{
+    if (index >= headerFiles->size())
+    {
+        return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_ERROR;
+    }
+    headerFiles->at(index).setLoadStatus(loadStatus);
+    if (encoded)
+    {
+        patchUint16(LOAD_STATUS_OFFSET(headerFileOffsets[index]), loadStatus);
+    }
+    return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
+}
+
+FileAuthenticationOperationResult LoadAuthenticationStatusEncoder::setHeaderFileLoadStatusDescription(
+    size_t index, std::string loadStatusDescription)
+{
+    if (index >= headerFiles->size())
+    {
+        return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_ERROR;
+    }
+
+    LoadAuthenticationStatusHeaderFile &headerFile = headerFiles->at(index);
+    uint8_t previousLength = 0;
+    headerFile.getLoadStatusDescriptionLength(previousLength);
+    headerFile.setLoadStatusDescription(loadStatusDescription);
+    uint8_t loadStatusDescriptionLength = 0;
+    headerFile.getLoadStatusDescriptionLength(loadStatusDescriptionLength);
+
+    if (loadStatusDescriptionLength != previousLength)
+    {
+        // Everything after this header file moves
+        encoded = false;
+    }
+    else if (encoded)
+    {
+        // Same length: overwrite the text, null terminator included
+        size_t descriptionLength = std::min(loadStatusDescription.length(),
+                                            static_cast<size_t>(loadStatusDescriptionLength - 1));
+        uint8_t *description = image.data() + LOAD_STATUS_DESCRIPTION_OFFSET(headerFileOffsets[index]);
+        std::memcpy(description, loadStatusDescription.c_str(), descriptionLength);
+        std::memset(description + descriptionLength, 0, loadStatusDescriptionLength - descriptionLength);
+    }
+    return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
+}
+
+SerializableAuthenticationOperationResult LoadAuthenticationStatusEncoder::encode(
+    uint8_t *&data, size_t &size)
+{
+    if (!encoded)
+    {
+        SerializableAuthenticationOperationResult result = encodeAll();
+        if (result != SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK)
+        {
+            return result;
+        }
+    }
+
+    data = image.data();
+    size = image.size();
+    return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK;
+}
+
+uint32_t LoadAuthenticationStatusEncoder::getNumberOfFullEncodes()
+{
+    return numberOfFullEncodes;
+}
+
+SerializableAuthenticationOperationResult LoadAuthenticationStatusEncoder::encodeAll()
+{
+    if (headerFiles->size() > UINT16_MAX)
+    {
+        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
+    }
+
+    counterOffset = STATUS_CODE_OFFSET + sizeof(uint16_t) + sizeof(uint8_t) +
+                    authenticationStatusDescription.size();
+    size_t fileSize = HEADER_FILES_OFFSET(counterOffset);
+    headerFileOffsets.resize(headerFiles->size());
+    for (size_t i = 0; i < headerFiles->size(); i++)
+    {
+        uint8_t headerFileNameLength = 0;
+        uint8_t loadPartNumberNameLength = 0;
+        headerFiles->at(i).getHeaderFileNameLength(headerFileNameLength);
+        headerFiles->at(i).getLoadPartNumberNameLength(loadPartNumberNameLength);
+        headerFileOffsets[i] = fileSize + sizeof(uint8_t) + headerFileNameLength +
+                               sizeof(uint8_t) + loadPartNumberNameLength;
+
+        size_t headerFileSize = 0;
+        headerFiles->at(i).getFileSize(headerFileSize);
+        fileSize += headerFileSize;
+    }
+    if (fileSize > UINT32_MAX)
+    {
+        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
+    }
+
+    image.resize(fileSize);
+    AuthenticationBufferWriter writer(image.data(), image.size());
+    if (!writer.putUint32(fileSize) ||
+        !writer.putBytes(protocolVersion, PROTOCOL_VERSION_SIZE) ||
+        !writer.putUint16(authenticationOperationStatusCode) ||
+        !writer.putUint8(authenticationStatusDescription.size()) ||
+        !writer.putBytes(authenticationStatusDescription.data(),
+                         authenticationStatusDescription.size()) ||
+        !writer.putUint16(counter) ||
+        !writer.putUint16(exceptionTimer) ||
+        !writer.putUint16(estimatedTime) ||
+        !writer.putUint24(loadListRatio) ||
+        !writer.putUint16(headerFiles->size()))
+    {
+        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
+    }
+
+    for (std::vector<LoadAuthenticationStatusHeaderFile>::iterator it = headerFiles->begin();
+         it != headerFiles->end(); ++it)
+    {
+        size_t headerFileWritten = 0;
+        SerializableAuthenticationOperationResult result =
+            it->serializeInto(writer.getCursor(), writer.getRemaining(), headerFileWritten);
+        if (result != SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK)
+        {
+            return result;
+        }
+        writer.advance(headerFileWritten);
+    }
+
+    encoded = true;
+    numberOfFullEncodes++;
+    return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK;
+}
+
+void LoadAuthenticationStatusEncoder::patchUint16(size_t offset, uint16_t value)
+{
+    if (encoded)
+    {
+        image[offset] = value >> 8;
+        image[offset + 1] = value;
+    }
+}
+
+void LoadAuthenticationStatusEncoder::patchUint24(size_t offset, uint32_t value)
+{
+    if (encoded)
+    {
+        image[offset] = value >> 16;
+        image[offset + 1] = value >> 8;
+        image[offset + 2] = value;
+    }
+}
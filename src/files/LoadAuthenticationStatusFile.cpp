@@ -1,26 +1,62 @@
 #include "LoadAuthenticationStatusFile.h"
+#include "AuthenticationFileCodec.h"
 #include <cstring>
 
+struct LoadAuthenticationStatusHeaderFile::Codec
+{
+    typedef LoadAuthenticationStatusHeaderFile Owner;
+
+    AUTHENTICATION_CODEC_FIELD(AuthenticationString8Encoding, headerFileName);
+    AUTHENTICATION_CODEC_FIELD(AuthenticationString8Encoding, loadPartNumberName);
+    AUTHENTICATION_CODEC_FIELD(AuthenticationUint24Encoding, loadRatio);
+    AUTHENTICATION_CODEC_FIELD(AuthenticationUint16Encoding, loadStatus);
+    AUTHENTICATION_CODEC_FIELD(AuthenticationString8Encoding, loadStatusDescription);
+
+    typedef AuthenticationCodec<Owner,
+                                headerFileNameField,
+                                loadPartNumberNameField,
+                                loadRatioField,
+                                loadStatusField,
+                                loadStatusDescriptionField>
+        Fields;
+};
+
+struct LoadAuthenticationStatusFile::Codec
+{
+    typedef LoadAuthenticationStatusFile Owner;
+
+    AUTHENTICATION_CODEC_FIELD(AuthenticationUint16Encoding, authenticationOperationStatusCode);
+    AUTHENTICATION_CODEC_FIELD(AuthenticationString8Encoding, authenticationStatusDescription);
+    AUTHENTICATION_CODEC_FIELD(AuthenticationUint16Encoding, counter);
+    AUTHENTICATION_CODEC_FIELD(AuthenticationUint16Encoding, exceptionTimer);
+    AUTHENTICATION_CODEC_FIELD(AuthenticationUint16Encoding, estimatedTime);
+    AUTHENTICATION_CODEC_FIELD(AuthenticationUint24Encoding, loadListRatio);
+    AUTHENTICATION_CODEC_LIST(LoadAuthenticationStatusHeaderFile::Codec::Fields,
+                              LoadAuthenticationStatusHeaderFile,
+                              headerFiles, numberOfHeaderFiles);
+
+    typedef AuthenticationCodec<Owner,
+                                authenticationOperationStatusCodeField,
+                                authenticationStatusDescriptionField,
+                                counterField,
+                                exceptionTimerField,
+                                estimatedTimeField,
+                                loadListRatioField,
+                                headerFilesField>
+        Fields;
+};
+
 LoadAuthenticationStatusFile::LoadAuthenticationStatusFile(
     std::string fileName, std::string protocolVersion) : BaseAuthenticationFile(fileName, protocolVersion)
 {
-    std::memset(&authenticationStatusDescription, 0, MAX_AUTHENTICATION_STATUS_DESCRIPTION_SIZE);
     headerFiles = std::make_shared<std::vector<LoadAuthenticationStatusHeaderFile>>();
     headerFiles->clear();
     counter = 0;
     authenticationOperationStatusCode = 0;
-    authenticationStatusDescriptionLength = 0;
     exceptionTimer = 0;
     estimatedTime = 0;
     loadListRatio = 0;
-    numberOfHeaderFiles = 0;
-    fileLength += sizeof(authenticationOperationStatusCode) +
-                  sizeof(authenticationStatusDescriptionLength) +
-                  sizeof(counter) +
-                  sizeof(exceptionTimer) +
-                  sizeof(estimatedTime) +
-                  sizeof(loadListRatio) - sizeof(uint8_t) +
-                  sizeof(numberOfHeaderFiles);
+    fileLength += Codec::Fields::size(*this);
 }
 
 LoadAuthenticationStatusFile::~LoadAuthenticationStatusFile()
@@ -44,31 +80,32 @@ FileAuthenticationOperationResult LoadAuthenticationStatusFile::getAuthenticatio
 FileAuthenticationOperationResult LoadAuthenticationStatusFile::setAuthenticationStatusDescription(
     std::string authenticationStatusDescription)
 {
-    fileLength -= authenticationStatusDescriptionLength;
-    authenticationStatusDescriptionLength = std::min(authenticationStatusDescription.length() + 1,
-                                                     MAX_AUTHENTICATION_STATUS_DESCRIPTION_SIZE);
-    std::memcpy(this->authenticationStatusDescription, authenticationStatusDescription.c_str(),
-                authenticationStatusDescriptionLength);
+    fileLength -= this->authenticationStatusDescription.size();
+    size_t authenticationStatusDescriptionLength =
+        std::min(authenticationStatusDescription.length() + 1,
+                 MAX_AUTHENTICATION_STATUS_DESCRIPTION_SIZE);
+    this->authenticationStatusDescription.assign(authenticationStatusDescription.c_str(),
+                                                 authenticationStatusDescriptionLength);
     if (authenticationStatusDescriptionLength == MAX_AUTHENTICATION_STATUS_DESCRIPTION_SIZE)
     {
         // If the string is too long, we need to add a null terminator to the end
         this->authenticationStatusDescription[authenticationStatusDescriptionLength - 1] = '\0';
     }
-    fileLength += authenticationStatusDescriptionLength;
+    fileLength += this->authenticationStatusDescription.size();
     return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
 }
 
 FileAuthenticationOperationResult LoadAuthenticationStatusFile::getAuthenticationStatusDescription(
     std::string &authenticationStatusDescription)
 {
-    authenticationStatusDescription = std::string(this->authenticationStatusDescription);
+    authenticationStatusDescription = std::string(this->authenticationStatusDescription.c_str());
     return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
 }
 
 FileAuthenticationOperationResult LoadAuthenticationStatusFile::getAuthenticationStatusDescriptionLength(
     uint8_t &authenticationStatusDescriptionLength)
 {
-    authenticationStatusDescriptionLength = this->authenticationStatusDescriptionLength;
+    authenticationStatusDescriptionLength = this->authenticationStatusDescription.size();
     return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
 }
 
@@ -141,7 +178,6 @@ LoadAuthenticationStatusFile::addHeaderFile(
     }
 
     headerFiles->push_back(headerFile);
-    numberOfHeaderFiles++;
 
     size_t headerFileSize = 0;
     headerFile.getFileSize(headerFileSize);
@@ -157,58 +193,34 @@ LoadAuthenticationStatusFile::getHeaderFiles(
     return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
 }
 
-SerializableAuthenticationOperationResult LoadAuthenticationStatusFile::serialize(
-    std::shared_ptr<std::vector<uint8_t>> &data)
+SerializableAuthenticationOperationResult LoadAuthenticationStatusFile::serializeInto(
+    uint8_t *buffer, size_t capacity, size_t &written)
 {
-    SerializableAuthenticationOperationResult result = BaseAuthenticationFile::serialize(data);
+    SerializableAuthenticationOperationResult result =
+        BaseAuthenticationFile::serializeInto(buffer, capacity, written);
     if (result != SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK)
     {
         return result;
     }
 
-    data->push_back((authenticationOperationStatusCode >> 8) & 0xFF);
-    data->push_back(authenticationOperationStatusCode & 0xFF);
-
-    data->push_back(authenticationStatusDescriptionLength);
-    data->insert(data->end(), authenticationStatusDescription,
-                 authenticationStatusDescription + authenticationStatusDescriptionLength);
-
-    data->push_back((counter >> 8) & 0xFF);
-    data->push_back(counter & 0xFF);
-
-    data->push_back((exceptionTimer >> 8) & 0xFF);
-    data->push_back(exceptionTimer & 0xFF);
+    AuthenticationBufferWriter writer(buffer, capacity);
+    writer.advance(written);
+    written = 0;
 
-    data->push_back((estimatedTime >> 8) & 0xFF);
-    data->push_back(estimatedTime & 0xFF);
-
-    data->push_back((loadListRatio >> 16) & 0xFF);
-    data->push_back((loadListRatio >> 8) & 0xFF);
-    data->push_back(loadListRatio & 0xFF);
-
-    data->push_back((numberOfHeaderFiles >> 8) & 0xFF);
-    data->push_back(numberOfHeaderFiles & 0xFF);
-
-    for (std::vector<LoadAuthenticationStatusHeaderFile>::iterator it =
-             headerFiles->begin();
-         it != headerFiles->end(); ++it)
+    if (!Codec::Fields::encode(writer, *this))
     {
-        std::shared_ptr<std::vector<uint8_t>> headerFileData = std::make_shared<std::vector<uint8_t>>();
-        result = it->serialize(headerFileData);
-        if (result != SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK)
-        {
-            return result;
-        }
-        data->insert(data->end(), headerFileData->begin(), headerFileData->end());
+        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
     }
 
+    written = writer.getWritten();
     return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK;
 }
 
-SerializableAuthenticationOperationResult LoadAuthenticationStatusFile::deserialize(
-    std::shared_ptr<std::vector<uint8_t>> &data)
+SerializableAuthenticationOperationResult LoadAuthenticationStatusFile::deserializeFrom(
+    const uint8_t *data, size_t dataSize)
 {
-    SerializableAuthenticationOperationResult result = BaseAuthenticationFile::deserialize(data);
+    SerializableAuthenticationOperationResult result =
+        BaseAuthenticationFile::deserializeFrom(data, dataSize);
     if (result != SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK)
     {
         return result;
@@ -216,347 +228,45 @@ SerializableAuthenticationOperationResult LoadAuthenticationStatusFile::deserial
 
     size_t parentSize = 0;
     BaseAuthenticationFile::getFileSize(parentSize);
-    size_t offset = parentSize;
-
-    if (data->size() < offset + sizeof(authenticationOperationStatusCode))
-    {
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    authenticationOperationStatusCode = (data->at(offset) << 8) | data->at(offset + 1);
-    offset += sizeof(authenticationOperationStatusCode);
-
-    if (data->size() < offset + sizeof(authenticationStatusDescriptionLength))
-    {
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    authenticationStatusDescriptionLength = data->at(offset);
-    offset += sizeof(authenticationStatusDescriptionLength);
-
-    if (data->size() < offset + authenticationStatusDescriptionLength)
-    {
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    std::memcpy(authenticationStatusDescription, data->data() + offset,
-                authenticationStatusDescriptionLength);
-    offset += authenticationStatusDescriptionLength;
-
-    if (data->size() < offset + sizeof(counter))
-    {
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    counter = (data->at(offset) << 8) | data->at(offset + 1);
-    offset += sizeof(counter);
-
-    if (data->size() < offset + sizeof(exceptionTimer))
-    {
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    exceptionTimer = (data->at(offset) << 8) | data->at(offset + 1);
-    offset += sizeof(exceptionTimer);
-
-    if (data->size() < offset + sizeof(estimatedTime))
-    {
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    estimatedTime = (data->at(offset) << 8) | data->at(offset + 1);
-    offset += sizeof(estimatedTime);
-
-    if (data->size() < offset + sizeof(loadListRatio) - sizeof(uint8_t))
-    {
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    loadListRatio = (data->at(offset) << 16) | (data->at(offset + 1) << 8) | data->at(offset + 2);
-    offset += sizeof(loadListRatio) - sizeof(uint8_t);
-
-    if (data->size() < offset + sizeof(numberOfHeaderFiles))
-    {
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    numberOfHeaderFiles = (data->at(offset) << 8) | data->at(offset + 1);
-    offset += sizeof(numberOfHeaderFiles);
+    AuthenticationBufferReader reader(data, dataSize, parentSize);
 
-    if ((data->size() - offset) <= 0)
+    if (!Codec::Fields::decode(reader, *this))
     {
         return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
     }
 
-    for (int i = 0; i < numberOfHeaderFiles; i++)
-    {
-        std::vector<uint8_t> headerFileData(data->begin() + offset, data->end());
-        std::shared_ptr<std::vector<uint8_t>> headerFileDataPtr =
-            std::make_shared<std::vector<uint8_t>>(headerFileData);
-        LoadAuthenticationStatusHeaderFile headerFile;
-        result = headerFile.deserialize(headerFileDataPtr);
-        if (result != SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK)
-        {
-            return result;
-        }
-
-        headerFiles->push_back(headerFile);
-
-        size_t childSize = 0;
-        headerFile.getFileSize(childSize);
-        offset += childSize;
-    }
-
     return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK;
 }
 
-SerializableAuthenticationOperationResult LoadAuthenticationStatusFile::serializeJSON(
-    std::string &data)
+SerializableAuthenticationOperationResult LoadAuthenticationStatusFile::serializeJSONFields(
+    AuthenticationJsonWriter &writer)
 {
-    SerializableAuthenticationOperationResult result = BaseAuthenticationFile::serializeJSON(data);
+    SerializableAuthenticationOperationResult result =
+        BaseAuthenticationFile::serializeJSONFields(writer);
     if (result != SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK)
     {
         return result;
     }
 
-    cJSON *root = cJSON_Parse(data.c_str());
-    if (root == nullptr)
-    {
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-
-    cJSON *authenticationOperationStatusCodeJSON = cJSON_CreateNumber(authenticationOperationStatusCode);
-    if (authenticationOperationStatusCodeJSON == nullptr)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    cJSON_AddItemToObject(root, "authenticationOperationStatusCode", authenticationOperationStatusCodeJSON);
-
-    cJSON *authenticationStatusDescriptionLengthJSON = cJSON_CreateNumber(authenticationStatusDescriptionLength);
-    if (authenticationStatusDescriptionLengthJSON == nullptr)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    cJSON_AddItemToObject(root, "authenticationStatusDescriptionLength", authenticationStatusDescriptionLengthJSON);
-
-    cJSON *authenticationStatusDescriptionJSON = cJSON_CreateString(authenticationStatusDescription);
-    if (authenticationStatusDescriptionJSON == nullptr)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    cJSON_AddItemToObject(root, "authenticationStatusDescription", authenticationStatusDescriptionJSON);
-
-    cJSON *counterJSON = cJSON_CreateNumber(counter);
-    if (counterJSON == nullptr)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    cJSON_AddItemToObject(root, "counter", counterJSON);
-
-    cJSON *exceptionTimerJSON = cJSON_CreateNumber(exceptionTimer);
-    if (exceptionTimerJSON == nullptr)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    cJSON_AddItemToObject(root, "exceptionTimer", exceptionTimerJSON);
-
-    cJSON *estimatedTimeJSON = cJSON_CreateNumber(estimatedTime);
-    if (estimatedTimeJSON == nullptr)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    cJSON_AddItemToObject(root, "estimatedTime", estimatedTimeJSON);
-
-    cJSON *loadListRatioJSON = cJSON_CreateNumber(loadListRatio);
-    if (loadListRatioJSON == nullptr)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    cJSON_AddItemToObject(root, "loadListRatio", loadListRatioJSON);
-
-    cJSON *numberOfHeaderFilesJSON = cJSON_CreateNumber(numberOfHeaderFiles);
-    if (numberOfHeaderFilesJSON == nullptr)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    cJSON_AddItemToObject(root, "numberOfHeaderFiles", numberOfHeaderFilesJSON);
-
-    cJSON *headerFilesJSON = cJSON_CreateArray();
-    if (headerFilesJSON == nullptr)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    cJSON_AddItemToObject(root, "headerFiles", headerFilesJSON);
-
-    for (std::vector<LoadAuthenticationStatusHeaderFile>::iterator it =
-             headerFiles->begin();
-         it != headerFiles->end(); ++it)
-    {
-        std::string headerFileData;
-        result = it->serializeJSON(headerFileData);
-        if (result != SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK)
-        {
-            cJSON_Delete(root);
-            return result;
-        }
-        cJSON *headerFileJSON = cJSON_Parse(headerFileData.c_str());
-        if (headerFileJSON == nullptr)
-        {
-            cJSON_Delete(root);
-            return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-        }
-        cJSON_AddItemToArray(headerFilesJSON, headerFileJSON);
-    }
-
-    char *serializedData = cJSON_PrintUnformatted(root);
-    if (serializedData == nullptr)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    data = std::string(serializedData);
-    free(serializedData);
-    cJSON_Delete(root);
-
+    Codec::Fields::toJSON(writer, *this);
     return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK;
 }
 
-SerializableAuthenticationOperationResult LoadAuthenticationStatusFile::deserializeJSON(
-    std::string &data)
+SerializableAuthenticationOperationResult LoadAuthenticationStatusFile::deserializeJSONFields(
+    const cJSON *root)
 {
-    SerializableAuthenticationOperationResult result = BaseAuthenticationFile::deserializeJSON(data);
+    SerializableAuthenticationOperationResult result =
+        BaseAuthenticationFile::deserializeJSONFields(root);
     if (result != SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK)
     {
         return result;
     }
 
-    cJSON *root = cJSON_Parse(data.c_str());
-    if (root == nullptr)
-    {
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-
-    cJSON *authenticationOperationStatusCodeJSON = cJSON_GetObjectItem(root, "authenticationOperationStatusCode");
-    if (authenticationOperationStatusCodeJSON == nullptr)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    authenticationOperationStatusCode = authenticationOperationStatusCodeJSON->valueint;
-
-    cJSON *authenticationStatusDescriptionLengthJSON = cJSON_GetObjectItem(root, "authenticationStatusDescriptionLength");
-    if (authenticationStatusDescriptionLengthJSON == nullptr)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    authenticationStatusDescriptionLength = authenticationStatusDescriptionLengthJSON->valueint;
-
-    cJSON *authenticationStatusDescriptionJSON = cJSON_GetObjectItem(root, "authenticationStatusDescription");
-    if (authenticationStatusDescriptionJSON == nullptr)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    std::memcpy(authenticationStatusDescription, authenticationStatusDescriptionJSON->valuestring,
-                authenticationStatusDescriptionLength);
-
-    cJSON *counterJSON = cJSON_GetObjectItem(root, "counter");
-    if (counterJSON == nullptr)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    counter = counterJSON->valueint;
-
-    cJSON *exceptionTimerJSON = cJSON_GetObjectItem(root, "exceptionTimer");
-    if (exceptionTimerJSON == nullptr)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    exceptionTimer = exceptionTimerJSON->valueint;
-
-    cJSON *estimatedTimeJSON = cJSON_GetObjectItem(root, "estimatedTime");
-    if (estimatedTimeJSON == nullptr)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    estimatedTime = estimatedTimeJSON->valueint;
-
-    cJSON *loadListRatioJSON = cJSON_GetObjectItem(root, "loadListRatio");
-    if (loadListRatioJSON == nullptr)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    loadListRatio = loadListRatioJSON->valueint;
-
-    cJSON *numberOfHeaderFilesJSON = cJSON_GetObjectItem(root, "numberOfHeaderFiles");
-    if (numberOfHeaderFilesJSON == nullptr)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    numberOfHeaderFiles = numberOfHeaderFilesJSON->valueint;
-
-    cJSON *headerFilesJSON = cJSON_GetObjectItem(root, "headerFiles");
-    if (headerFilesJSON == nullptr)
+    if (!Codec::Fields::fromJSON(root, *this))
     {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    int headerArraySize = cJSON_GetArraySize(headerFilesJSON);
-    if (headerArraySize != numberOfHeaderFiles)
-    {
-        cJSON_Delete(root);
         return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
     }
 
-    for (int i = 0; i < numberOfHeaderFiles; i++)
-    {
-        cJSON *headerFileJSON = cJSON_GetArrayItem(headerFilesJSON, i);
-        if (headerFileJSON == nullptr)
-        {
-            cJSON_Delete(root);
-            return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-        }
-        char *headerFileData = cJSON_PrintUnformatted(headerFileJSON);
-        if (headerFileData == nullptr)
-        {
-            cJSON_Delete(root);
-            return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-        }
-        std::string data = std::string(headerFileData);
-        LoadAuthenticationStatusHeaderFile headerFile;
-        result = headerFile.deserializeJSON(data);
-        free(headerFileData);
-        if (result != SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK)
-        {
-            cJSON_Delete(root);
-            return result;
-        }
-        std::string headerFileName;
-        std::string loadPartNumberName;
-        uint32_t loadRatio;
-        uint16_t loadStatus;
-        std::string loadStatusDescription;
-        headerFile.getHeaderFileName(headerFileName);
-        headerFile.getLoadPartNumberName(loadPartNumberName);
-        headerFile.getLoadRatio(loadRatio);
-        headerFile.getLoadStatus(loadStatus);
-        headerFile.getLoadStatusDescription(loadStatusDescription);
-        headerFiles->emplace_back();
-        headerFiles->back().setHeaderFileName(headerFileName);
-        headerFiles->back().setLoadPartNumberName(loadPartNumberName);
-        headerFiles->back().setLoadRatio(loadRatio);
-        headerFiles->back().setLoadStatus(loadStatus);
-        headerFiles->back().setLoadStatusDescription(loadStatusDescription);
-    }
-    cJSON_Delete(root);
-
     return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK;
 }
 FileAuthenticationOperationResult LoadAuthenticationStatusFile::getFileSize(size_t &fileSize)
@@ -567,40 +277,14 @@ FileAuthenticationOperationResult LoadAuthenticationStatusFile::getFileSize(size
         return result;
     }
 
-    fileSize += sizeof(authenticationOperationStatusCode);
-    fileSize += sizeof(authenticationStatusDescriptionLength);
-    fileSize += authenticationStatusDescriptionLength;
-    fileSize += sizeof(counter);
-    fileSize += sizeof(exceptionTimer);
-    fileSize += sizeof(estimatedTime);
-    fileSize += sizeof(loadListRatio) - sizeof(uint8_t);
-    fileSize += sizeof(numberOfHeaderFiles);
-
-    for (std::vector<LoadAuthenticationStatusHeaderFile>::iterator it = headerFiles->begin();
-         it != headerFiles->end(); it++)
-    {
-        size_t headerFileSize = 0;
-        result = (*it).getFileSize(headerFileSize);
-        if (result != FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK)
-        {
-            return result;
-        }
-        fileSize += headerFileSize;
-    }
-
+    fileSize += Codec::Fields::size(*this);
     return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
 }
 
 LoadAuthenticationStatusHeaderFile::LoadAuthenticationStatusHeaderFile()
 {
-    headerFileNameLength = 0;
-    std::memset(headerFileName, 0, sizeof(MAX_HEADER_FILE_NAME_SIZE));
-    loadPartNumberNameLength = 0;
-    std::memset(loadPartNumberName, 0, sizeof(MAX_LOAD_PART_NUMBER_NAME_SIZE));
     loadRatio = 0;
     loadStatus = 0;
-    loadStatusDescriptionLength = 0;
-    std::memset(loadStatusDescription, 0, sizeof(MAX_LOAD_STATUS_DESCRIPTION_SIZE));
 }
 
 LoadAuthenticationStatusHeaderFile::~LoadAuthenticationStatusHeaderFile()
@@ -615,10 +299,9 @@ FileAuthenticationOperationResult LoadAuthenticationStatusHeaderFile::setHeaderF
         return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_ERROR;
     }
 
-    headerFileNameLength = std::min(headerFileName.length() + 1,
-                                    MAX_HEADER_FILE_NAME_SIZE);
-    std::memcpy(this->headerFileName, headerFileName.c_str(),
-                headerFileNameLength);
+    size_t headerFileNameLength = std::min(headerFileName.length() + 1,
+                                           MAX_HEADER_FILE_NAME_SIZE);
+    this->headerFileName.assign(headerFileName.c_str(), headerFileNameLength);
     if (headerFileNameLength == MAX_HEADER_FILE_NAME_SIZE)
     {
         // If the string is too long, we need to add a null terminator to the end
@@ -631,14 +314,14 @@ FileAuthenticationOperationResult LoadAuthenticationStatusHeaderFile::setHeaderF
 FileAuthenticationOperationResult LoadAuthenticationStatusHeaderFile::getHeaderFileName(
     std::string &headerFileName)
 {
-    headerFileName = std::string(this->headerFileName);
+    headerFileName = std::string(this->headerFileName.c_str());
     return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
 }
 
 FileAuthenticationOperationResult LoadAuthenticationStatusHeaderFile::getHeaderFileNameLength(
     uint8_t &headerFileNameLength)
 {
-    headerFileNameLength = this->headerFileNameLength;
+    headerFileNameLength = this->headerFileName.size();
     return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
 }
 
@@ -650,10 +333,9 @@ FileAuthenticationOperationResult LoadAuthenticationStatusHeaderFile::setLoadPar
         return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_ERROR;
     }
 
-    loadPartNumberNameLength = std::min(loadPartNumberName.length() + 1,
-                                        MAX_LOAD_PART_NUMBER_NAME_SIZE);
-    std::memcpy(this->loadPartNumberName, loadPartNumberName.c_str(),
-                loadPartNumberNameLength);
+    size_t loadPartNumberNameLength = std::min(loadPartNumberName.length() + 1,
+                                               MAX_LOAD_PART_NUMBER_NAME_SIZE);
+    this->loadPartNumberName.assign(loadPartNumberName.c_str(), loadPartNumberNameLength);
     if (loadPartNumberNameLength == MAX_LOAD_PART_NUMBER_NAME_SIZE)
     {
         // If the string is too long, we need to add a null terminator to the end
@@ -667,7 +349,7 @@ FileAuthenticationOperationResult
 LoadAuthenticationStatusHeaderFile::getLoadPartNumberName(
     std::string &loadPartNumberName)
 {
-    loadPartNumberName = std::string(this->loadPartNumberName);
+    loadPartNumberName = std::string(this->loadPartNumberName.c_str());
     return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
 }
 
@@ -675,7 +357,7 @@ FileAuthenticationOperationResult
 LoadAuthenticationStatusHeaderFile::getLoadPartNumberNameLength(
     uint8_t &loadPartNumberNameLength)
 {
-    loadPartNumberNameLength = this->loadPartNumberNameLength;
+    loadPartNumberNameLength = this->loadPartNumberName.size();
     return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
 }
 
@@ -710,10 +392,9 @@ FileAuthenticationOperationResult LoadAuthenticationStatusHeaderFile::getLoadSta
 FileAuthenticationOperationResult LoadAuthenticationStatusHeaderFile::setLoadStatusDescription(
     std::string loadStatusDescription)
 {
-    loadStatusDescriptionLength = std::min(loadStatusDescription.length() + 1,
-                                           MAX_LOAD_STATUS_DESCRIPTION_SIZE);
-    std::memcpy(this->loadStatusDescription, loadStatusDescription.c_str(),
-                loadStatusDescriptionLength);
+    size_t loadStatusDescriptionLength = std::min(loadStatusDescription.length() + 1,
+                                                  MAX_LOAD_STATUS_DESCRIPTION_SIZE);
+    this->loadStatusDescription.assign(loadStatusDescription.c_str(), loadStatusDescriptionLength);
     if (loadStatusDescriptionLength == MAX_LOAD_STATUS_DESCRIPTION_SIZE)
     {
         // If the string is too long, we need to add a null terminator to the end
@@ -726,14 +407,14 @@ FileAuthenticationOperationResult LoadAuthenticationStatusHeaderFile::setLoadSta
 FileAuthenticationOperationResult LoadAuthenticationStatusHeaderFile::getLoadStatusDescription(
     std::string &loadStatusDescription)
 {
-    loadStatusDescription = std::string(this->loadStatusDescription);
+    loadStatusDescription = std::string(this->loadStatusDescription.c_str());
     return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
 }
 
 FileAuthenticationOperationResult LoadAuthenticationStatusHeaderFile::getLoadStatusDescriptionLength(
     uint8_t &loadStatusDescriptionLength)
 {
-    loadStatusDescriptionLength = this->loadStatusDescriptionLength;
+    loadStatusDescriptionLength = this->loadStatusDescription.size();
     return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
 }
 
@@ -741,171 +422,83 @@ SerializableAuthenticationOperationResult
 LoadAuthenticationStatusHeaderFile::serialize(
     std::shared_ptr<std::vector<uint8_t>> &data)
 {
-    data->push_back(headerFileNameLength);
-    data->insert(data->end(), headerFileName,
-                 headerFileName + headerFileNameLength);
-    data->push_back(loadPartNumberNameLength);
-    data->insert(data->end(), loadPartNumberName,
-                 loadPartNumberName + loadPartNumberNameLength);
-    data->push_back((loadRatio >> 16) & 0xFF);
-    data->push_back((loadRatio >> 8) & 0xFF);
-    data->push_back(loadRatio & 0xFF);
-    data->push_back((loadStatus >> 8) & 0xFF);
-    data->push_back(loadStatus & 0xFF);
-    data->push_back(loadStatusDescriptionLength);
-    data->insert(data->end(), loadStatusDescription,
-                 loadStatusDescription + loadStatusDescriptionLength);
-    return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK;
-}
+    size_t fileSize = 0;
+    getFileSize(fileSize);
 
-SerializableAuthenticationOperationResult
-LoadAuthenticationStatusHeaderFile::deserialize(
-    std::shared_ptr<std::vector<uint8_t>> &data)
-{
-    size_t offset = 0;
+    size_t offset = data->size();
+    data->resize(offset + fileSize);
 
-    if (data->size() < offset + sizeof(headerFileNameLength))
-    {
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-
-    headerFileNameLength = data->at(offset);
-    offset += sizeof(headerFileNameLength);
-
-    if (data->size() < offset + headerFileNameLength)
+    size_t written = 0;
+    SerializableAuthenticationOperationResult result =
+        serializeInto(data->data() + offset, fileSize, written);
+    if (result != SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK)
     {
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
+        data->resize(offset);
+        return result;
     }
-    std::memcpy(headerFileName, data->data() + offset, headerFileNameLength);
-    offset += headerFileNameLength;
+    data->resize(offset + written);
 
-    if (data->size() < offset + sizeof(loadPartNumberNameLength))
-    {
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
+    return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK;
+}
 
-    loadPartNumberNameLength = data->at(offset);
-    offset += sizeof(loadPartNumberNameLength);
+SerializableAuthenticationOperationResult
+LoadAuthenticationStatusHeaderFile::serializeInto(
+    uint8_t *buffer, size_t capacity, size_t &written)
+{
+    AuthenticationBufferWriter writer(buffer, capacity);
+    written = 0;
 
-    if (data->size() < offset + loadPartNumberNameLength)
+    if (!Codec::Fields::encode(writer, *this))
     {
         return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
     }
-    std::memcpy(loadPartNumberName, data->data() + offset, loadPartNumberNameLength);
-    offset += loadPartNumberNameLength;
 
-    if (data->size() < offset + sizeof(loadRatio) - sizeof(uint8_t))
-    {
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    loadRatio = (data->at(offset) << 16) | (data->at(offset + 1) << 8) | data->at(offset + 2);
-    offset += sizeof(loadRatio) - sizeof(uint8_t);
+    written = writer.getWritten();
+    return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK;
+}
 
-    if (data->size() < offset + sizeof(loadStatus))
-    {
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    loadStatus = (data->at(offset) << 8) | data->at(offset + 1);
-    offset += sizeof(loadStatus);
+SerializableAuthenticationOperationResult
+LoadAuthenticationStatusHeaderFile::deserialize(
+    std::shared_ptr<std::vector<uint8_t>> &data)
+{
+    return deserializeFrom(data->data(), data->size());
+}
 
-    if (data->size() < offset + sizeof(loadStatusDescriptionLength))
-    {
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    loadStatusDescriptionLength = data->at(offset);
-    offset += sizeof(loadStatusDescriptionLength);
+SerializableAuthenticationOperationResult
+LoadAuthenticationStatusHeaderFile::deserializeFrom(const uint8_t *data, size_t dataSize)
+{
+    size_t offset = 0;
+    return deserialize(data, dataSize, offset);
+}
 
-    if (data->size() < offset + loadStatusDescriptionLength)
+SerializableAuthenticationOperationResult
+LoadAuthenticationStatusHeaderFile::deserialize(
+    const uint8_t *data, size_t dataSize, size_t &offset)
+{
+    AuthenticationBufferReader reader(data, dataSize, offset);
+    if (!Codec::Fields::decode(reader, *this))
     {
         return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
     }
-    std::memcpy(loadStatusDescription, data->data() + offset, loadStatusDescriptionLength);
 
+    offset = reader.getOffset();
     return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK;
 }
 
 SerializableAuthenticationOperationResult
 LoadAuthenticationStatusHeaderFile::serializeJSON(std::string &data)
 {
-    cJSON *root = cJSON_CreateObject();
-    if (root == NULL)
-    {
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-
-    cJSON *headerFileNameLengthJSON = cJSON_CreateNumber(headerFileNameLength);
-    if (headerFileNameLengthJSON == NULL)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    cJSON_AddItemToObject(root, "headerFileNameLength", headerFileNameLengthJSON);
-
-    cJSON *headerFileNameJSON = cJSON_CreateString(headerFileName);
-    if (headerFileNameJSON == NULL)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    cJSON_AddItemToObject(root, "headerFileName", headerFileNameJSON);
-
-    cJSON *loadPartNumberNameLengthJSON = cJSON_CreateNumber(loadPartNumberNameLength);
-    if (loadPartNumberNameLengthJSON == NULL)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    cJSON_AddItemToObject(root, "loadPartNumberNameLength", loadPartNumberNameLengthJSON);
-
-    cJSON *loadPartNumberNameJSON = cJSON_CreateString(loadPartNumberName);
-    if (loadPartNumberNameJSON == NULL)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    cJSON_AddItemToObject(root, "loadPartNumberName", loadPartNumberNameJSON);
-
-    cJSON *loadRatioJSON = cJSON_CreateNumber(loadRatio);
-    if (loadRatioJSON == NULL)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    cJSON_AddItemToObject(root, "loadRatio", loadRatioJSON);
-
-    cJSON *loadStatusJSON = cJSON_CreateNumber(loadStatus);
-    if (loadStatusJSON == NULL)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    cJSON_AddItemToObject(root, "loadStatus", loadStatusJSON);
-
-    cJSON *loadStatusDescriptionLengthJSON = cJSON_CreateNumber(loadStatusDescriptionLength);
-    if (loadStatusDescriptionLengthJSON == NULL)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    cJSON_AddItemToObject(root, "loadStatusDescriptionLength", loadStatusDescriptionLengthJSON);
-
-    cJSON *loadStatusDescriptionJSON = cJSON_CreateString(loadStatusDescription);
-    if (loadStatusDescriptionJSON == NULL)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    cJSON_AddItemToObject(root, "loadStatusDescription", loadStatusDescriptionJSON);
+    data.clear();
+    AuthenticationJsonWriter writer(data);
+    return serializeJSON(writer);
+}
 
-    char *serializedJSON = cJSON_PrintUnformatted(root);
-    if (serializedJSON == NULL)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    data = std::string(serializedJSON);
-    free(serializedJSON);
-    cJSON_Delete(root);
+SerializableAuthenticationOperationResult
+LoadAuthenticationStatusHeaderFile::serializeJSON(AuthenticationJsonWriter &writer)
+{
+    writer.beginObject();
+    Codec::Fields::toJSON(writer, *this);
+    writer.endObject();
     return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK;
 }
 
@@ -918,85 +511,25 @@ LoadAuthenticationStatusHeaderFile::deserializeJSON(std::string &data)
         return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
     }
 
-    cJSON *headerFileNameLengthJSON = cJSON_GetObjectItemCaseSensitive(root, "headerFileNameLength");
-    if (headerFileNameLengthJSON == NULL)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    headerFileNameLength = headerFileNameLengthJSON->valueint;
-
-    cJSON *headerFileNameJSON = cJSON_GetObjectItemCaseSensitive(root, "headerFileName");
-    if (headerFileNameJSON == NULL)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    std::memcpy(headerFileName, headerFileNameJSON->valuestring, headerFileNameLength);
-
-    cJSON *loadPartNumberNameLengthJSON = cJSON_GetObjectItemCaseSensitive(root, "loadPartNumberNameLength");
-    if (loadPartNumberNameLengthJSON == NULL)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    loadPartNumberNameLength = loadPartNumberNameLengthJSON->valueint;
-
-    cJSON *loadPartNumberNameJSON = cJSON_GetObjectItemCaseSensitive(root, "loadPartNumberName");
-    if (loadPartNumberNameJSON == NULL)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    std::memcpy(loadPartNumberName, loadPartNumberNameJSON->valuestring, loadPartNumberNameLength);
-
-    cJSON *loadRatioJSON = cJSON_GetObjectItemCaseSensitive(root, "loadRatio");
-    if (loadRatioJSON == NULL)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    loadRatio = loadRatioJSON->valueint;
-
-    cJSON *loadStatusJSON = cJSON_GetObjectItemCaseSensitive(root, "loadStatus");
-    if (loadStatusJSON == NULL)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    loadStatus = loadStatusJSON->valueint;
-
-    cJSON *loadStatusDescriptionLengthJSON = cJSON_GetObjectItemCaseSensitive(root, "loadStatusDescriptionLength");
-    if (loadStatusDescriptionLengthJSON == NULL)
-    {
-        cJSON_Delete(root);
-        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
-    }
-    loadStatusDescriptionLength = loadStatusDescriptionLengthJSON->valueint;
+    SerializableAuthenticationOperationResult result = deserializeJSON(root);
+    cJSON_Delete(root);
+    return result;
+}
 
-    cJSON *loadStatusDescriptionJSON = cJSON_GetObjectItemCaseSensitive(root, "loadStatusDescription");
-    if (loadStatusDescriptionJSON == NULL)
+SerializableAuthenticationOperationResult
+LoadAuthenticationStatusHeaderFile::deserializeJSON(const cJSON *root)
+{
+    if (!Codec::Fields::fromJSON(root, *this))
     {
-        cJSON_Delete(root);
         return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
     }
-    std::memcpy(loadStatusDescription, loadStatusDescriptionJSON->valuestring, loadStatusDescriptionLength);
 
-    cJSON_Delete(root);
     return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK;
 }
 
 FileAuthenticationOperationResult LoadAuthenticationStatusHeaderFile::getFileSize(
     size_t &fileSize)
 {
-    fileSize = sizeof(headerFileNameLength);
-    fileSize += headerFileNameLength;
-    fileSize += sizeof(loadPartNumberNameLength);
-    fileSize += loadPartNumberNameLength;
-    fileSize += sizeof(loadRatio) - sizeof(uint8_t);
-    fileSize += sizeof(loadStatus);
-    fileSize += sizeof(loadStatusDescriptionLength);
-    fileSize += loadStatusDescriptionLength;
-
+    fileSize = Codec::Fields::size(*this);
     return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
 }
@@ -0,0 +1,274 @@
+#include "LoadAuthenticationStatusView.h"
+#include "AuthenticationBufferReader.h"
+
+LoadAuthenticationStatusHeaderView::LoadAuthenticationStatusHeaderView()
+{
+    loadRatio = 0;
+    loadStatus = 0;
+}
+
+LoadAuthenticationStatusHeaderView::~LoadAuthenticationStatusHeaderView()
+{
+}
+
+FileAuthenticationOperationResult LoadAuthenticationStatusHeaderView::getHeaderFileName(
+    AuthenticationFieldView &headerFileName) const
+{
+    headerFileName = this->headerFileName;
+    return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
+}
+
+FileAuthenticationOperationResult LoadAuthenticationStatusHeaderView::getLoadPartNumberName(
+    AuthenticationFieldView &loadPartNumberName) const
+{
+    loadPartNumberName = this->loadPartNumberName;
+    return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
+}
+
+FileAuthenticationOperationResult LoadAuthenticationStatusHeaderView::getLoadRatio(
+    uint32_t &loadRatio) const
+{
+    loadRatio = this->loadRatio;
+    return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
+}
+
+FileAuthenticationOperationResult LoadAuthenticationStatusHeaderView::getLoadStatus(
+    uint16_t &loadStatus) const
+{
+    loadStatus = this->loadStatus;
+    return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
+}
+
+FileAuthenticationOperationResult LoadAuthenticationStatusHeaderView::getLoadStatusDescription(
+    AuthenticationFieldView &loadStatusDescription) const
+{
+    loadStatusDescription = this->loadStatusDescription;
+    return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
+}
+
+SerializableAuthenticationOperationResult LoadAuthenticationStatusHeaderView::parse(
+    const uint8_t *data, size_t dataSize, size_t &offset)
+{
+    AuthenticationBufferReader reader(data, dataSize, offset);
+
+    uint8_t headerFileNameLength = 0;
+    uint8_t loadPartNumberNameLength = 0;
+    uint8_t loadStatusDescriptionLength = 0;
+    if (!reader.getUint8(headerFileNameLength) ||
+        !reader.getField(headerFileNameLength, headerFileName) ||
+        !reader.getUint8(loadPartNumberNameLength) ||
+        !reader.getField(loadPartNumberNameLength, loadPartNumberName) ||
+        !reader.getUint24(loadRatio) ||
+        !reader.getUint16(loadStatus) ||
+        !reader.getUint8(loadStatusDescriptionLength) ||
+        !reader.getField(loadStatusDescriptionLength, loadStatusDescription))
+    {
+        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
+    }
+
+    offset = reader.getOffset();
+    return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK;
+}
+
+LoadAuthenticationStatusView::LoadAuthenticationStatusView()
+{
+    valid = false;
+    data = nullptr;
+    fileLength = 0;
+    authenticationOperationStatusCode = 0;
+    counter = 0;
+    exceptionTimer = 0;
+    estimatedTime = 0;
+    loadListRatio = 0;
+    numberOfHeaderFiles = 0;
+    headerFilesOffset = 0;
+}
+
+LoadAuthenticationStatusView::~LoadAuthenticationStatusView()
+{
+}
+
+SerializableAuthenticationOperationResult LoadAuthenticationStatusView::parse(
+    const uint8_t *data, size_t dataSize)
+{
+    valid = false;
+
+    AuthenticationBufferReader reader(data, dataSize);
+    if (!reader.getUint32(fileLength) || fileLength > dataSize)
+    {
+        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
+    }
+
+    // From now on, nothing past the file length is part of the file
+    reader = AuthenticationBufferReader(data, fileLength, reader.getOffset());
+
+    uint8_t authenticationStatusDescriptionLength = 0;
+    if (!reader.getField(PROTOCOL_VERSION_SIZE, protocolVersion) ||
+        !reader.getUint16(authenticationOperationStatusCode) ||
+        !reader.getUint8(authenticationStatusDescriptionLength) ||
+        !reader.getField(authenticationStatusDescriptionLength, authenticationStatusDescription) ||
+        !reader.getUint16(counter) ||
+        !reader.getUint16(exceptionTimer) ||
+        !reader.getUint16(estimatedTime) ||
+        !reader.getUint24(loadListRatio) ||
+        !reader.getUint16(numberOfHeaderFiles))
+    {
+        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
+    }
+
+    // Validate all header files once, so iterating them can not fail
+    headerFilesOffset = reader.getOffset();
+    size_t offset = headerFilesOffset;
+    for (uint16_t i = 0; i < numberOfHeaderFiles; i++)
+    {
+        LoadAuthenticationStatusHeaderView headerFile;
+        if (headerFile.parse(data, fileLength, offset) !=
+            SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK)
+        {
+            return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
+        }
+    }
+
+    this->data = data;
+    valid = true;
+    return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK;
+}
+
+SerializableAuthenticationOperationResult LoadAuthenticationStatusView::peekCounter(
+    const uint8_t *data, size_t dataSize, uint16_t &counter)
+{
+    AuthenticationBufferReader reader(data, dataSize);
+    uint32_t fileLength = 0;
+    if (!reader.getUint32(fileLength) || fileLength > dataSize)
+    {
+        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
+    }
+    reader = AuthenticationBufferReader(data, fileLength, reader.getOffset());
+
+    AuthenticationFieldView protocolVersion;
+    uint16_t authenticationOperationStatusCode = 0;
+    uint8_t authenticationStatusDescriptionLength = 0;
+    AuthenticationFieldView authenticationStatusDescription;
+    if (!reader.getField(PROTOCOL_VERSION_SIZE, protocolVersion) ||
+        !reader.getUint16(authenticationOperationStatusCode) ||
+        !reader.getUint8(authenticationStatusDescriptionLength) ||
+        !reader.getField(authenticationStatusDescriptionLength, authenticationStatusDescription) ||
+        !reader.getUint16(counter))
+    {
+        return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR;
+    }
+    return SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK;
+}
+
+FileAuthenticationOperationResult LoadAuthenticationStatusView::getFileLength(
+    uint32_t &fileLength) const
+{
+    if (!valid)
+    {
+        return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_ERROR;
+    }
+    fileLength = this->fileLength;
+    return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
+}
+
+FileAuthenticationOperationResult LoadAuthenticationStatusView::getProtocolVersion(
+    AuthenticationFieldView &protocolVersion) const
+{
+    if (!valid)
+    {
+        return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_ERROR;
+    }
+    protocolVersion = this->protocolVersion;
+    return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
+}
+
+FileAuthenticationOperationResult LoadAuthenticationStatusView::getAuthenticationOperationStatusCode(
+    uint16_t &authenticationOperationStatusCode) const
+{
+    if (!valid)
+    {
+        return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_ERROR;
+    }
+    authenticationOperationStatusCode = this->authenticationOperationStatusCode;
+    return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
+}
+
+FileAuthenticationOperationResult LoadAuthenticationStatusView::getAuthenticationStatusDescription(
+    AuthenticationFieldView &authenticationStatusDescription) const
+{
+    if (!valid)
+    {
+        return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_ERROR;
+    }
+    authenticationStatusDescription = this->authenticationStatusDescription;
+    return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
+}
+
+FileAuthenticationOperationResult LoadAuthenticationStatusView::getCounter(
+    uint16_t &counter) const
+{
+    if (!valid)
+    {
+        return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_ERROR;
+    }
+    counter = this->counter;
+    return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
+}
+
+FileAuthenticationOperationResult LoadAuthenticationStatusView::getExceptionTimer(
+    uint16_t &exceptionTimer) const
+{
+    if (!valid)
+    {
+        return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_ERROR;
+    }
+    exceptionTimer = this->exceptionTimer;
+    return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
+}
+
+FileAuthenticationOperationResult LoadAuthenticationStatusView::getEstimatedTime(
+    uint16_t &estimatedTime) const
+{
+    if (!valid)
+    {
+        return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_ERROR;
+    }
+    estimatedTime = this->estimatedTime;
+    return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
+}
+
+FileAuthenticationOperationResult LoadAuthenticationStatusView::getLoadListRatio(
+    uint32_t &loadListRatio) const
+{
+    if (!valid)
+    {
+        return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_ERROR;
+    }
+    loadListRatio = this->loadListRatio;
+    return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
+}
+
+FileAuthenticationOperationResult LoadAuthenticationStatusView::getNumberOfHeaderFiles(
+    uint16_t &numberOfHeaderFiles) const
+{
+    if (!valid)
+    {
+        return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_ERROR;
+    }
+    numberOfHeaderFiles = this->numberOfHeaderFiles;
+    return FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK;
+}
+
+LoadAuthenticationStatusView::HeaderFileIterator LoadAuthenticationStatusView::begin() const
+{
+    if (!valid)
+    {
+        return end();
+    }
+    return HeaderFileIterator(data, fileLength, headerFilesOffset, numberOfHeaderFiles);
+}
+
+LoadAuthenticationStatusView::HeaderFileIterator LoadAuthenticationStatusView::end() const
+{
+    return HeaderFileIterator();
+}
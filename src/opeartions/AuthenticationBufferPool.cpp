@@ -0,0 +1,126 @@
+#include "AuthenticationBufferPool.h"
+
+#include <algorithm>
+#include <new>
+#include <utility>
+
+AuthenticationBufferPool::AuthenticationBufferPool(size_t bufferSize, size_t capacity,
+                                                   size_t buffersPerSlab)
+{
+    this->bufferSize = bufferSize;
+    this->capacity = capacity;
+    this->buffersPerSlab = std::max(buffersPerSlab, (size_t)1);
+    allocatedBuffers = 0;
+    buffersInUse = 0;
+    highWaterMark = 0;
+    overflows = 0;
+
+    // Releasing a buffer must never allocate
+    freeBuffers.reserve(capacity);
+    slabs.reserve((capacity + this->buffersPerSlab - 1) / this->buffersPerSlab);
+}
+
+AuthenticationBufferPool::~AuthenticationBufferPool()
+{
+}
+
+char *AuthenticationBufferPool::acquire()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (freeBuffers.empty())
+        {
+            size_t slabBuffers = std::min(buffersPerSlab, capacity - allocatedBuffers);
+            if (slabBuffers > 0)
+            {
+                char *slab = new (std::nothrow) char[slabBuffers * bufferSize];
+                if (slab != NULL)
+                {
+                    Slab newSlab;
+                    newSlab.data = std::unique_ptr<char[]>(slab);
+                    newSlab.numberOfBuffers = slabBuffers;
+                    slabs.push_back(std::move(newSlab));
+                    allocatedBuffers += slabBuffers;
+                    // Hand out the first buffers of the slab first
+                    for (size_t i = slabBuffers; i > 0; i--)
+                    {
+                        freeBuffers.push_back(slab + (i - 1) * bufferSize);
+                    }
+                }
+            }
+        }
+
+        if (!freeBuffers.empty())
+        {
+            char *buffer = freeBuffers.back();
+            freeBuffers.pop_back();
+            buffersInUse++;
+            highWaterMark = std::max(highWaterMark, buffersInUse);
+            return buffer;
+        }
+        overflows++;
+    }
+
+    return new (std::nothrow) char[bufferSize];
+}
+
+void AuthenticationBufferPool::release(char *buffer)
+{
+    if (buffer == NULL)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (owns(buffer))
+        {
+            freeBuffers.push_back(buffer);
+            buffersInUse--;
+            return;
+        }
+    }
+
+    delete[] buffer;
+}
+
+size_t AuthenticationBufferPool::getBufferSize()
+{
+    return bufferSize;
+}
+
+size_t AuthenticationBufferPool::getCapacity()
+{
+    return capacity;
+}
+
+size_t AuthenticationBufferPool::getNumberOfBuffersInUse()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return buffersInUse;
+}
+
+size_t AuthenticationBufferPool::getHighWaterMark()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return highWaterMark;
+}
+
+size_t AuthenticationBufferPool::getNumberOfOverflows()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return overflows;
+}
+
+bool AuthenticationBufferPool::owns(char *buffer)
+{
+    for (std::vector<Slab>::iterator it = slabs.begin(); it != slabs.end(); ++it)
+    {
+        char *slab = it->data.get();
+        if ((buffer >= slab) && (buffer < slab + it->numberOfBuffers * bufferSize))
+        {
+            return true;
+        }
+    }
+    return false;
+}
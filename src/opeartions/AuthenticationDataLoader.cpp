@@ -1,18 +1,36 @@
 #include "AuthenticationDataLoader.h"
+#include "AuthenticationJsonWriter.h"
+#include "AuthenticationLog.h"
 #include "InitializationAuthenticationFile.h"
 #include "LoadAuthenticationRequestFile.h"
 #include "LoadAuthenticationStatusFile.h"
+#include "LoadAuthenticationStatusView.h"
 
 #include <thread>
 #include <fstream>
+#include <cstdlib>
 #include <cstring>
 #include <algorithm>
 #include <chrono>
 #include <sstream>
+#include <unordered_set>
+
+// Names of the phases in the latency reports, in AuthenticationPhase order
+static const char *phaseNames[AUTHENTICATION_PHASES] = {
+    "tftp_init",
+    "initialization_fetch",
+    "acceptance_wait",
+    "load_list_send",
+    "certificate_read",
+    "completion_wait",
+    "total"};
 
 AuthenticationDataLoader::AuthenticationDataLoader(std::string targetHardwareId,
                                                    std::string targetHardwarePosition,
                                                    std::string targetHardwareIp)
+    : receiveBufferPool(DEFAULT_RECEIVE_BUFFER_SIZE, DEFAULT_RECEIVE_BUFFER_POOL_CAPACITY,
+                        DEFAULT_RECEIVE_BUFFER_POOL_SLAB),
+      certificateCache(DEFAULT_CERTIFICATE_CACHE_BUDGET)
 {
     this->targetHardwareId = targetHardwareId;
     this->targetHardwarePosition = targetHardwarePosition;
@@ -25,7 +43,19 @@ AuthenticationDataLoader::AuthenticationDataLoader(std::string targetHardwareId,
     tftpDataLoaderServerPort = DEFAULT_AUTHENTICATION_TFTP_PORT;
     tftpTargetHardwareServerPort = DEFAULT_AUTHENTICATION_TFTP_PORT;
 
-    toggleAbortSend = false;
+    stopClientProcessor = false;
+    statusDeadlineMoved = false;
+    retriesMoved = false;
+    stopRetries = false;
+    endingSessions = 0;
+    handleAnchor = std::make_shared<HandleAnchor>();
+    handleAnchor->dataLoader = this;
+    handleAnchor->users = 0;
+    retryPolicy = std::make_shared<AuthenticationRetryPolicy>();
+    authenticating = false;
+    engineServerPort = DEFAULT_AUTHENTICATION_TFTP_PORT;
+    engineRunning = false;
+    stopWorkers = false;
 
     _authenticationInitializationResponseContext = NULL;
     _authenticationInitializationResponseCallback = nullptr;
@@ -39,14 +69,39 @@ AuthenticationDataLoader::AuthenticationDataLoader(std::string targetHardwareId,
 
 AuthenticationDataLoader::~AuthenticationDataLoader()
 {
-    loadList.clear();
+    // Handles left with the caller can't reach the DataLoader anymore
+    {
+        std::unique_lock<std::mutex> lock(handleAnchor->mutex);
+        handleAnchor->dataLoader = nullptr;
+        handleAnchor->cv.wait(lock, [this]
+                              { return handleAnchor->users == 0; });
+    }
 
-    if (tftpClient != nullptr)
     {
-        tftpClient.reset();
-        tftpClient = nullptr;
+        std::lock_guard<std::mutex> lock(engineMutex);
+        stopEngine();
+    }
+
+    // Nothing will end the sessions still in flight anymore
+    std::vector<std::shared_ptr<TargetSession>> sessions;
+    {
+        std::lock_guard<std::mutex> lock(activeSessionsMutex);
+        for (std::unordered_map<std::string, std::shared_ptr<TargetSession>>::iterator it =
+                 activeSessions.begin();
+             it != activeSessions.end(); ++it)
+        {
+            sessions.push_back(it->second);
+        }
+    }
+    for (std::vector<std::shared_ptr<TargetSession>>::iterator it = sessions.begin();
+         it != sessions.end(); ++it)
+    {
+        endSession(*it);
     }
 
+    loadList.clear();
+    targets.clear();
+
     if (tftpServer != nullptr)
     {
         tftpServer.reset();
@@ -114,15 +169,40 @@ AuthenticationOperationResult AuthenticationDataLoader::setTargetHardwareIp(
     return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
 }
 
-AuthenticationOperationResult AuthenticationDataLoader::setLoadList(
-    std::vector<AuthenticationLoad> loadList)
+AuthenticationOperationResult AuthenticationDataLoader::checkLoadList(
+    std::vector<AuthenticationLoad> &loadList)
 {
-    if (loadList.size() == 0)
+    if ((loadList.size() == 0) || (loadList.size() > MAX_AUTHENTICATION_LOADS))
     {
         return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
     }
-    //We'll allow only one certificate per authentication
-    if (loadList.size() > 1)
+
+    // The target hardware requests each load, and reports its progress, by
+    // file name, so names must fit the request whole and be distinct
+    std::unordered_set<std::string> headerFileNames;
+    for (std::vector<AuthenticationLoad>::iterator it = loadList.begin();
+         it != loadList.end(); ++it)
+    {
+        std::string &headerFileName = std::get<LOAD_FILE_NAME_IDX>(*it);
+        std::string &loadPartNumberName = std::get<LOAD_PART_NUMBER_IDX>(*it);
+        if (headerFileName.empty() || (headerFileName.length() >= MAX_HEADER_FILE_NAME_SIZE) ||
+            loadPartNumberName.empty() ||
+            (loadPartNumberName.length() >= MAX_LOAD_PART_NUMBER_NAME_SIZE))
+        {
+            return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+        }
+        if (!headerFileNames.insert(headerFileName).second)
+        {
+            return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+        }
+    }
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
+AuthenticationOperationResult AuthenticationDataLoader::setLoadList(
+    std::vector<AuthenticationLoad> loadList)
+{
+    if (checkLoadList(loadList) != AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK)
     {
         return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
     }
@@ -131,6 +211,135 @@ AuthenticationOperationResult AuthenticationDataLoader::setLoadList(
     return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
 }
 
+AuthenticationOperationResult AuthenticationDataLoader::addTarget(
+    std::string targetHardwareId, std::string targetHardwarePosition,
+    std::string targetHardwareIp, std::vector<AuthenticationLoad> loadList)
+{
+    if (targetHardwareId.empty() || targetHardwarePosition.empty() || targetHardwareIp.empty())
+    {
+        return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+    }
+    if (checkLoadList(loadList) != AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK)
+    {
+        return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+    }
+
+    std::shared_ptr<TargetSession> session = std::make_shared<TargetSession>(
+        targetHardwareId, targetHardwarePosition, targetHardwareIp, loadList);
+
+    std::lock_guard<std::mutex> lock(targetsMutex);
+    if (authenticating)
+    {
+        return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+    }
+    for (std::vector<std::shared_ptr<TargetSession>>::iterator it = targets.begin();
+         it != targets.end(); ++it)
+    {
+        if ((*it)->baseFileName == session->baseFileName)
+        {
+            return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+        }
+    }
+    targets.push_back(session);
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
+AuthenticationOperationResult AuthenticationDataLoader::clearTargets()
+{
+    std::lock_guard<std::mutex> lock(targetsMutex);
+    if (authenticating)
+    {
+        return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+    }
+    targets.clear();
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
+AuthenticationOperationResult AuthenticationDataLoader::getTargetState(
+    std::string targetHardwareId, std::string targetHardwarePosition,
+    AuthenticationTargetState &state)
+{
+    std::shared_ptr<TargetSession> session = findTarget(targetHardwareId, targetHardwarePosition);
+    if (session == nullptr)
+    {
+        return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+    }
+    state = session->state;
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
+AuthenticationOperationResult AuthenticationDataLoader::getTargetLoadProgress(
+    std::string targetHardwareId, std::string targetHardwarePosition,
+    std::vector<AuthenticationLoadProgress> &loadProgress, uint32_t &loadListRatio)
+{
+    std::shared_ptr<TargetSession> session = findTarget(targetHardwareId, targetHardwarePosition);
+    if (session == nullptr)
+    {
+        return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+    }
+
+    std::lock_guard<std::mutex> lock(session->mutex);
+    loadProgress = session->loadProgress;
+    loadListRatio = session->loadListRatio;
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
+AuthenticationOperationResult AuthenticationDataLoader::getTargetRetryStatistics(
+    std::string targetHardwareId, std::string targetHardwarePosition,
+    uint32_t &retries, uint32_t &waits)
+{
+    std::shared_ptr<TargetSession> session = findTarget(targetHardwareId, targetHardwarePosition);
+    if (session == nullptr)
+    {
+        return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+    }
+    retries = session->retries;
+    waits = session->waits;
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
+AuthenticationOperationResult AuthenticationDataLoader::getTargetStatusStatistics(
+    std::string targetHardwareId, std::string targetHardwarePosition,
+    uint32_t &duplicates, uint32_t &dropped)
+{
+    std::shared_ptr<TargetSession> session = findTarget(targetHardwareId, targetHardwarePosition);
+    if (session == nullptr)
+    {
+        return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+    }
+    duplicates = session->duplicateStatusFiles;
+    dropped = session->droppedStatusFiles;
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
+std::shared_ptr<AuthenticationDataLoader::TargetSession> AuthenticationDataLoader::findTarget(
+    std::string targetHardwareId, std::string targetHardwarePosition)
+{
+    std::string baseFileName = targetHardwareId + std::string("_") + targetHardwarePosition;
+    std::lock_guard<std::mutex> lock(targetsMutex);
+    for (std::vector<std::shared_ptr<TargetSession>>::iterator it = targets.begin();
+         it != targets.end(); ++it)
+    {
+        if ((*it)->baseFileName == baseFileName)
+        {
+            return *it;
+        }
+    }
+    return nullptr;
+}
+
+AuthenticationOperationResult AuthenticationDataLoader::setRetryPolicy(
+    std::shared_ptr<AuthenticationRetryPolicy> retryPolicy)
+{
+    if (retryPolicy == nullptr)
+    {
+        return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+    }
+    std::lock_guard<std::mutex> lock(retryPolicyMutex);
+    this->retryPolicy = retryPolicy;
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
 AuthenticationOperationResult AuthenticationDataLoader::setTftpTargetHardwareServerPort(
     uint16_t port)
 {
@@ -145,31 +354,285 @@ AuthenticationOperationResult AuthenticationDataLoader::setTftpDataLoaderServerP
     return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
 }
 
-AuthenticationOperationResult AuthenticationDataLoader::abort(
-    uint16_t abortSource)
+AuthenticationOperationResult AuthenticationDataLoader::getNumberOfRejectedFiles(
+    AuthenticationFileValidationResult reason, uint32_t &numberOfRejectedFiles)
+{
+    if (reason == AuthenticationFileValidationResult::AUTHENTICATION_FILE_VALID)
+    {
+        return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+    }
+    numberOfRejectedFiles = fileValidator.getNumberOfValidations(reason);
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
+AuthenticationOperationResult AuthenticationDataLoader::getReceiveBufferPoolUsage(
+    size_t &buffersInUse, size_t &highWaterMark, size_t &overflows)
 {
-    this->abortSource = abortSource;
-    toggleAbortSend = true;
+    buffersInUse = receiveBufferPool.getNumberOfBuffersInUse();
+    highWaterMark = receiveBufferPool.getHighWaterMark();
+    overflows = receiveBufferPool.getNumberOfOverflows();
     return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
 }
 
-AuthenticationOperationResult AuthenticationDataLoader::initTFTP()
+AuthenticationOperationResult AuthenticationDataLoader::preloadCertificate(
+    std::string fileName)
 {
-    tftpClient = std::unique_ptr<TFTPClient>(new TFTPClient());
-    if (tftpClient == nullptr)
+    if (!certificateCache.preload(fileName))
     {
         return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
     }
-    tftpServer = std::unique_ptr<TFTPServer>(new TFTPServer());
-    if (tftpServer == nullptr)
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
+AuthenticationOperationResult AuthenticationDataLoader::setCertificateCacheBudget(
+    size_t budget)
+{
+    certificateCache.setBudget(budget);
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
+AuthenticationOperationResult AuthenticationDataLoader::getCertificateCacheStatistics(
+    uint64_t &hits, uint64_t &misses, uint64_t &evictions)
+{
+    certificateCache.getStatistics(hits, misses, evictions);
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
+AuthenticationOperationResult AuthenticationDataLoader::getPhaseLatency(
+    AuthenticationPhase phase, AuthenticationLatencySummary &summary)
+{
+    size_t phaseIndex = static_cast<size_t>(phase);
+    if (phaseIndex >= AUTHENTICATION_PHASES)
+    {
+        return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+    }
+    latencies.phases[phaseIndex].getSummary(summary);
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
+// Certificates are shared by every target, so their reads are not timed per
+// target
+static bool isTargetPhase(size_t phaseIndex)
+{
+    return phaseIndex != static_cast<size_t>(AuthenticationPhase::AUTHENTICATION_PHASE_CERTIFICATE_READ);
+}
+
+AuthenticationOperationResult AuthenticationDataLoader::getTargetPhaseLatency(
+    std::string targetHardwareId, std::string targetHardwarePosition,
+    AuthenticationPhase phase, AuthenticationLatencySummary &summary)
+{
+    size_t phaseIndex = static_cast<size_t>(phase);
+    if ((phaseIndex >= AUTHENTICATION_PHASES) || !isTargetPhase(phaseIndex))
+    {
+        return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+    }
+
+    std::shared_ptr<PhaseLatencies> phaseLatencies = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(targetLatenciesMutex);
+        std::map<std::string, std::shared_ptr<PhaseLatencies>>::iterator it =
+            targetLatencies.find(targetHardwareId + std::string("_") + targetHardwarePosition);
+        if (it == targetLatencies.end())
+        {
+            return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+        }
+        phaseLatencies = it->second;
+    }
+    phaseLatencies->phases[phaseIndex].getSummary(summary);
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
+// Table rows of the latencies of every phase, in microseconds
+static void serializePhaseLatencies(std::string &report, const char *name,
+                                    const AuthenticationLatencyHistogram *phases,
+                                    bool target)
+{
+    report += name;
+    report += "\n";
+    for (size_t i = 0; i < AUTHENTICATION_PHASES; i++)
+    {
+        if (target && !isTargetPhase(i))
+        {
+            continue;
+        }
+        AuthenticationLatencySummary summary;
+        phases[i].getSummary(summary);
+        char row[160];
+        snprintf(row, sizeof(row), "  %-22s %8llu %12.1f %12.1f %12.1f %12.1f %12.1f\n",
+                 phaseNames[i], static_cast<unsigned long long>(summary.count),
+                 summary.mean.count() / 1000.0, summary.p50.count() / 1000.0,
+                 summary.p90.count() / 1000.0, summary.p99.count() / 1000.0,
+                 summary.max.count() / 1000.0);
+        report += row;
+    }
+}
+
+static void serializePhaseLatencies(AuthenticationJsonWriter &writer, const char *name,
+                                    const AuthenticationLatencyHistogram *phases,
+                                    bool target)
+{
+    writer.beginObject(name);
+    for (size_t i = 0; i < AUTHENTICATION_PHASES; i++)
+    {
+        if (target && !isTargetPhase(i))
+        {
+            continue;
+        }
+        AuthenticationLatencySummary summary;
+        phases[i].getSummary(summary);
+        writer.beginObject(phaseNames[i]);
+        writer.addNumber("count", static_cast<double>(summary.count));
+        writer.addNumber("min", summary.min.count() / 1000.0);
+        writer.addNumber("mean", summary.mean.count() / 1000.0);
+        writer.addNumber("p50", summary.p50.count() / 1000.0);
+        writer.addNumber("p90", summary.p90.count() / 1000.0);
+        writer.addNumber("p99", summary.p99.count() / 1000.0);
+        writer.addNumber("max", summary.max.count() / 1000.0);
+        writer.endObject();
+    }
+    writer.endObject();
+}
+
+AuthenticationOperationResult AuthenticationDataLoader::serializeLatencies(std::string &report)
+{
+    char header[160];
+    snprintf(header, sizeof(header), "%-24s %8s %12s %12s %12s %12s %12s\n",
+             "phase (us)", "count", "mean", "p50", "p90", "p99", "max");
+    report = header;
+    serializePhaseLatencies(report, "DataLoader", latencies.phases, false);
+
+    std::lock_guard<std::mutex> lock(targetLatenciesMutex);
+    for (std::map<std::string, std::shared_ptr<PhaseLatencies>>::iterator it =
+             targetLatencies.begin();
+         it != targetLatencies.end(); ++it)
+    {
+        serializePhaseLatencies(report, it->first.c_str(), it->second->phases, true);
+    }
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
+AuthenticationOperationResult AuthenticationDataLoader::serializeLatenciesJSON(std::string &report)
+{
+    report.clear();
+    AuthenticationJsonWriter writer(report);
+    writer.beginObject();
+    serializePhaseLatencies(writer, "dataLoader", latencies.phases, false);
+
+    writer.beginObject("targets");
+    {
+        std::lock_guard<std::mutex> lock(targetLatenciesMutex);
+        for (std::map<std::string, std::shared_ptr<PhaseLatencies>>::iterator it =
+                 targetLatencies.begin();
+             it != targetLatencies.end(); ++it)
+        {
+            serializePhaseLatencies(writer, it->first.c_str(), it->second->phases, true);
+        }
+    }
+    writer.endObject();
+    writer.endObject();
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
+AuthenticationOperationResult AuthenticationDataLoader::resetLatencies()
+{
+    // Sessions in flight keep recording in the histograms of their target
+    for (size_t i = 0; i < AUTHENTICATION_PHASES; i++)
+    {
+        latencies.phases[i].reset();
+    }
+    std::lock_guard<std::mutex> lock(targetLatenciesMutex);
+    for (std::map<std::string, std::shared_ptr<PhaseLatencies>>::iterator it =
+             targetLatencies.begin();
+         it != targetLatencies.end(); ++it)
+    {
+        for (size_t i = 0; i < AUTHENTICATION_PHASES; i++)
+        {
+            it->second->phases[i].reset();
+        }
+    }
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
+void AuthenticationDataLoader::recordLatency(std::shared_ptr<TargetSession> &session,
+                                             AuthenticationPhase phase,
+                                             std::chrono::steady_clock::duration latency)
+{
+    std::chrono::nanoseconds nanoseconds =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(latency);
+    size_t phaseIndex = static_cast<size_t>(phase);
+    latencies.phases[phaseIndex].record(nanoseconds);
+    if ((session != nullptr) && (session->latencies != nullptr))
+    {
+        session->latencies->phases[phaseIndex].record(nanoseconds);
+    }
+}
+
+AuthenticationOperationResult AuthenticationDataLoader::abort(
+    uint16_t abortSource)
+{
+    std::vector<std::shared_ptr<TargetSession>> sessions;
+    {
+        std::lock_guard<std::mutex> lock(activeSessionsMutex);
+        for (std::unordered_map<std::string, std::shared_ptr<TargetSession>>::iterator it =
+                 activeSessions.begin();
+             it != activeSessions.end(); ++it)
+        {
+            sessions.push_back(it->second);
+        }
+    }
+    BLSEC_LOG_INFO("Aborting {} authentications, abort source {}", sessions.size(), abortSource);
+
+    for (std::vector<std::shared_ptr<TargetSession>>::iterator it = sessions.begin();
+         it != sessions.end(); ++it)
+    {
+        bool endNow = false;
+        if ((abortSession(*it, abortSource, endNow) ==
+             AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK) &&
+            endNow)
+        {
+            endSession(*it);
+        }
+    }
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
+AuthenticationOperationResult AuthenticationDataLoader::abortSession(
+    std::shared_ptr<TargetSession> &session, uint16_t abortSource, bool &endNow)
+{
+    std::lock_guard<std::mutex> lock(session->mutex);
+    if (session->endAuthentication)
     {
         return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
     }
+    // The very next status file of the target hardware is answered with the
+    // abort, and the one reporting it is accepted
+    session->abortSource = abortSource;
+    session->toggleAbortSend = false;
+    session->cancelled = true;
+    // A target hardware that served its initialization file may have
+    // accepted already, and only learns of the abort from the answer to its
+    // next status file. The session stays active until then.
+    endNow = !session->initializationRequested;
+    // Transfers waiting to be tried again give up now
+    expediteRetries(session);
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
 
-    TftpClientOperationResult resultTftpClientOperation;
-    resultTftpClientOperation = tftpClient->setConnection(
-        targetHardwareIp.c_str(), tftpTargetHardwareServerPort);
-    if (resultTftpClientOperation != TftpClientOperationResult::TFTP_CLIENT_OK)
+void AuthenticationDataLoader::setAbortMessage(ITFTPSection *sectionHandler,
+                                               uint16_t abortSource)
+{
+    std::stringstream errorMessageStream;
+    errorMessageStream << AUTHENTICATION_ABORT_MSG_PREFIX;
+    errorMessageStream << AUTHENTICATION_ERROR_MSG_DELIMITER;
+    errorMessageStream << std::hex << abortSource;
+    std::string errorMessage = errorMessageStream.str();
+    sectionHandler->setErrorMessage(errorMessage);
+}
+
+AuthenticationOperationResult AuthenticationDataLoader::initTFTP()
+{
+    tftpServer = std::unique_ptr<TFTPServer>(new TFTPServer());
+    if (tftpServer == nullptr)
     {
         return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
     }
@@ -221,9 +684,10 @@ AuthenticationOperationResult AuthenticationDataLoader::initTFTP()
 }
 
 AuthenticationOperationResult AuthenticationDataLoader::initAuthenticationFiles(
+    std::shared_ptr<TargetSession> &session,
     LoadAuthenticationRequestFile &loadAuthenticationRequestFile)
 {
-    for (AuthenticationLoad load : loadList)
+    for (AuthenticationLoad load : session->loadList)
     {
         std::string headerName = std::get<LOAD_FILE_NAME_IDX>(load);
         std::string loadPartNumberName = std::get<LOAD_PART_NUMBER_IDX>(load);
@@ -238,11 +702,6 @@ AuthenticationOperationResult AuthenticationDataLoader::initAuthenticationFiles(
 
 AuthenticationOperationResult AuthenticationDataLoader::authenticate()
 {
-    abortSource = AUTHENTICATION_ABORT_SOURCE_NONE;
-    endAuthentication = false;
-    authenticationInitializationAccepted = false;
-    authenticationCompleted = false;
-
     if (targetHardwareId.empty() || targetHardwarePosition.empty() || targetHardwareIp.empty())
     {
         return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
@@ -253,76 +712,404 @@ AuthenticationOperationResult AuthenticationDataLoader::authenticate()
         return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
     }
 
-    std::shared_ptr<std::vector<uint8_t>> fileBuffer = std::make_shared<
-        std::vector<uint8_t>>();
-    if (fileBuffer == nullptr)
-    {
-        return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
-    }
+    std::vector<std::shared_ptr<TargetSession>> sessions;
+    sessions.push_back(std::make_shared<TargetSession>(
+        targetHardwareId, targetHardwarePosition, targetHardwareIp, loadList));
+    return runSessions(sessions);
+}
 
-    /***************************************************************************
-                                     START TFTP
-    ***************************************************************************/
-    if (initTFTP() != AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK)
+AuthenticationOperationResult AuthenticationDataLoader::authenticateTargets()
+{
+    std::vector<std::shared_ptr<TargetSession>> sessions;
     {
-        return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+        std::lock_guard<std::mutex> lock(targetsMutex);
+        if (authenticating || (targets.size() == 0))
+        {
+            return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+        }
+        authenticating = true;
+        sessions = targets;
     }
-    std::thread serverThread = std::thread([this]
-                                           { tftpServer->startListening(); });
-
-    /***************************************************************************
-                                INITIALIZATION
-    ***************************************************************************/
 
-    std::string baseFileName = targetHardwareId + std::string("_") + targetHardwarePosition;
+    AuthenticationOperationResult result = runSessions(sessions);
 
-    /********************* [TH_Authenticationing_Initialization] *********************/
-    std::string initializationFileName = baseFileName + INITIALIZATION_AUTHENTICATION_FILE_EXTENSION;
+    {
+        std::lock_guard<std::mutex> lock(targetsMutex);
+        authenticating = false;
+    }
+    return result;
+}
 
-    fileBuffer->clear();
-    fileBuffer->resize(MAX_CERTIFICATE_BUFFER_SIZE);
-    unsigned char *initializationFileBuffer = fileBuffer->data();
-    memset(initializationFileBuffer, 0, fileBuffer->size());
-    FILE *fpInitializationFile = fmemopen(initializationFileBuffer,
-                                          fileBuffer->size(), "w");
-    if (fpInitializationFile == NULL)
+AuthenticationOperationResult AuthenticationDataLoader::authenticateAsync(
+    std::string targetHardwareId, std::string targetHardwarePosition,
+    std::string targetHardwareIp, std::vector<AuthenticationLoad> loadList,
+    authenticationCompletedCallback callback, void *context,
+    std::shared_ptr<AuthenticationHandle> &handle)
+{
+    if (targetHardwareId.empty() || targetHardwarePosition.empty() || targetHardwareIp.empty())
     {
-        endAuthentication = true;
-        tftpServer->stopListening();
-        serverThread.join();
-        fileBuffer.reset();
         return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
     }
-
-    TftpClientOperationResult resultTftpClientOperation;
-    int numTries = 0;
-    do
+    if (checkLoadList(loadList) != AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK)
     {
-        fseek(fpInitializationFile, 0, SEEK_SET);
-        // TODO: Check for wait msg
-        resultTftpClientOperation = tftpClient->fetchFile(
-            initializationFileName.c_str(), fpInitializationFile);
-        numTries++;
-    } while ((resultTftpClientOperation != TftpClientOperationResult::TFTP_CLIENT_OK) && (numTries < MAX_DLP_TRIES));
-    fclose(fpInitializationFile);
+        return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+    }
 
-    if (resultTftpClientOperation != TftpClientOperationResult::TFTP_CLIENT_OK)
+    std::shared_ptr<TargetSession> session = std::make_shared<TargetSession>(
+        targetHardwareId, targetHardwarePosition, targetHardwareIp, loadList);
+    session->completedCallback = callback;
+    session->completedContext = context;
+    if (startSession(session) != AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK)
     {
-        endAuthentication = true;
-        tftpServer->stopListening();
-        serverThread.join();
-        fileBuffer.reset();
         return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
     }
 
-    InitializationAuthenticationFile initializationFile(initializationFileName);
-    initializationFile.deserialize(fileBuffer);
+    handle = std::shared_ptr<AuthenticationHandle>(new AuthenticationHandle(session, handleAnchor));
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
 
-    uint16_t operationAcceptanceStatusCode;
-    initializationFile.getOperationAcceptanceStatusCode(
-        operationAcceptanceStatusCode);
+AuthenticationOperationResult AuthenticationDataLoader::runSessions(
+    std::vector<std::shared_ptr<TargetSession>> &sessions)
+{
+    for (std::vector<std::shared_ptr<TargetSession>>::iterator it = sessions.begin();
+         it != sessions.end(); ++it)
+    {
+        (*it)->reset();
+        startSession(*it);
+    }
 
-    if (_authenticationInitializationResponseContext != nullptr)
+    AuthenticationOperationResult result = AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+    for (std::vector<std::shared_ptr<TargetSession>>::iterator it = sessions.begin();
+         it != sessions.end(); ++it)
+    {
+        if ((*it)->future.get() != AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK)
+        {
+            result = AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+        }
+    }
+
+    // The server and the workers stay up for the next authentication
+    return result;
+}
+
+AuthenticationOperationResult AuthenticationDataLoader::stop()
+{
+    if (!stopEngineIfIdle())
+    {
+        return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+    }
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
+AuthenticationOperationResult AuthenticationDataLoader::startSession(
+    std::shared_ptr<TargetSession> &session)
+{
+    session->startedAt = std::chrono::steady_clock::now();
+    {
+        std::lock_guard<std::mutex> latenciesLock(targetLatenciesMutex);
+        std::shared_ptr<PhaseLatencies> &sessionLatencies = targetLatencies[session->baseFileName];
+        if (sessionLatencies == nullptr)
+        {
+            sessionLatencies = std::make_shared<PhaseLatencies>();
+        }
+        session->latencies = sessionLatencies;
+    }
+
+    // The session is ended once the engine is unlocked, since its
+    // completion callback may start another session
+    bool started = false;
+    {
+        std::lock_guard<std::mutex> lock(engineMutex);
+        started = startSessionLocked(session);
+    }
+    if (!started)
+    {
+        endSession(session);
+        return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+    }
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
+bool AuthenticationDataLoader::startSessionLocked(std::shared_ptr<TargetSession> &session)
+{
+    if (engineRunning && (engineServerPort != tftpDataLoaderServerPort))
+    {
+        // Moving to another port needs a new server, bound once nothing
+        // is in flight on the current one
+        if (!isIdle())
+        {
+            return false;
+        }
+        stopEngine();
+    }
+    if (!engineRunning)
+    {
+        std::chrono::steady_clock::time_point engineStart = std::chrono::steady_clock::now();
+        if (startEngine() != AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK)
+        {
+            return false;
+        }
+        recordLatency(session, AuthenticationPhase::AUTHENTICATION_PHASE_TFTP_INIT,
+                      std::chrono::steady_clock::now() - engineStart);
+    }
+
+    {
+        std::lock_guard<std::mutex> sessionsLock(activeSessionsMutex);
+        // The files of two sessions of the same target can not be told apart
+        if (activeSessions.find(session->baseFileName) != activeSessions.end())
+        {
+            return false;
+        }
+        activeSessions[session->baseFileName] = session;
+    }
+
+    {
+        std::lock_guard<std::mutex> policyLock(retryPolicyMutex);
+        session->retryPolicy = retryPolicy;
+    }
+    submitTask([this, session]
+               { this->initializeSession(session); });
+    // While the initialization is exchanged, read the loads the target
+    // hardware is about to request
+    submitTask([this, session]
+               { this->preloadLoads(session); });
+    return true;
+}
+
+AuthenticationOperationResult AuthenticationDataLoader::startEngine()
+{
+    if (initTFTP() != AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK)
+    {
+        return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+    }
+
+    serverThread = std::thread([this]
+                               { tftpServer->startListening(); });
+
+    {
+        std::lock_guard<std::mutex> lock(clientProcessorMutex);
+        stopClientProcessor = false;
+        processorStatusDeadline = std::chrono::steady_clock::now();
+        statusDeadlineMoved = false;
+        retriesMoved = false;
+    }
+    stopRetries = false;
+    clientProcessorThread = std::thread([this]
+                                        { this->clientProcessor(); });
+
+    {
+        std::lock_guard<std::mutex> lock(workerTasksMutex);
+        stopWorkers = false;
+    }
+    for (int i = 0; i < DEFAULT_AUTHENTICATION_WORKERS; i++)
+    {
+        workers.push_back(std::thread([this]
+                                      { this->worker(); }));
+    }
+
+    engineServerPort = tftpDataLoaderServerPort;
+    engineRunning = true;
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
+void AuthenticationDataLoader::stopEngine()
+{
+    if (!engineRunning)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(workerTasksMutex);
+        stopWorkers = true;
+        workerTasks.clear();
+    }
+    workerTasksCV.notify_all();
+
+    // Transfers in flight are not tried again
+    stopRetries = true;
+    for (std::vector<std::thread>::iterator it = workers.begin(); it != workers.end(); ++it)
+    {
+        it->join();
+    }
+    workers.clear();
+
+    {
+        std::lock_guard<std::mutex> lock(clientProcessorMutex);
+        stopClientProcessor = true;
+    }
+    clientProcessorCV.notify_one();
+    clientProcessorThread.join();
+    {
+        // Like the tasks not started, the sessions they belong to are ended
+        // by the destructor
+        std::lock_guard<std::mutex> lock(clientProcessorMutex);
+        scheduledRetries.clear();
+    }
+
+    tftpServer->stopListening();
+    serverThread.join();
+
+    {
+        std::lock_guard<std::mutex> lock(targetClientsMutex);
+        targetClients.clear();
+    }
+    {
+        std::lock_guard<std::mutex> lock(idleClientsMutex);
+        idleClients.clear();
+    }
+    engineRunning = false;
+}
+
+bool AuthenticationDataLoader::isIdle()
+{
+    std::lock_guard<std::mutex> lock(activeSessionsMutex);
+    return activeSessions.empty() && (endingSessions == 0);
+}
+
+bool AuthenticationDataLoader::stopEngineIfIdle()
+{
+    std::lock_guard<std::mutex> lock(engineMutex);
+    if (!isIdle())
+    {
+        return false;
+    }
+    stopEngine();
+    return true;
+}
+
+void AuthenticationDataLoader::submitTask(std::function<void()> task)
+{
+    {
+        std::lock_guard<std::mutex> lock(workerTasksMutex);
+        workerTasks.push_back(task);
+    }
+    workerTasksCV.notify_one();
+}
+
+void AuthenticationDataLoader::worker()
+{
+    while (true)
+    {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(workerTasksMutex);
+            workerTasksCV.wait(lock, [this]
+                               { return stopWorkers || !workerTasks.empty(); });
+            if (stopWorkers)
+            {
+                break;
+            }
+            task = workerTasks.front();
+            workerTasks.pop_front();
+        }
+        task();
+    }
+}
+
+AuthenticationOperationResult AuthenticationDataLoader::acquireClient(
+    std::shared_ptr<TargetSession> &session, std::unique_ptr<ITFTPClient> &client)
+{
+    // Clients are only held while a worker exchanges a file, so a few of
+    // them serve every target
+    {
+        std::lock_guard<std::mutex> lock(idleClientsMutex);
+        if (!idleClients.empty())
+        {
+            client = std::move(idleClients.back());
+            idleClients.pop_back();
+        }
+    }
+    if (client == nullptr)
+    {
+        client = std::unique_ptr<TFTPClient>(new TFTPClient());
+    }
+
+    if ((client == nullptr) ||
+        (client->setConnection(session->targetHardwareIp.c_str(),
+                               tftpTargetHardwareServerPort) !=
+         TftpClientOperationResult::TFTP_CLIENT_OK))
+    {
+        client.reset();
+        return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+    }
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
+void AuthenticationDataLoader::releaseClient(std::unique_ptr<ITFTPClient> &client)
+{
+    if (client != nullptr)
+    {
+        std::lock_guard<std::mutex> lock(idleClientsMutex);
+        idleClients.push_back(std::move(client));
+    }
+}
+
+void AuthenticationDataLoader::initializeSession(std::shared_ptr<TargetSession> session)
+{
+    bool cancelled;
+    {
+        std::lock_guard<std::mutex> lock(session->mutex);
+        if (session->endAuthentication)
+        {
+            return;
+        }
+        session->state = AuthenticationTargetState::AUTHENTICATION_TARGET_INITIALIZING;
+        // Checked with the request marked, so an abort either sees it or
+        // is seen here
+        cancelled = session->cancelled;
+        session->initializationRequested = !cancelled;
+    }
+
+    if (cancelled)
+    {
+        endSession(session);
+        return;
+    }
+
+    /***************************************************************************
+                                INITIALIZATION
+    ***************************************************************************/
+
+    /********************* [TH_Authenticationing_Initialization] *********************/
+    std::shared_ptr<Transfer> transfer = std::make_shared<Transfer>();
+    transfer->session = session;
+    transfer->fetch = true;
+    transfer->fileName = session->baseFileName + INITIALIZATION_AUTHENTICATION_FILE_EXTENSION;
+    transfer->fileBuffer = std::make_shared<std::vector<uint8_t>>();
+    transfer->completed = [this](Transfer &transfer)
+    { this->initializationFetched(transfer); };
+    startTransfer(transfer);
+}
+
+void AuthenticationDataLoader::initializationFetched(Transfer &transfer)
+{
+    std::shared_ptr<TargetSession> session = transfer.session;
+    if (transfer.result != TftpClientOperationResult::TFTP_CLIENT_OK)
+    {
+        endSession(session);
+        return;
+    }
+    recordLatency(session, AuthenticationPhase::AUTHENTICATION_PHASE_INITIALIZATION_FETCH,
+                  std::chrono::steady_clock::now() - transfer.start);
+
+    std::shared_ptr<std::vector<uint8_t>> fileBuffer = transfer.fileBuffer;
+    if (fileValidator.validate(fileBuffer->data(), fileBuffer->size(),
+                               AuthenticationFileKind::AUTHENTICATION_FILE_KIND_INITIALIZATION) !=
+        AuthenticationFileValidationResult::AUTHENTICATION_FILE_VALID)
+    {
+        endSession(session);
+        return;
+    }
+
+    InitializationAuthenticationFile initializationFile(transfer.fileName);
+    initializationFile.deserialize(fileBuffer);
+
+    uint16_t operationAcceptanceStatusCode;
+    initializationFile.getOperationAcceptanceStatusCode(
+        operationAcceptanceStatusCode);
+
+    if (_authenticationInitializationResponseContext != nullptr)
     {
         std::string jsonResponse("");
         initializationFile.serializeJSON(jsonResponse);
@@ -331,98 +1118,427 @@ AuthenticationOperationResult AuthenticationDataLoader::authenticate()
             _authenticationInitializationResponseContext);
     }
 
-    if (operationAcceptanceStatusCode !=
-        OPERATION_IS_ACCEPTED)
+    if (operationAcceptanceStatusCode != OPERATION_IS_ACCEPTED)
     {
-        tftpServer->stopListening();
-        serverThread.join();
-        return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+        endSession(session);
+        return;
     }
 
-    std::thread clientProcessorThread = std::thread([this]
-                                                    { this->clientProcessor(); });
-
     /*********** Wait for status file with operation accepted code ***********/
 
+    // Nobody waits here: the load list is sent by whoever comes last, this
+    // worker or the status file with the accepted code. An aborted session
+    // never sends it, but waits for the target hardware to report the abort.
+    bool sendLoadListNow = false;
     {
-        std::unique_lock<std::mutex> lock(endAuthenticationMutex);
-        filesProcessedCV.wait(lock, [this]
-                              { return authenticationInitializationAccepted || endAuthentication; });
+        std::lock_guard<std::mutex> lock(session->mutex);
+        if (session->endAuthentication)
+        {
+            return;
+        }
+        session->authenticationInitialized = true;
+        session->initializedAt = std::chrono::steady_clock::now();
+        session->statusWatchdogArmed = true;
+        // A status file received meanwhile already set the deadline
+        if (!session->statusReceived)
+        {
+            setStatusDeadline(session, session->retryPolicy->statusTimeout(0, 0));
+        }
+        if (session->authenticationInitializationAccepted && !session->loadListScheduled &&
+            !session->cancelled)
+        {
+            // Accepted before the initialization file was even fetched
+            recordLatency(session, AuthenticationPhase::AUTHENTICATION_PHASE_ACCEPTANCE_WAIT,
+                          std::chrono::steady_clock::duration::zero());
+            session->loadListScheduled = true;
+            sendLoadListNow = true;
+        }
     }
+    if (sendLoadListNow)
+    {
+        sendLoadList(session);
+    }
+}
 
-    if (endAuthentication)
+void AuthenticationDataLoader::preloadLoads(std::shared_ptr<TargetSession> session)
+{
+    for (std::vector<AuthenticationLoad>::iterator it = session->loadList.begin();
+         it != session->loadList.end(); ++it)
     {
-        tftpServer->stopListening();
-        serverThread.join();
-        clientProcessorThread.join();
-        fileBuffer.reset();
-        return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+        if (session->cancelled)
+        {
+            return;
+        }
+        // Loads missing or too large for the cache are handled when requested
+        certificateCache.preload(std::get<LOAD_FILE_NAME_IDX>(*it));
+    }
+}
+
+void AuthenticationDataLoader::sendLoadList(std::shared_ptr<TargetSession> session)
+{
+    {
+        std::lock_guard<std::mutex> lock(session->mutex);
+        // The target hardware accepted already, an aborted session waits
+        // for it to report the abort
+        if (session->endAuthentication || session->cancelled)
+        {
+            return;
+        }
+        session->state = AuthenticationTargetState::AUTHENTICATION_TARGET_IN_PROGRESS;
     }
 
     /****************************** [Load_List] ******************************/
-    std::string loadListFileName = baseFileName + LOAD_AUTHENTICATION_REQUEST_FILE_EXTENSION;
+    std::shared_ptr<Transfer> transfer = std::make_shared<Transfer>();
+    transfer->session = session;
+    transfer->fetch = false;
+    transfer->fileName = session->baseFileName + LOAD_AUTHENTICATION_REQUEST_FILE_EXTENSION;
+    transfer->fileBuffer = std::make_shared<std::vector<uint8_t>>();
+    transfer->completed = [this](Transfer &transfer)
+    { this->loadListSent(transfer); };
+
+    LoadAuthenticationRequestFile loadAuthenticationRequestFile(transfer->fileName);
+    initAuthenticationFiles(session, loadAuthenticationRequestFile);
+    loadAuthenticationRequestFile.serialize(transfer->fileBuffer);
+    startTransfer(transfer);
+}
+
+void AuthenticationDataLoader::loadListSent(Transfer &transfer)
+{
+    std::shared_ptr<TargetSession> session = transfer.session;
+    if (transfer.result != TftpClientOperationResult::TFTP_CLIENT_OK)
+    {
+        // An aborted send is not a failure yet: the target hardware reports
+        // the abort, or the status watchdog gives it up
+        if (!session->cancelled)
+        {
+            endSession(session);
+        }
+        return;
+    }
+
+    std::chrono::steady_clock::time_point sendEnd = std::chrono::steady_clock::now();
+    recordLatency(session, AuthenticationPhase::AUTHENTICATION_PHASE_LOAD_LIST_SEND,
+                  sendEnd - transfer.start);
+    {
+        std::lock_guard<std::mutex> lock(session->mutex);
+        session->loadListSentAt = sendEnd;
+    }
+
+    /***************************************************************************
+                                   WAITING AUTHENTICATION
+    ***************************************************************************/
+    // The status files of the target hardware end the session from here
+}
+
+void AuthenticationDataLoader::startTransfer(std::shared_ptr<Transfer> transfer)
+{
+    transfer->start = std::chrono::steady_clock::now();
+    transfer->failedTries = 0;
+    transfer->result = TftpClientOperationResult::TFTP_CLIENT_ERROR;
+    tryTransfer(transfer);
+}
 
-    LoadAuthenticationRequestFile loadAuthenticationRequestFile(loadListFileName);
-    initAuthenticationFiles(loadAuthenticationRequestFile);
+void AuthenticationDataLoader::tryTransfer(std::shared_ptr<Transfer> transfer)
+{
+    std::shared_ptr<TargetSession> &session = transfer->session;
+    bool giveUp;
+    {
+        std::lock_guard<std::mutex> lock(session->mutex);
+        giveUp = session->endAuthentication || session->cancelled || stopRetries;
+    }
+    if (giveUp)
+    {
+        transfer->completed(*transfer);
+        return;
+    }
+
+    std::unique_ptr<ITFTPClient> client = nullptr;
+    if (acquireClient(session, client) != AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK)
+    {
+        transfer->completed(*transfer);
+        return;
+    }
+    // A WAIT answer of the target hardware is caught by the error callback
+    client->registerTftpErrorCallback(AuthenticationDataLoader::targetHardwareErrorCallback,
+                                      session.get());
+
+    // Fetched files are written from the start again on each try
+    AuthenticationMemoryFile memoryFile(transfer->fileBuffer);
+    FILE *fp = memoryFile.open(transfer->fetch ? "w" : "r");
+    if (fp == NULL)
+    {
+        releaseClient(client);
+        transfer->completed(*transfer);
+        return;
+    }
+    session->waitTimeS = 0;
+    transfer->result = transfer->fetch ? client->fetchFile(transfer->fileName.c_str(), fp)
+                                       : client->sendFile(transfer->fileName.c_str(), fp);
+    fclose(fp);
+    releaseClient(client);
+    if ((transfer->result == TftpClientOperationResult::TFTP_CLIENT_OK) || session->cancelled)
+    {
+        transfer->completed(*transfer);
+        return;
+    }
 
-    fileBuffer->clear();
-    fileBuffer->resize(0);
-    loadAuthenticationRequestFile.serialize(fileBuffer);
+    uint16_t waitTimeS = session->waitTimeS;
+    if (waitTimeS == 0)
+    {
+        transfer->failedTries++;
+    }
+    std::chrono::milliseconds delay;
+    std::chrono::milliseconds elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - transfer->start);
+    if (!session->retryPolicy->nextTry(transfer->failedTries, waitTimeS, elapsed, delay))
+    {
+        transfer->completed(*transfer);
+        return;
+    }
+    if (waitTimeS == 0)
+    {
+        session->retries++;
+    }
+    else
+    {
+        session->waits++;
+    }
+    BLSEC_LOG_WARNING("Transfer of {} failed, tried again in {} ms", transfer->fileName,
+                      delay.count());
+
+    // The worker goes back to the pool meanwhile
+    scheduleRetry(session, std::chrono::steady_clock::now() + delay, [this, transfer]
+                  { this->tryTransfer(transfer); });
+}
+
+void AuthenticationDataLoader::scheduleRetry(std::shared_ptr<TargetSession> &session,
+                                             std::chrono::steady_clock::time_point deadline,
+                                             std::function<void()> task)
+{
+    ScheduledRetry retry;
+    retry.session = session;
+    retry.task = task;
+    bool wakeClientProcessor = false;
+    {
+        std::lock_guard<std::mutex> lock(clientProcessorMutex);
+        // Only a deadline earlier than every other one needs the client
+        // processor to wake up
+        wakeClientProcessor = scheduledRetries.empty() ||
+                              (deadline < scheduledRetries.begin()->first);
+        scheduledRetries.insert(std::make_pair(deadline, retry));
+        retriesMoved = retriesMoved || wakeClientProcessor;
+    }
+    if (wakeClientProcessor)
+    {
+        clientProcessorCV.notify_one();
+    }
+}
+
+void AuthenticationDataLoader::expediteRetries(std::shared_ptr<TargetSession> &session)
+{
+    bool wakeClientProcessor = false;
+    {
+        std::lock_guard<std::mutex> lock(clientProcessorMutex);
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        std::multimap<std::chrono::steady_clock::time_point, ScheduledRetry>::iterator it =
+            scheduledRetries.begin();
+        while (it != scheduledRetries.end())
+        {
+            if ((it->second.session != session) || (it->first <= now))
+            {
+                ++it;
+                continue;
+            }
+            ScheduledRetry retry = it->second;
+            it = scheduledRetries.erase(it);
+            scheduledRetries.insert(std::make_pair(now, retry));
+            wakeClientProcessor = true;
+        }
+        retriesMoved = retriesMoved || wakeClientProcessor;
+    }
+    if (wakeClientProcessor)
+    {
+        clientProcessorCV.notify_one();
+    }
+}
+
+void AuthenticationDataLoader::runDueRetries()
+{
+    std::vector<std::function<void()>> dueTasks;
+    {
+        std::lock_guard<std::mutex> lock(clientProcessorMutex);
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        while (!scheduledRetries.empty() && (scheduledRetries.begin()->first <= now))
+        {
+            dueTasks.push_back(scheduledRetries.begin()->second.task);
+            scheduledRetries.erase(scheduledRetries.begin());
+        }
+    }
+    for (std::vector<std::function<void()>>::iterator it = dueTasks.begin();
+         it != dueTasks.end(); ++it)
+    {
+        submitTask(*it);
+    }
+}
+
+TftpClientOperationResult AuthenticationDataLoader::targetHardwareErrorCallback(
+    short errorCode, std::string &errorMessage, void *context)
+{
+    if (context != nullptr)
+    {
+        TargetSession *session = static_cast<TargetSession *>(context);
+        std::string waitPrefix = std::string(AUTHENTICATION_WAIT_MSG_PREFIX) +
+                                 std::string(AUTHENTICATION_ERROR_MSG_DELIMITER);
+        if (errorMessage.compare(0, waitPrefix.length(), waitPrefix) == 0)
+        {
+            unsigned long waitTimeS = std::strtoul(errorMessage.c_str() + waitPrefix.length(),
+                                                   NULL, 10);
+            session->waitTimeS = static_cast<uint16_t>(
+                std::min(waitTimeS, static_cast<unsigned long>(UINT16_MAX)));
+        }
+    }
+    return TftpClientOperationResult::TFTP_CLIENT_OK;
+}
+
+void AuthenticationDataLoader::setStatusDeadline(std::shared_ptr<TargetSession> &session,
+                                                 std::chrono::milliseconds timeout)
+{
+    session->statusDeadline = std::chrono::steady_clock::now() + timeout;
+
+    // Only a deadline earlier than every other one needs the client
+    // processor to wake up
+    bool wakeClientProcessor = false;
+    {
+        std::lock_guard<std::mutex> lock(clientProcessorMutex);
+        if (session->statusDeadline < processorStatusDeadline)
+        {
+            processorStatusDeadline = session->statusDeadline;
+            statusDeadlineMoved = true;
+            wakeClientProcessor = true;
+        }
+    }
+    if (wakeClientProcessor)
+    {
+        clientProcessorCV.notify_one();
+    }
+}
+
+void AuthenticationDataLoader::endSession(std::shared_ptr<TargetSession> &session)
+{
+    AuthenticationOperationResult result;
+    {
+        std::lock_guard<std::mutex> lock(session->mutex);
+        if (session->endAuthentication)
+        {
+            return;
+        }
+        session->endAuthentication = true;
+        session->statusWatchdogArmed = false;
+        result = session->authenticationCompleted
+                     ? AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK
+                     : AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+        if (session->authenticationCompleted)
+        {
+            recordLatency(session, AuthenticationPhase::AUTHENTICATION_PHASE_TOTAL,
+                          std::chrono::steady_clock::now() - session->startedAt);
+        }
+        session->state = session->authenticationCompleted
+                             ? AuthenticationTargetState::AUTHENTICATION_TARGET_COMPLETED
+                             : AuthenticationTargetState::AUTHENTICATION_TARGET_FAILED;
+    }
+    expediteRetries(session);
+    BLSEC_LOG_INFO("Authentication of {} {}", session->baseFileName,
+                   (result == AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK)
+                       ? "completed"
+                       : "failed");
+
+    {
+        std::lock_guard<std::mutex> lock(activeSessionsMutex);
+        std::unordered_map<std::string, std::shared_ptr<TargetSession>>::iterator it =
+            activeSessions.find(session->baseFileName);
+        if ((it != activeSessions.end()) && (it->second == session))
+        {
+            activeSessions.erase(it);
+        }
+        endingSessions++;
+    }
+
+    if (session->completedCallback != nullptr)
+    {
+        session->completedCallback(session->targetHardwareId,
+                                   session->targetHardwarePosition,
+                                   result,
+                                   session->completedContext);
+    }
+    {
+        std::lock_guard<std::mutex> lock(activeSessionsMutex);
+        endingSessions--;
+    }
+    session->promise.set_value(result);
+}
 
-    // unsigned char *loadListFileBuffer = fileBuffer->data();
-    FILE *fpLoadListFile = fmemopen(fileBuffer->data(),
-                                    fileBuffer->size(), "r");
-    numTries = 0;
-    do
+std::shared_ptr<AuthenticationDataLoader::TargetSession> AuthenticationDataLoader::findSession(
+    std::string fileName)
+{
+    // Files are named <ID>_<POSITION>.<EXTENSION>
+    std::string baseFileName = fileName.substr(fileName.find_last_of("/") + 1);
+    baseFileName = baseFileName.substr(0, baseFileName.find_last_of("."));
+
+    std::lock_guard<std::mutex> lock(activeSessionsMutex);
+    std::unordered_map<std::string, std::shared_ptr<TargetSession>>::iterator it =
+        activeSessions.find(baseFileName);
+    if (it == activeSessions.end())
     {
-        fseek(fpLoadListFile, 0, SEEK_SET);
-        // TODO: Check for wait msg
-        resultTftpClientOperation = tftpClient->sendFile(
-            loadListFileName.c_str(), fpLoadListFile);
-        numTries++;
-    } while ((resultTftpClientOperation != TftpClientOperationResult::TFTP_CLIENT_OK) && (numTries < MAX_DLP_TRIES));
-    fclose(fpLoadListFile);
+        return nullptr;
+    }
+    return it->second;
+}
 
-    if (resultTftpClientOperation != TftpClientOperationResult::TFTP_CLIENT_OK)
+std::shared_ptr<AuthenticationDataLoader::TargetClient> AuthenticationDataLoader::acquireTargetClient(
+    TftpSectionId id)
+{
+    std::shared_ptr<TargetClient> targetClient = nullptr;
     {
-        endAuthentication = true;
-        clientProcessorCV.notify_one();
-        tftpServer->stopListening();
-        serverThread.join();
-        clientProcessorThread.join();
-        fileBuffer.reset();
-        return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+        std::lock_guard<std::mutex> lock(idleTargetClientsMutex);
+        if (!idleTargetClients.empty())
+        {
+            targetClient = std::move(idleTargetClients.back());
+            idleTargetClients.pop_back();
+        }
     }
 
-    /***************************************************************************
-                                   WAITING AUTHENTICATION
-    ***************************************************************************/
+    if (targetClient == nullptr)
     {
-        std::unique_lock<std::mutex> lock(endAuthenticationMutex);
-        endAuthenticationCV.wait(lock, [this]
-                                 { return endAuthentication; });
+        return std::make_shared<TargetClient>(id, &receiveBufferPool);
     }
+    targetClient->reset(id);
+    return targetClient;
+}
 
-    tftpServer->stopListening();
-    serverThread.join();
-    clientProcessorThread.join();
-    fileBuffer.reset();
+void AuthenticationDataLoader::releaseTargetClient(std::shared_ptr<TargetClient> &targetClient)
+{
+    // The buffer goes back to the pool now, the record once it is reused
+    targetClient->reset(TftpSectionId());
 
-    return authenticationCompleted ? AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK
-                                   : AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+    std::lock_guard<std::mutex> lock(idleTargetClientsMutex);
+    if (idleTargetClients.size() < receiveBufferPool.getCapacity())
+    {
+        idleTargetClients.push_back(std::move(targetClient));
+    }
+    targetClient = nullptr;
 }
 
 TftpServerOperationResult AuthenticationDataLoader::targetHardwareSectionStarted(
     ITFTPSection *sectionHandler, void *context)
 {
-    printf("Target hardware section started\n");
+    BLSEC_LOG_DEBUG("Target hardware section started");
     if (context != nullptr)
     {
         AuthenticationDataLoader *thiz =
             static_cast<AuthenticationDataLoader *>(context);
         TftpSectionId id;
         sectionHandler->getSectionId(&id);
-        std::shared_ptr<TargetClient> targetClient = std::make_shared<TargetClient>(id);
+        std::shared_ptr<TargetClient> targetClient = thiz->acquireTargetClient(id);
         {
             std::lock_guard<std::mutex> lock(thiz->targetClientsMutex);
             thiz->targetClients[id] = targetClient;
@@ -441,18 +1557,35 @@ TftpServerOperationResult AuthenticationDataLoader::targetHardwareSectionFinishe
             static_cast<AuthenticationDataLoader *>(context);
         TftpSectionId id;
         sectionHandler->getSectionId(&id);
+        std::shared_ptr<TargetClient> targetClient = nullptr;
         {
             std::lock_guard<std::mutex> lock(thiz->targetClientsMutex);
-            thiz->targetClients[id]->setSectionFinished();
+            std::unordered_map<TftpSectionId, std::shared_ptr<TargetClient>>::iterator it =
+                thiz->targetClients.find(id);
+            if (it != thiz->targetClients.end())
+            {
+                targetClient = it->second;
+                thiz->targetClients.erase(it);
+            }
+        }
+
+        // Only the push that finds the queue empty has to wake the processor.
+        // Taking its mutex makes sure it is not between checking the queue
+        // and going to sleep.
+        if ((targetClient != nullptr) && thiz->finishedClients.push(targetClient))
+        {
+            {
+                std::lock_guard<std::mutex> lock(thiz->clientProcessorMutex);
+            }
+            thiz->clientProcessorCV.notify_one();
         }
-        thiz->clientProcessorCV.notify_one();
     }
     return TftpServerOperationResult::TFTP_SERVER_OK;
 }
 
 AuthenticationOperationResult AuthenticationDataLoader::abortTargetRequest(
-    uint16_t abortSource, ITFTPSection *sectionHandler, char *filename,
-    char *mode)
+    uint16_t abortSource, std::shared_ptr<TargetSession> &session,
+    ITFTPSection *sectionHandler, char *filename, char *mode)
 {
     AuthenticationOperationResult result = AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
     
@@ -464,17 +1597,16 @@ AuthenticationOperationResult AuthenticationDataLoader::abortTargetRequest(
             std::string(LOAD_AUTHENTICATION_STATUS_FILE_EXTENSION);
 
         if (std::strcmp(mode, "w") == 0 &&
-            std::strstr(filename, lusExtension.c_str()) != nullptr)
+            std::strstr(filename, lusExtension.c_str()) != nullptr &&
+            session != nullptr)
         {
-            toggleAbortSend = !toggleAbortSend;
+            // Status files are told to abort and accepted in turn, so the
+            // one reporting the abort gets through
+            bool toggleAbortSend = !session->toggleAbortSend;
+            session->toggleAbortSend = toggleAbortSend;
             if (toggleAbortSend)
             {
-                std::stringstream errorMessageStream;
-                errorMessageStream << AUTHENTICATION_ABORT_MSG_PREFIX;
-                errorMessageStream << AUTHENTICATION_ERROR_MSG_DELIMITER;
-                errorMessageStream << std::hex << abortSource;
-                std::string errorMessage = errorMessageStream.str();
-                sectionHandler->setErrorMessage(errorMessage);
+                setAbortMessage(sectionHandler, abortSource);
             }
             else
             {
@@ -482,22 +1614,61 @@ AuthenticationOperationResult AuthenticationDataLoader::abortTargetRequest(
                 result = AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
             }
         }
+        else
+        {
+            // Any other request is the first chance to tell the abort
+            setAbortMessage(sectionHandler, abortSource);
+        }
     }
 
     return result;
 }
 
+uint16_t AuthenticationDataLoader::certificateAbortSource()
+{
+    // A session started after an abort reads its certificates even while
+    // the aborted ones are still to report it
+    uint16_t abortSource = AUTHENTICATION_ABORT_SOURCE_NONE;
+    std::lock_guard<std::mutex> lock(activeSessionsMutex);
+    for (std::unordered_map<std::string, std::shared_ptr<TargetSession>>::iterator it =
+             activeSessions.begin();
+         it != activeSessions.end(); ++it)
+    {
+        abortSource = it->second->abortSource;
+        if (abortSource == AUTHENTICATION_ABORT_SOURCE_NONE)
+        {
+            break;
+        }
+    }
+    return abortSource;
+}
+
 TftpServerOperationResult AuthenticationDataLoader::targetHardwareOpenFileRequest(
     ITFTPSection *sectionHandler, FILE **fp, char *filename, char *mode,
     size_t *bufferSize, void *context)
 {
-    printf("Target hardware open file request\n");
+    BLSEC_LOG_DEBUG("Target hardware open file request: {} ({})", filename, mode);
     AuthenticationDataLoader *thiz;
     if (context != nullptr)
     {
         thiz = static_cast<AuthenticationDataLoader *>(context);
 
-        if (thiz->abortTargetRequest(thiz->abortSource, sectionHandler,
+        // Certificates are shared by every target, only written files belong
+        // to a session
+        std::shared_ptr<TargetSession> session = nullptr;
+        if (std::strcmp(mode, "w") == 0)
+        {
+            session = thiz->findSession(std::string(filename));
+            if (session == nullptr)
+            {
+                (*fp) = NULL;
+                return TftpServerOperationResult::TFTP_SERVER_ERROR;
+            }
+        }
+
+        uint16_t abortSource = (session != nullptr) ? session->abortSource.load()
+                                                    : thiz->certificateAbortSource();
+        if (thiz->abortTargetRequest(abortSource, session, sectionHandler,
                                      filename, mode) == AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK)
         {
             (*fp) = NULL;
@@ -506,7 +1677,9 @@ TftpServerOperationResult AuthenticationDataLoader::targetHardwareOpenFileReques
 
         if (std::strcmp(mode, "r") == 0)
         {
-            *fp = fopen(filename, mode);
+            // The same certificate is requested by every target of a fleet
+            std::chrono::steady_clock::time_point readStart = std::chrono::steady_clock::now();
+            *fp = thiz->certificateCache.open(std::string(filename));
             if (bufferSize != nullptr)
             {
                 *bufferSize = 0;
@@ -538,6 +1711,18 @@ TftpServerOperationResult AuthenticationDataLoader::targetHardwareOpenFileReques
                 // baseFileName = baseFileName.substr(baseFileName.find_last_of("/") + 1);
                 thiz->_loadPrepareCallback(filename, fp, bufferSize, thiz->_loadPrepareContext);
             }
+
+            // Timed up to the close of the file, once the target hardware
+            // read it whole
+            TftpSectionId id;
+            sectionHandler->getSectionId(&id);
+            std::lock_guard<std::mutex> lock(thiz->targetClientsMutex);
+            std::unordered_map<TftpSectionId, std::shared_ptr<TargetClient>>::iterator it =
+                thiz->targetClients.find(id);
+            if (it != thiz->targetClients.end())
+            {
+                it->second->setReadStartedAt(readStart);
+            }
         }
         else
         {
@@ -545,11 +1730,17 @@ TftpServerOperationResult AuthenticationDataLoader::targetHardwareOpenFileReques
             sectionHandler->getSectionId(&id);
             {
                 std::lock_guard<std::mutex> lock(thiz->targetClientsMutex);
-                if (thiz->targetClients[id]->getClientFileBufferReference(fp) ==
-                    AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK)
+                std::unordered_map<TftpSectionId, std::shared_ptr<TargetClient>>::iterator it =
+                    thiz->targetClients.find(id);
+                if ((it == thiz->targetClients.end()) ||
+                    (it->second->getClientFileBufferReference(fp) !=
+                     AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK))
                 {
-                    thiz->targetClients[id]->setFileName(std::string(filename));
+                    (*fp) = NULL;
+                    return TftpServerOperationResult::TFTP_SERVER_ERROR;
                 }
+                it->second->setFileName(std::string(filename));
+                it->second->setSession(session);
             }
         }
 
@@ -570,135 +1761,581 @@ TftpServerOperationResult AuthenticationDataLoader::targetHardwareCloseFileReque
     {
         fclose(fp);
     }
+
+    if (context != nullptr)
+    {
+        AuthenticationDataLoader *thiz = static_cast<AuthenticationDataLoader *>(context);
+        TftpSectionId id;
+        sectionHandler->getSectionId(&id);
+        std::chrono::steady_clock::time_point readStartedAt;
+        bool read = false;
+        {
+            std::lock_guard<std::mutex> lock(thiz->targetClientsMutex);
+            std::unordered_map<TftpSectionId, std::shared_ptr<TargetClient>>::iterator it =
+                thiz->targetClients.find(id);
+            read = (it != thiz->targetClients.end()) &&
+                   (it->second->getReadStartedAt(readStartedAt) ==
+                    AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+        }
+        if (read)
+        {
+            std::shared_ptr<TargetSession> session = nullptr;
+            thiz->recordLatency(session, AuthenticationPhase::AUTHENTICATION_PHASE_CERTIFICATE_READ,
+                                std::chrono::steady_clock::now() - readStartedAt);
+        }
+    }
     return TftpServerOperationResult::TFTP_SERVER_OK;
 }
 
 AuthenticationOperationResult AuthenticationDataLoader::clientProcessor()
 {
-    while (!endAuthentication)
+    std::vector<std::shared_ptr<TargetClient>> clients;
+    std::vector<bool> superseded;
+    std::chrono::steady_clock::time_point statusDeadline = refreshStatusDeadline();
+    while (true)
     {
         /*********************** Wait for client event ***********************/
         {
             std::unique_lock<std::mutex> lock(clientProcessorMutex);
 
-            // TODO: Make Exception Timer from LAS and WAIT message override this
-            clientProcessorCV.wait_for(lock,
-                                       std::chrono::seconds(
-                                           DEFAULT_AUTHENTICATION_DLP_TIMEOUT));
+            // The deadline is moved earlier by sessions whose status timeout
+            // got shorter, such as after an Exception Timer
+            // Transfers tried again are woken up as well
+            std::chrono::steady_clock::time_point wakeUp = statusDeadline;
+            if (!scheduledRetries.empty() && (scheduledRetries.begin()->first < wakeUp))
+            {
+                wakeUp = scheduledRetries.begin()->first;
+            }
+            clientProcessorCV.wait_until(lock, wakeUp, [this]
+                                         { return !finishedClients.empty() || stopClientProcessor ||
+                                                  statusDeadlineMoved || retriesMoved; });
+            if (stopClientProcessor)
+            {
+                break;
+            }
+            statusDeadlineMoved = false;
+            retriesMoved = false;
+            statusDeadline = processorStatusDeadline;
         }
+        runDueRetries();
 
         /************************ Process client event ***********************/
-        endAuthentication = (targetClients.size() == 0);
+        // The whole batch is taken at once, nothing is locked while the
+        // files are processed
+        clients.clear();
+        finishedClients.drain(clients);
+        findSupersededStatusFiles(clients, superseded);
+        for (size_t i = 0; i < clients.size(); i++)
         {
-            std::lock_guard<std::mutex> lock(targetClientsMutex);
-            for (std::unordered_map<TftpSectionId, std::shared_ptr<TargetClient>>::iterator it = targetClients.begin();
-                 (it != targetClients.end()) && (!endAuthentication);)
+            bool hasDataToProcess;
+            std::shared_ptr<TargetSession> session;
+            clients[i]->hasDataToProcess(hasDataToProcess);
+            clients[i]->getSession(session);
+            if (superseded[i])
             {
-                bool sectionFinished, hasDataToProcess;
-                (*it).second->isSectionFinished(sectionFinished);
-                (*it).second->hasDataToProcess(hasDataToProcess);
-                if (sectionFinished)
-                {
-                    if (hasDataToProcess)
-                    {
-                        std::string fileName;
-                        char *buffer;
-                        (*it).second->getFileName(fileName);
-                        (*it).second->getClientBufferReference(&buffer);
-                        if (buffer != NULL)
-                        {
-                            processFile(fileName, buffer);
-                        }
-                    }
-                    it = targetClients.erase(it);
-                }
-                else
-                {
-                    ++it;
-                }
+                session->droppedStatusFiles++;
+            }
+            else if (hasDataToProcess && (session != nullptr))
+            {
+                std::string fileName;
+                const uint8_t *data;
+                size_t size;
+                clients[i]->getFileName(fileName);
+                clients[i]->getClientData(&data, size);
+                processFile(session, fileName, data, size);
             }
+            releaseTargetClient(clients[i]);
         }
-        filesProcessedCV.notify_one();
-    }
 
-    this->targetClients.clear();
-    endAuthenticationCV.notify_one();
+        /******************** End silent target hardwares ********************/
+        // Deadlines earlier than the earliest one are announced, so the
+        // sessions are only scanned when it expires
+        if (std::chrono::steady_clock::now() >= statusDeadline)
+        {
+            checkStatusDeadlines();
+            statusDeadline = refreshStatusDeadline();
+        }
+    }
 
+    clients.clear();
+    finishedClients.drain(clients);
     return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
 }
 
+void AuthenticationDataLoader::findSupersededStatusFiles(
+    const std::vector<std::shared_ptr<TargetClient>> &clients, std::vector<bool> &superseded)
+{
+    superseded.assign(clients.size(), false);
+
+    // Status files are snapshots, only the newest one of each target
+    // matters. Batches hold a few files, so they are compared pairwise.
+    std::vector<uint16_t> counters(clients.size(), 0);
+    std::vector<bool> isStatusFile(clients.size(), false);
+    for (size_t i = 0; i < clients.size(); i++)
+    {
+        bool hasDataToProcess;
+        std::shared_ptr<TargetSession> session;
+        std::string fileName;
+        const uint8_t *data;
+        size_t size;
+        clients[i]->hasDataToProcess(hasDataToProcess);
+        clients[i]->getSession(session);
+        if (!hasDataToProcess || (session == nullptr))
+        {
+            continue;
+        }
+        clients[i]->getFileName(fileName);
+        clients[i]->getClientData(&data, size);
+        if ((fileName.find(LOAD_AUTHENTICATION_STATUS_FILE_EXTENSION) == std::string::npos) ||
+            (LoadAuthenticationStatusView::peekCounter(data, size, counters[i]) !=
+             SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK))
+        {
+            continue;
+        }
+        // A malformed file is dropped when processed, it must not drop the
+        // valid ones before it
+        if (fileValidator.validate(data, size,
+                                   AuthenticationFileKind::AUTHENTICATION_FILE_KIND_LOAD_STATUS) !=
+            AuthenticationFileValidationResult::AUTHENTICATION_FILE_VALID)
+        {
+            continue;
+        }
+        isStatusFile[i] = true;
+
+        for (size_t j = 0; j < i; j++)
+        {
+            std::shared_ptr<TargetSession> otherSession;
+            clients[j]->getSession(otherSession);
+            if (!isStatusFile[j] || superseded[j] || (otherSession != session))
+            {
+                continue;
+            }
+            // Counters wrap around, the newest is the one ahead by less
+            // than half the range. On a tie the last received wins.
+            if (static_cast<int16_t>(counters[i] - counters[j]) >= 0)
+            {
+                superseded[j] = true;
+            }
+            else
+            {
+                superseded[i] = true;
+            }
+            break;
+        }
+    }
+}
+
+std::chrono::steady_clock::time_point AuthenticationDataLoader::refreshStatusDeadline()
+{
+    // Deadlines set while the sessions are scanned are kept: they are
+    // earlier than the cleared one
+    {
+        std::lock_guard<std::mutex> lock(clientProcessorMutex);
+        processorStatusDeadline = std::chrono::steady_clock::time_point::max();
+    }
+    std::chrono::steady_clock::time_point deadline = nextStatusDeadline();
+    std::lock_guard<std::mutex> lock(clientProcessorMutex);
+    processorStatusDeadline = std::min(processorStatusDeadline, deadline);
+    statusDeadlineMoved = false;
+    return processorStatusDeadline;
+}
+
+std::chrono::steady_clock::time_point AuthenticationDataLoader::nextStatusDeadline()
+{
+    std::chrono::steady_clock::time_point deadline =
+        std::chrono::steady_clock::now() +
+        std::chrono::seconds(DEFAULT_AUTHENTICATION_DLP_TIMEOUT);
+
+    std::lock_guard<std::mutex> lock(activeSessionsMutex);
+    for (std::unordered_map<std::string, std::shared_ptr<TargetSession>>::iterator it =
+             activeSessions.begin();
+         it != activeSessions.end(); ++it)
+    {
+        std::lock_guard<std::mutex> sessionLock(it->second->mutex);
+        if (it->second->statusWatchdogArmed && (it->second->statusDeadline < deadline))
+        {
+            deadline = it->second->statusDeadline;
+        }
+    }
+    return deadline;
+}
+
+void AuthenticationDataLoader::checkStatusDeadlines()
+{
+    std::vector<std::shared_ptr<TargetSession>> expiredSessions;
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    {
+        std::lock_guard<std::mutex> lock(activeSessionsMutex);
+        for (std::unordered_map<std::string, std::shared_ptr<TargetSession>>::iterator it =
+                 activeSessions.begin();
+             it != activeSessions.end(); ++it)
+        {
+            std::lock_guard<std::mutex> sessionLock(it->second->mutex);
+            if (it->second->statusWatchdogArmed && (it->second->statusDeadline <= now))
+            {
+                expiredSessions.push_back(it->second);
+            }
+        }
+    }
+
+    // A target hardware that stopped sending status files is given up
+    for (std::vector<std::shared_ptr<TargetSession>>::iterator it = expiredSessions.begin();
+         it != expiredSessions.end(); ++it)
+    {
+        endSession(*it);
+    }
+}
+
 AuthenticationOperationResult AuthenticationDataLoader::processFile(
-    std::string fileName, char *buffer)
+    std::shared_ptr<TargetSession> &session, std::string fileName,
+    const uint8_t *data, size_t size)
 {
     if (fileName.find(LOAD_AUTHENTICATION_STATUS_FILE_EXTENSION) != std::string::npos)
     {
-        return processLoadAuthenticationStatusFile(buffer);
+        return processLoadAuthenticationStatusFile(session, data, size);
     }
     return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
 }
 
 AuthenticationOperationResult AuthenticationDataLoader::processLoadAuthenticationStatusFile(
-    char *buffer)
+    std::shared_ptr<TargetSession> &session, const uint8_t *data, size_t size)
 {
-    std::shared_ptr<std::vector<uint8_t>> data =
-        std::make_shared<std::vector<uint8_t>>(buffer,
-                                               buffer + MAX_CERTIFICATE_BUFFER_SIZE);
+    // Retransmitted and reordered status files are dropped from their
+    // counter alone. Only the client processor applies status files, so the
+    // counter can not change before this one is applied.
+    uint16_t counter = 0;
+    if (LoadAuthenticationStatusView::peekCounter(data, size, counter) ==
+        SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK)
+    {
+        std::lock_guard<std::mutex> lock(session->mutex);
+        if (session->statusReceived)
+        {
+            int16_t ahead = static_cast<int16_t>(counter - session->statusCounter);
+            if (ahead == 0)
+            {
+                session->duplicateStatusFiles++;
+                return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+            }
+            if (ahead < 0)
+            {
+                session->droppedStatusFiles++;
+                return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+            }
+        }
+    }
 
-    std::string baseFileName = targetHardwareId + std::string("_") + targetHardwarePosition;
-    std::string statusFileName = baseFileName + std::string(LOAD_AUTHENTICATION_STATUS_FILE_EXTENSION);
-    LoadAuthenticationStatusFile loadAuthenticationStatusFile(statusFileName);
-    loadAuthenticationStatusFile.deserialize(data);
+    // Malformed files are dropped before anything is read from them
+    if (fileValidator.validate(data, size,
+                               AuthenticationFileKind::AUTHENTICATION_FILE_KIND_LOAD_STATUS) !=
+        AuthenticationFileValidationResult::AUTHENTICATION_FILE_VALID)
+    {
+        return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+    }
+
+    // Only the status code is needed to drive the authentication, so it is
+    // read straight from the received buffer.
+    LoadAuthenticationStatusView loadAuthenticationStatusView;
+    if (loadAuthenticationStatusView.parse(data, size) !=
+        SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK)
+    {
+        return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+    }
 
     if (_authenticationInformationStatusCallback != nullptr)
     {
+        // The JSON report needs the whole file, decode it only if someone is
+        // listening. It is decoded straight from the received buffer.
+        uint32_t fileLength = 0;
+        loadAuthenticationStatusView.getFileLength(fileLength);
+
+        std::string statusFileName = session->baseFileName + std::string(LOAD_AUTHENTICATION_STATUS_FILE_EXTENSION);
+        LoadAuthenticationStatusFile loadAuthenticationStatusFile(statusFileName);
+        loadAuthenticationStatusFile.deserializeFrom(data, fileLength);
+
         std::string jsonResponse("");
         loadAuthenticationStatusFile.serializeJSON(jsonResponse);
-        printf("\n\n REPORT STATUS \n\n");
         _authenticationInformationStatusCallback(
             jsonResponse,
             _authenticationInformationStatusContext);
     }
 
     uint16_t authenticationOperationStatusCode;
-    loadAuthenticationStatusFile.getAuthenticationOperationStatusCode(authenticationOperationStatusCode);
-    switch (authenticationOperationStatusCode)
+    loadAuthenticationStatusView.getAuthenticationOperationStatusCode(authenticationOperationStatusCode);
+    BLSEC_LOG_DEBUG("Status file of {}: status {}", session->baseFileName,
+                    authenticationOperationStatusCode);
+    bool sendLoadListNow = false;
+    bool endAuthentication = false;
+    {
+        std::lock_guard<std::mutex> lock(session->mutex);
+        updateLoadProgress(session, loadAuthenticationStatusView);
+        session->statusReceived = true;
+        session->statusCounter = counter;
+        uint16_t exceptionTimer = 0;
+        uint16_t estimatedTime = 0;
+        loadAuthenticationStatusView.getExceptionTimer(exceptionTimer);
+        loadAuthenticationStatusView.getEstimatedTime(estimatedTime);
+        setStatusDeadline(session, session->retryPolicy->statusTimeout(exceptionTimer, estimatedTime));
+        switch (authenticationOperationStatusCode)
+        {
+        case STATUS_AUTHENTICATION_ACCEPTED:
+            session->authenticationInitializationAccepted = true;
+            if (session->authenticationInitialized && !session->loadListScheduled &&
+                !session->cancelled)
+            {
+                recordLatency(session, AuthenticationPhase::AUTHENTICATION_PHASE_ACCEPTANCE_WAIT,
+                              std::chrono::steady_clock::now() - session->initializedAt);
+                session->loadListScheduled = true;
+                sendLoadListNow = true;
+            }
+            break;
+        case STATUS_AUTHENTICATION_COMPLETED:
+            // Completed before the send of the load list was even over
+            recordLatency(session, AuthenticationPhase::AUTHENTICATION_PHASE_COMPLETION_WAIT,
+                          (session->loadListSentAt == std::chrono::steady_clock::time_point())
+                              ? std::chrono::steady_clock::duration::zero()
+                              : std::chrono::steady_clock::now() - session->loadListSentAt);
+            session->authenticationCompleted = true;
+            endAuthentication = true;
+            break;
+        case STATUS_AUTHENTICATION_ABORTED_BY_THE_TARGET_HARDWARE:
+        case STATUS_AUTHENTICATION_ABORTED_IN_THE_TARGET_DL_REQUEST:
+        case STATUS_AUTHENTICATION_ABORTED_IN_THE_TARGET_OP_REQUEST:
+            endAuthentication = true;
+            break;
+        default:
+            break;
+        }
+    }
+
+    if (sendLoadListNow)
+    {
+        std::shared_ptr<TargetSession> acceptedSession = session;
+        submitTask([this, acceptedSession]
+                   { this->sendLoadList(acceptedSession); });
+    }
+    if (endAuthentication)
+    {
+        endSession(session);
+    }
+
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
+void AuthenticationDataLoader::updateLoadProgress(
+    std::shared_ptr<TargetSession> &session,
+    const LoadAuthenticationStatusView &loadAuthenticationStatusView)
+{
+    loadAuthenticationStatusView.getLoadListRatio(session->loadListRatio);
+
+    // Targets usually report the loads in load list order, so the next
+    // load is checked before searching the whole list
+    std::vector<AuthenticationLoadProgress> &loadProgress = session->loadProgress;
+    size_t nextLoad = 0;
+    for (LoadAuthenticationStatusView::HeaderFileIterator it = loadAuthenticationStatusView.begin();
+         it != loadAuthenticationStatusView.end(); ++it)
     {
-    case STATUS_AUTHENTICATION_ACCEPTED:
-        authenticationInitializationAccepted = true;
-        break;
-    case STATUS_AUTHENTICATION_COMPLETED:
-        authenticationCompleted = true;
-        endAuthentication = true;
-        endAuthenticationCV.notify_one();
-        break;
-    case STATUS_AUTHENTICATION_ABORTED_BY_THE_TARGET_HARDWARE:
-    case STATUS_AUTHENTICATION_ABORTED_IN_THE_TARGET_DL_REQUEST:
-    case STATUS_AUTHENTICATION_ABORTED_IN_THE_TARGET_OP_REQUEST:
-        endAuthentication = true;
-        endAuthenticationCV.notify_one();
-        break;
-    default:
-        break;
+        AuthenticationFieldView headerFileName;
+        it->getHeaderFileName(headerFileName);
+        size_t load = nextLoad;
+        if ((load >= loadProgress.size()) ||
+            !headerFileName.equals(loadProgress[load].headerFileName))
+        {
+            for (load = 0; load < loadProgress.size(); load++)
+            {
+                if (headerFileName.equals(loadProgress[load].headerFileName))
+                {
+                    break;
+                }
+            }
+            if (load == loadProgress.size())
+            {
+                // Not a load of this authentication
+                continue;
+            }
+        }
+
+        AuthenticationFieldView loadStatusDescription;
+        it->getLoadStatus(loadProgress[load].loadStatus);
+        it->getLoadRatio(loadProgress[load].loadRatio);
+        it->getLoadStatusDescription(loadStatusDescription);
+        loadProgress[load].loadStatusDescription = loadStatusDescription.toString();
+        nextLoad = load + 1;
+    }
+}
+
+AuthenticationDataLoader::TargetSession::TargetSession(
+    std::string targetHardwareId, std::string targetHardwarePosition,
+    std::string targetHardwareIp, std::vector<AuthenticationLoad> loadList)
+{
+    this->targetHardwareId = targetHardwareId;
+    this->targetHardwarePosition = targetHardwarePosition;
+    this->targetHardwareIp = targetHardwareIp;
+    this->baseFileName = targetHardwareId + std::string("_") + targetHardwarePosition;
+    this->loadList = loadList;
+
+    retryPolicy = nullptr;
+    completedCallback = nullptr;
+    completedContext = NULL;
+    reset();
+}
+
+AuthenticationDataLoader::TargetSession::~TargetSession()
+{
+    loadList.clear();
+}
+
+void AuthenticationDataLoader::TargetSession::reset()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    state = AuthenticationTargetState::AUTHENTICATION_TARGET_PENDING;
+    toggleAbortSend = false;
+    abortSource = AUTHENTICATION_ABORT_SOURCE_NONE;
+    cancelled = false;
+    retries = 0;
+    waits = 0;
+    waitTimeS = 0;
+    duplicateStatusFiles = 0;
+    droppedStatusFiles = 0;
+    promise = std::promise<AuthenticationOperationResult>();
+    future = promise.get_future().share();
+    initializationRequested = false;
+    authenticationInitializationAccepted = false;
+    authenticationInitialized = false;
+    loadListScheduled = false;
+    authenticationCompleted = false;
+    endAuthentication = false;
+    statusWatchdogArmed = false;
+    statusReceived = false;
+    statusCounter = 0;
+    loadProgress.resize(loadList.size());
+    for (size_t i = 0; i < loadList.size(); i++)
+    {
+        loadProgress[i].headerFileName = std::get<LOAD_FILE_NAME_IDX>(loadList[i]);
+        loadProgress[i].loadPartNumberName = std::get<LOAD_PART_NUMBER_IDX>(loadList[i]);
+        loadProgress[i].loadStatus = 0;
+        loadProgress[i].loadRatio = 0;
+        loadProgress[i].loadStatusDescription.clear();
     }
+    loadListRatio = 0;
+    initializedAt = std::chrono::steady_clock::time_point();
+    loadListSentAt = std::chrono::steady_clock::time_point();
+}
 
+AuthenticationHandle::AuthenticationHandle(
+    std::shared_ptr<AuthenticationDataLoader::TargetSession> session,
+    std::weak_ptr<AuthenticationDataLoader::HandleAnchor> anchor)
+{
+    this->session = session;
+    this->anchor = anchor;
+}
+
+AuthenticationHandle::~AuthenticationHandle()
+{
+    session.reset();
+}
+
+AuthenticationOperationResult AuthenticationHandle::getState(AuthenticationTargetState &state)
+{
+    state = session->state;
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
+AuthenticationOperationResult AuthenticationHandle::getLoadProgress(
+    std::vector<AuthenticationLoadProgress> &loadProgress, uint32_t &loadListRatio)
+{
+    std::lock_guard<std::mutex> lock(session->mutex);
+    loadProgress = session->loadProgress;
+    loadListRatio = session->loadListRatio;
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
+AuthenticationOperationResult AuthenticationHandle::getRetryStatistics(uint32_t &retries,
+                                                                      uint32_t &waits)
+{
+    retries = session->retries;
+    waits = session->waits;
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
+AuthenticationOperationResult AuthenticationHandle::getStatusStatistics(uint32_t &duplicates,
+                                                                       uint32_t &dropped)
+{
+    duplicates = session->duplicateStatusFiles;
+    dropped = session->droppedStatusFiles;
     return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
 }
 
-AuthenticationDataLoader::TargetClient::TargetClient(SectionId clientId)
+std::shared_future<AuthenticationOperationResult> AuthenticationHandle::getFuture()
+{
+    return session->future;
+}
+
+AuthenticationOperationResult AuthenticationHandle::cancel(uint16_t abortSource)
+{
+    {
+        std::lock_guard<std::mutex> lock(session->mutex);
+        if (session->endAuthentication)
+        {
+            return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+        }
+    }
+
+    // The DataLoader may be destroyed already, or while it is used here
+    std::shared_ptr<AuthenticationDataLoader::HandleAnchor> anchor = this->anchor.lock();
+    if (anchor == nullptr)
+    {
+        return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+    }
+    AuthenticationDataLoader *dataLoader = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(anchor->mutex);
+        if (anchor->dataLoader == nullptr)
+        {
+            return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+        }
+        dataLoader = anchor->dataLoader;
+        anchor->users++;
+    }
+
+    // The workers stop before sending anything else, and the next status
+    // file of the target hardware is answered with an abort
+    bool endNow = false;
+    AuthenticationOperationResult result = dataLoader->abortSession(session, abortSource, endNow);
+    if ((result == AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK) && endNow)
+    {
+        dataLoader->endSession(session);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(anchor->mutex);
+        anchor->users--;
+    }
+    anchor->cv.notify_all();
+    return result;
+}
+
+AuthenticationDataLoader::TargetClient::TargetClient(SectionId clientId,
+                                                   AuthenticationBufferPool *bufferPool)
+    : clientFile(bufferPool)
 {
     this->clientId = clientId;
-    clientFileBuffer = NULL;
-    sectionFinished = false;
     fileName = "";
+    session = nullptr;
+    reading = false;
 }
 
 AuthenticationDataLoader::TargetClient::~TargetClient()
 {
-    if (clientFileBuffer != NULL)
-    {
-        free(clientFileBuffer);
-        clientFileBuffer = NULL;
-    }
+    reset(clientId);
+}
+
+void AuthenticationDataLoader::TargetClient::reset(TftpSectionId clientId)
+{
+    clientFile.clear();
+    this->clientId = clientId;
+    fileName.clear();
+    session = nullptr;
+    reading = false;
 }
 
 AuthenticationOperationResult AuthenticationDataLoader::TargetClient::getClientId(
@@ -711,12 +2348,7 @@ AuthenticationOperationResult AuthenticationDataLoader::TargetClient::getClientI
 AuthenticationOperationResult AuthenticationDataLoader::TargetClient::getClientFileBufferReference(
     FILE **fp)
 {
-    if (clientFileBuffer == NULL)
-    {
-        clientFileBuffer = (char *)malloc(MAX_CERTIFICATE_BUFFER_SIZE);
-    }
-
-    *fp = fmemopen(clientFileBuffer, MAX_CERTIFICATE_BUFFER_SIZE, "w");
+    *fp = clientFile.open("w");
     if (*fp == NULL)
     {
         return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
@@ -726,10 +2358,11 @@ AuthenticationOperationResult AuthenticationDataLoader::TargetClient::getClientF
     return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
 }
 
-AuthenticationOperationResult AuthenticationDataLoader::TargetClient::getClientBufferReference(
-    char **buffer)
+AuthenticationOperationResult AuthenticationDataLoader::TargetClient::getClientData(
+    const uint8_t **data, size_t &size)
 {
-    *buffer = clientFileBuffer;
+    *data = clientFile.getData();
+    size = clientFile.getSize();
     return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
 }
 
@@ -747,22 +2380,42 @@ AuthenticationOperationResult AuthenticationDataLoader::TargetClient::getFileNam
     return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
 }
 
-AuthenticationOperationResult AuthenticationDataLoader::TargetClient::setSectionFinished()
+AuthenticationOperationResult AuthenticationDataLoader::TargetClient::setSession(
+    std::shared_ptr<TargetSession> session)
 {
-    this->sectionFinished = true;
+    this->session = session;
     return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
 }
 
-AuthenticationOperationResult AuthenticationDataLoader::TargetClient::isSectionFinished(
-    bool &sectionFinished)
+AuthenticationOperationResult AuthenticationDataLoader::TargetClient::getSession(
+    std::shared_ptr<TargetSession> &session)
 {
-    sectionFinished = this->sectionFinished;
+    session = this->session;
     return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
 }
 
 AuthenticationOperationResult AuthenticationDataLoader::TargetClient::hasDataToProcess(
     bool &hasDataToProcess)
 {
-    hasDataToProcess = (clientFileBuffer != NULL);
+    hasDataToProcess = (clientFile.getSize() > 0);
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
+AuthenticationOperationResult AuthenticationDataLoader::TargetClient::setReadStartedAt(
+    std::chrono::steady_clock::time_point readStartedAt)
+{
+    this->readStartedAt = readStartedAt;
+    reading = true;
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
+AuthenticationOperationResult AuthenticationDataLoader::TargetClient::getReadStartedAt(
+    std::chrono::steady_clock::time_point &readStartedAt)
+{
+    if (!reading)
+    {
+        return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+    }
+    readStartedAt = this->readStartedAt;
     return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
 }
\ No newline at end of file
@@ -0,0 +1,271 @@
+#include "AuthenticationFileCache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <sys/stat.h>
+
+namespace
+{
+    // Read-only FILE on cached content, which it keeps alive until closed
+    struct CachedFileCookie
+    {
+        std::shared_ptr<const std::vector<uint8_t>> content;
+        size_t position;
+    };
+
+    ssize_t readCachedFile(void *cookie, char *data, size_t size)
+    {
+        CachedFileCookie *file = static_cast<CachedFileCookie *>(cookie);
+        if (file->position >= file->content->size())
+        {
+            return 0;
+        }
+        size_t readSize = std::min(size, file->content->size() - file->position);
+        std::memcpy(data, file->content->data() + file->position, readSize);
+        file->position += readSize;
+        return readSize;
+    }
+
+    int seekCachedFile(void *cookie, off64_t *offset, int whence)
+    {
+        CachedFileCookie *file = static_cast<CachedFileCookie *>(cookie);
+        off64_t newPosition = *offset;
+        switch (whence)
+        {
+        case SEEK_SET:
+            break;
+        case SEEK_CUR:
+            newPosition += file->position;
+            break;
+        case SEEK_END:
+            newPosition += file->content->size();
+            break;
+        default:
+            return -1;
+        }
+        if ((newPosition < 0) || (static_cast<size_t>(newPosition) > file->content->size()))
+        {
+            return -1;
+        }
+
+        file->position = newPosition;
+        *offset = newPosition;
+        return 0;
+    }
+
+    int closeCachedFile(void *cookie)
+    {
+        delete static_cast<CachedFileCookie *>(cookie);
+        return 0;
+    }
+
+    bool sameTime(const struct timespec &a, const struct timespec &b)
+    {
+        return (a.tv_sec == b.tv_sec) && (a.tv_nsec == b.tv_nsec);
+    }
+}
+
+AuthenticationFileCache::AuthenticationFileCache(size_t budget)
+{
+    this->budget = budget;
+    size = 0;
+    hits = 0;
+    misses = 0;
+    evictions = 0;
+}
+
+AuthenticationFileCache::~AuthenticationFileCache()
+{
+}
+
+FILE *AuthenticationFileCache::open(const std::string &path)
+{
+    bool cacheable = true;
+    Content content = lookup(path, cacheable);
+    if (content == nullptr)
+    {
+        // Too large to be cached, or changing while it was read
+        return cacheable ? NULL : fopen(path.c_str(), "r");
+    }
+
+    CachedFileCookie *cookie = new CachedFileCookie();
+    cookie->content = content;
+    cookie->position = 0;
+
+    cookie_io_functions_t functions;
+    functions.read = readCachedFile;
+    functions.write = NULL;
+    functions.seek = seekCachedFile;
+    functions.close = closeCachedFile;
+    FILE *fp = fopencookie(cookie, "r", functions);
+    if (fp == NULL)
+    {
+        delete cookie;
+    }
+    return fp;
+}
+
+bool AuthenticationFileCache::preload(const std::string &path)
+{
+    bool cacheable = true;
+    return lookup(path, cacheable) != nullptr;
+}
+
+void AuthenticationFileCache::setBudget(size_t budget)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    this->budget = budget;
+    evict(budget);
+}
+
+size_t AuthenticationFileCache::getBudget()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return budget;
+}
+
+size_t AuthenticationFileCache::getSize()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return size;
+}
+
+void AuthenticationFileCache::getStatistics(uint64_t &hits, uint64_t &misses,
+                                            uint64_t &evictions)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    hits = this->hits;
+    misses = this->misses;
+    evictions = this->evictions;
+}
+
+void AuthenticationFileCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+    lru.clear();
+    size = 0;
+}
+
+AuthenticationFileCache::Content AuthenticationFileCache::lookup(const std::string &path,
+                                                                 bool &cacheable)
+{
+    // Checking the file is still the one cached costs a stat(), not an open
+    struct stat fileStatus;
+    bool exists = (stat(path.c_str(), &fileStatus) == 0) && S_ISREG(fileStatus.st_mode);
+    size_t currentBudget;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::unordered_map<std::string, Entry>::iterator it = entries.find(path);
+        if (it != entries.end())
+        {
+            if (exists && (it->second.size == fileStatus.st_size) &&
+                sameTime(it->second.modificationTime, fileStatus.st_mtim))
+            {
+                hits++;
+                lru.splice(lru.begin(), lru, it->second.lruPosition);
+                return it->second.content;
+            }
+
+            size -= it->second.content->size();
+            lru.erase(it->second.lruPosition);
+            entries.erase(it);
+        }
+        if (!exists)
+        {
+            return nullptr;
+        }
+        misses++;
+        currentBudget = budget;
+    }
+
+    if (static_cast<size_t>(fileStatus.st_size) > currentBudget)
+    {
+        cacheable = false;
+        return nullptr;
+    }
+
+    // Read without the lock, other files are served meanwhile
+    struct timespec modificationTime;
+    off_t fileSize;
+    Content content = readFile(path, modificationTime, fileSize);
+    if (content == nullptr)
+    {
+        cacheable = false;
+        return nullptr;
+    }
+    insert(path, content, modificationTime, fileSize);
+    return content;
+}
+
+AuthenticationFileCache::Content AuthenticationFileCache::readFile(
+    const std::string &path, struct timespec &modificationTime, off_t &size)
+{
+    FILE *fp = fopen(path.c_str(), "r");
+    if (fp == NULL)
+    {
+        return nullptr;
+    }
+
+    struct stat fileStatus;
+    if (fstat(fileno(fp), &fileStatus) != 0)
+    {
+        fclose(fp);
+        return nullptr;
+    }
+
+    // One byte more than expected tells a file growing while it is read
+    std::shared_ptr<std::vector<uint8_t>> content =
+        std::make_shared<std::vector<uint8_t>>(fileStatus.st_size + 1);
+    size_t readSize = fread(content->data(), 1, content->size(), fp);
+    fclose(fp);
+    if (readSize != static_cast<size_t>(fileStatus.st_size))
+    {
+        return nullptr;
+    }
+    content->resize(readSize);
+
+    modificationTime = fileStatus.st_mtim;
+    size = fileStatus.st_size;
+    return content;
+}
+
+void AuthenticationFileCache::insert(const std::string &path, Content content,
+                                     const struct timespec &modificationTime, off_t size)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (content->size() > budget)
+    {
+        return;
+    }
+
+    // Another thread may have read the same file meanwhile
+    std::unordered_map<std::string, Entry>::iterator it = entries.find(path);
+    if (it != entries.end())
+    {
+        this->size -= it->second.content->size();
+        lru.erase(it->second.lruPosition);
+        entries.erase(it);
+    }
+
+    evict(budget - content->size());
+    lru.push_front(path);
+    Entry &entry = entries[path];
+    entry.content = content;
+    entry.modificationTime = modificationTime;
+    entry.size = size;
+    entry.lruPosition = lru.begin();
+    this->size += content->size();
+}
+
+void AuthenticationFileCache::evict(size_t budget)
+{
+    while ((size > budget) && !lru.empty())
+    {
+        std::unordered_map<std::string, Entry>::iterator it = entries.find(lru.back());
+        size -= it->second.content->size();
+        entries.erase(it);
+        lru.pop_back();
+        evictions++;
+    }
+}
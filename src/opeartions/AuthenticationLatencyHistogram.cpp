@@ -0,0 +1,128 @@
+#include "AuthenticationLatencyHistogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+AuthenticationLatencyHistogram::AuthenticationLatencyHistogram()
+{
+    reset();
+}
+
+AuthenticationLatencyHistogram::~AuthenticationLatencyHistogram()
+{
+}
+
+void AuthenticationLatencyHistogram::record(std::chrono::nanoseconds latency)
+{
+    uint64_t nanoseconds = (latency.count() > 0) ? static_cast<uint64_t>(latency.count()) : 0;
+    nanoseconds = std::min(nanoseconds, (static_cast<uint64_t>(1) << LATENCY_HISTOGRAM_MAX_BITS) - 1);
+
+    buckets[getBucket(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+    sum.fetch_add(nanoseconds, std::memory_order_relaxed);
+
+    uint64_t current = min.load(std::memory_order_relaxed);
+    while ((nanoseconds < current) &&
+           !min.compare_exchange_weak(current, nanoseconds, std::memory_order_relaxed))
+    {
+    }
+    current = max.load(std::memory_order_relaxed);
+    while ((nanoseconds > current) &&
+           !max.compare_exchange_weak(current, nanoseconds, std::memory_order_relaxed))
+    {
+    }
+
+    // Counted last, so a reader never sees more latencies than buckets filled
+    count.fetch_add(1, std::memory_order_release);
+}
+
+uint64_t AuthenticationLatencyHistogram::getCount() const
+{
+    return count.load(std::memory_order_acquire);
+}
+
+std::chrono::nanoseconds AuthenticationLatencyHistogram::getPercentile(double percentile) const
+{
+    uint64_t total = getCount();
+    if (total == 0)
+    {
+        return std::chrono::nanoseconds(0);
+    }
+
+    percentile = std::min(std::max(percentile, 0.0), 100.0);
+    uint64_t rank = static_cast<uint64_t>(std::ceil(percentile / 100.0 * total));
+    rank = std::max(rank, static_cast<uint64_t>(1));
+
+    uint64_t seen = 0;
+    uint64_t highest = max.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < LATENCY_HISTOGRAM_BUCKETS; i++)
+    {
+        seen += buckets[i].load(std::memory_order_relaxed);
+        if (seen >= rank)
+        {
+            // No bucket reports more than the highest latency recorded
+            return std::chrono::nanoseconds(std::min(getBucketUpperBound(i), highest));
+        }
+    }
+    return std::chrono::nanoseconds(highest);
+}
+
+void AuthenticationLatencyHistogram::getSummary(AuthenticationLatencySummary &summary) const
+{
+    summary.count = getCount();
+    if (summary.count == 0)
+    {
+        summary.min = summary.max = summary.mean = std::chrono::nanoseconds(0);
+        summary.p50 = summary.p90 = summary.p99 = std::chrono::nanoseconds(0);
+        return;
+    }
+
+    summary.min = std::chrono::nanoseconds(min.load(std::memory_order_relaxed));
+    summary.max = std::chrono::nanoseconds(max.load(std::memory_order_relaxed));
+    summary.mean = std::chrono::nanoseconds(sum.load(std::memory_order_relaxed) / summary.count);
+    summary.p50 = getPercentile(50);
+    summary.p90 = getPercentile(90);
+    summary.p99 = getPercentile(99);
+}
+
+void AuthenticationLatencyHistogram::reset()
+{
+    for (size_t i = 0; i < LATENCY_HISTOGRAM_BUCKETS; i++)
+    {
+        buckets[i].store(0, std::memory_order_relaxed);
+    }
+    sum.store(0, std::memory_order_relaxed);
+    min.store(UINT64_MAX, std::memory_order_relaxed);
+    max.store(0, std::memory_order_relaxed);
+    count.store(0, std::memory_order_release);
+}
+
+size_t AuthenticationLatencyHistogram::getBucket(uint64_t nanoseconds)
+{
+    if (nanoseconds < LATENCY_HISTOGRAM_SUB_BUCKETS)
+    {
+        return static_cast<size_t>(nanoseconds);
+    }
+
+    // Power of two of the latency, then its linear sub-bucket
+    size_t exponent = 63 - __builtin_clzll(nanoseconds);
+    if (exponent >= LATENCY_HISTOGRAM_MAX_BITS)
+    {
+        return LATENCY_HISTOGRAM_BUCKETS - 1;
+    }
+    size_t shift = exponent - LATENCY_HISTOGRAM_SUB_BUCKET_BITS;
+    size_t subBucket = (nanoseconds >> shift) & (LATENCY_HISTOGRAM_SUB_BUCKETS - 1);
+    return (shift + 1) * LATENCY_HISTOGRAM_SUB_BUCKETS + subBucket;
+}
+
+uint64_t AuthenticationLatencyHistogram::getBucketUpperBound(size_t bucket)
+{
+    if (bucket < LATENCY_HISTOGRAM_SUB_BUCKETS)
+    {
+        return bucket;
+    }
+
+    size_t shift = bucket / LATENCY_HISTOGRAM_SUB_BUCKETS - 1;
+    uint64_t subBucket = bucket % LATENCY_HISTOGRAM_SUB_BUCKETS;
+    uint64_t lowerBound = (LATENCY_HISTOGRAM_SUB_BUCKETS + subBucket) << shift;
+    return lowerBound + (static_cast<uint64_t>(1) << shift) - 1;
+}
@@ -0,0 +1,227 @@
+#include "AuthenticationLog.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <ctime>
+
+static const char *levelNames[] = {"TRACE", "DEBUG", "INFO", "WARNING", "ERROR", "NONE"};
+
+AuthenticationLog &AuthenticationLog::getInstance()
+{
+    static AuthenticationLog instance;
+    return instance;
+}
+
+AuthenticationLog::AuthenticationLog()
+{
+    level = std::max(AUTHENTICATION_LOG_DEFAULT_LEVEL, BLSEC_LOG_LEVEL);
+    droppedRecords = 0;
+    nextThread = 0;
+    pendingRecords = 0;
+    sink = nullptr;
+    sinkContext = nullptr;
+    stopDrainer = false;
+    drainerThread = std::thread([this]
+                                { this->drainer(); });
+}
+
+AuthenticationLog::~AuthenticationLog()
+{
+    {
+        std::lock_guard<std::mutex> lock(drainerMutex);
+        stopDrainer = true;
+    }
+    drainerCV.notify_one();
+    drainerThread.join();
+
+    // Whatever was logged after the last pass
+    drain();
+}
+
+void AuthenticationLog::setLevel(AuthenticationLogLevel level)
+{
+    this->level = std::max(static_cast<int>(level), BLSEC_LOG_LEVEL);
+}
+
+void AuthenticationLog::setSink(authenticationLogSink sink, void *context)
+{
+    std::lock_guard<std::mutex> lock(drainMutex);
+    this->sink = sink;
+    sinkContext = context;
+}
+
+void AuthenticationLog::flush()
+{
+    drain();
+}
+
+uint64_t AuthenticationLog::getNumberOfDroppedRecords() const
+{
+    return droppedRecords.load(std::memory_order_relaxed);
+}
+
+AuthenticationLog::Ring::Ring(uint32_t thread)
+{
+    this->thread = thread;
+    head = 0;
+    tail = 0;
+    abandoned = false;
+}
+
+AuthenticationLog::RingHolder::~RingHolder()
+{
+    if (ring != nullptr)
+    {
+        ring->abandoned = true;
+    }
+}
+
+AuthenticationLog::Ring *AuthenticationLog::getRing()
+{
+    static thread_local RingHolder holder;
+    if (holder.ring == nullptr)
+    {
+        // Once per thread, the only lock a logging thread ever takes
+        holder.ring = std::make_shared<Ring>(nextThread++);
+        std::lock_guard<std::mutex> lock(ringsMutex);
+        rings.push_back(holder.ring);
+    }
+    return holder.ring.get();
+}
+
+void AuthenticationLog::wakeDrainer()
+{
+    // Under the lock, so the drainer can't miss it between its check and
+    // its wait
+    {
+        std::lock_guard<std::mutex> lock(drainerMutex);
+    }
+    drainerCV.notify_one();
+}
+
+void AuthenticationLog::drain()
+{
+    std::lock_guard<std::mutex> drainLock(drainMutex);
+
+    std::vector<std::shared_ptr<Ring>> drainedRings;
+    {
+        std::lock_guard<std::mutex> lock(ringsMutex);
+        drainedRings = rings;
+    }
+
+    std::string line;
+    for (std::vector<std::shared_ptr<Ring>>::iterator it = drainedRings.begin();
+         it != drainedRings.end(); ++it)
+    {
+        Ring &ring = **it;
+        // Read before the records, so an abandoned ring is known to be
+        // drained once its records are
+        bool abandoned = ring.abandoned.load(std::memory_order_acquire);
+        size_t head = ring.head.load(std::memory_order_relaxed);
+        size_t tail = ring.tail.load(std::memory_order_acquire);
+        for (; head != tail; head++)
+        {
+            const AuthenticationLogRecord &record = ring.records[head % AUTHENTICATION_LOG_RING_SIZE];
+            format(record, line);
+            if (sink != nullptr)
+            {
+                sink(record.level, line.c_str(), sinkContext);
+            }
+            else
+            {
+                line += '\n';
+                fwrite(line.data(), 1, line.size(), stdout);
+            }
+        }
+        ring.head.store(head, std::memory_order_release);
+
+        if (abandoned)
+        {
+            std::lock_guard<std::mutex> lock(ringsMutex);
+            for (std::vector<std::shared_ptr<Ring>>::iterator ringIt = rings.begin();
+                 ringIt != rings.end(); ++ringIt)
+            {
+                if (*ringIt == *it)
+                {
+                    rings.erase(ringIt);
+                    break;
+                }
+            }
+        }
+    }
+    if (sink == nullptr)
+    {
+        fflush(stdout);
+    }
+}
+
+void AuthenticationLog::drainer()
+{
+    std::unique_lock<std::mutex> lock(drainerMutex);
+    while (true)
+    {
+        drainerCV.wait(lock, [this]
+                       { return stopDrainer ||
+                                (pendingRecords.load(std::memory_order_acquire) != 0); });
+        if (stopDrainer)
+        {
+            break;
+        }
+
+        // Records logged from here on wake the drainer up again
+        pendingRecords.exchange(0, std::memory_order_acq_rel);
+        lock.unlock();
+        drain();
+        lock.lock();
+    }
+}
+
+void AuthenticationLog::format(const AuthenticationLogRecord &record, std::string &line)
+{
+    char buffer[64];
+    std::time_t seconds = std::chrono::system_clock::to_time_t(record.time);
+    long microseconds = static_cast<long>(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            record.time.time_since_epoch())
+            .count() %
+        1000000);
+    struct tm localTime;
+    localtime_r(&seconds, &localTime);
+    size_t length = strftime(buffer, sizeof(buffer), "%H:%M:%S", &localTime);
+    snprintf(buffer + length, sizeof(buffer) - length, ".%06ld [%s] [%" PRIu32 "] ",
+             microseconds, levelNames[static_cast<int>(record.level)], record.thread);
+    line = buffer;
+
+    // Each {} takes the next argument, extra ones are left as they are
+    uint8_t arg = 0;
+    for (const char *c = record.format; *c != '\0'; c++)
+    {
+        if ((c[0] != '{') || (c[1] != '}') || (arg >= record.numberOfArgs))
+        {
+            line += *c;
+            continue;
+        }
+
+        const AuthenticationLogArg &logArg = record.args[arg++];
+        switch (logArg.type)
+        {
+        case AuthenticationLogArg::LOG_ARG_SIGNED:
+            snprintf(buffer, sizeof(buffer), "%" PRId64, logArg.signedValue);
+            line += buffer;
+            break;
+        case AuthenticationLogArg::LOG_ARG_UNSIGNED:
+            snprintf(buffer, sizeof(buffer), "%" PRIu64, logArg.unsignedValue);
+            line += buffer;
+            break;
+        case AuthenticationLogArg::LOG_ARG_DOUBLE:
+            snprintf(buffer, sizeof(buffer), "%g", logArg.doubleValue);
+            line += buffer;
+            break;
+        case AuthenticationLogArg::LOG_ARG_STRING:
+            line += logArg.stringValue;
+            break;
+        }
+        c++;
+    }
+}
@@ -0,0 +1,211 @@
+#include "AuthenticationMemoryFile.h"
+
+#include <algorithm>
+#include <cstring>
+
+AuthenticationMemoryFile::AuthenticationMemoryFile(
+    std::shared_ptr<std::vector<uint8_t>> buffer, size_t maximumSize)
+{
+    this->buffer = (buffer != nullptr) ? buffer : std::make_shared<std::vector<uint8_t>>();
+    this->bufferPool = nullptr;
+    this->maximumSize = maximumSize;
+    poolBuffer = NULL;
+    pooled = false;
+    size = this->buffer->size();
+    position = 0;
+    overflowed = false;
+}
+
+AuthenticationMemoryFile::AuthenticationMemoryFile(AuthenticationBufferPool *bufferPool,
+                                                   size_t maximumSize)
+{
+    this->buffer = std::make_shared<std::vector<uint8_t>>();
+    this->bufferPool = bufferPool;
+    this->maximumSize = maximumSize;
+    poolBuffer = NULL;
+    pooled = (bufferPool != nullptr);
+    size = 0;
+    position = 0;
+    overflowed = false;
+}
+
+AuthenticationMemoryFile::~AuthenticationMemoryFile()
+{
+    if (poolBuffer != NULL)
+    {
+        bufferPool->release(poolBuffer);
+        poolBuffer = NULL;
+    }
+}
+
+FILE *AuthenticationMemoryFile::open(const char *mode)
+{
+    if ((mode == NULL) || ((mode[0] != 'w') && (mode[0] != 'r')))
+    {
+        return NULL;
+    }
+
+    if (mode[0] == 'w')
+    {
+        clear();
+        if (!pooled && !reserve(DEFAULT_MEMORY_FILE_CAPACITY))
+        {
+            return NULL;
+        }
+    }
+    position = 0;
+
+    cookie_io_functions_t functions;
+    functions.read = AuthenticationMemoryFile::readFile;
+    functions.write = AuthenticationMemoryFile::writeFile;
+    functions.seek = AuthenticationMemoryFile::seekFile;
+    functions.close = AuthenticationMemoryFile::closeFile;
+    return fopencookie(this, mode, functions);
+}
+
+const uint8_t *AuthenticationMemoryFile::getData()
+{
+    if (pooled)
+    {
+        return reinterpret_cast<const uint8_t *>(poolBuffer);
+    }
+    return buffer->data();
+}
+
+size_t AuthenticationMemoryFile::getSize()
+{
+    return size;
+}
+
+std::shared_ptr<std::vector<uint8_t>> AuthenticationMemoryFile::getBuffer()
+{
+    if (pooled)
+    {
+        buffer->assign(getData(), getData() + size);
+    }
+    return buffer;
+}
+
+bool AuthenticationMemoryFile::isOverflowed()
+{
+    return overflowed;
+}
+
+void AuthenticationMemoryFile::clear()
+{
+    if (poolBuffer != NULL)
+    {
+        bufferPool->release(poolBuffer);
+        poolBuffer = NULL;
+    }
+    pooled = (bufferPool != nullptr);
+    buffer->clear();
+    size = 0;
+    position = 0;
+    overflowed = false;
+}
+
+bool AuthenticationMemoryFile::reserve(size_t capacity)
+{
+    if (pooled)
+    {
+        if (poolBuffer == NULL)
+        {
+            poolBuffer = bufferPool->acquire();
+            if (poolBuffer == NULL)
+            {
+                return false;
+            }
+        }
+        if (capacity <= bufferPool->getBufferSize())
+        {
+            return true;
+        }
+
+        // Outgrown the pool buffer: the file carries on in the vector
+        buffer->reserve(std::max(capacity, 2 * bufferPool->getBufferSize()));
+        buffer->assign(poolBuffer, poolBuffer + size);
+        bufferPool->release(poolBuffer);
+        poolBuffer = NULL;
+        pooled = false;
+        return true;
+    }
+
+    if (capacity > buffer->capacity())
+    {
+        buffer->reserve(std::max(capacity, 2 * buffer->capacity()));
+    }
+    return true;
+}
+
+ssize_t AuthenticationMemoryFile::readFile(void *cookie, char *data, size_t size)
+{
+    AuthenticationMemoryFile *thiz = static_cast<AuthenticationMemoryFile *>(cookie);
+    if (thiz->position >= thiz->size)
+    {
+        return 0;
+    }
+    size_t readSize = std::min(size, thiz->size - thiz->position);
+    std::memcpy(data, thiz->getData() + thiz->position, readSize);
+    thiz->position += readSize;
+    return readSize;
+}
+
+ssize_t AuthenticationMemoryFile::writeFile(void *cookie, const char *data, size_t size)
+{
+    AuthenticationMemoryFile *thiz = static_cast<AuthenticationMemoryFile *>(cookie);
+    size_t end = thiz->position + size;
+    if ((end > thiz->maximumSize) || !thiz->reserve(end))
+    {
+        // Refused, so the transfer fails instead of losing the end of the file
+        thiz->overflowed = true;
+        return -1;
+    }
+
+    // Like open_memstream(), the file ends where the last write ended, so
+    // a transfer restarted from the beginning leaves nothing stale behind
+    if (thiz->pooled)
+    {
+        std::memcpy(thiz->poolBuffer + thiz->position, data, size);
+    }
+    else
+    {
+        thiz->buffer->resize(end);
+        std::memcpy(thiz->buffer->data() + thiz->position, data, size);
+    }
+    thiz->position = end;
+    thiz->size = end;
+    return size;
+}
+
+int AuthenticationMemoryFile::seekFile(void *cookie, off64_t *offset, int whence)
+{
+    AuthenticationMemoryFile *thiz = static_cast<AuthenticationMemoryFile *>(cookie);
+    off64_t newPosition = *offset;
+    switch (whence)
+    {
+    case SEEK_SET:
+        break;
+    case SEEK_CUR:
+        newPosition += thiz->position;
+        break;
+    case SEEK_END:
+        newPosition += thiz->size;
+        break;
+    default:
+        return -1;
+    }
+    if ((newPosition < 0) || (static_cast<size_t>(newPosition) > thiz->size))
+    {
+        return -1;
+    }
+
+    thiz->position = newPosition;
+    *offset = newPosition;
+    return 0;
+}
+
+int AuthenticationMemoryFile::closeFile(void *cookie)
+{
+    return 0;
+}
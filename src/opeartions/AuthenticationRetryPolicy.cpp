@@ -0,0 +1,66 @@
+#include "AuthenticationRetryPolicy.h"
+
+#include <algorithm>
+#include <random>
+
+AuthenticationRetryPolicy::AuthenticationRetryPolicy(
+    uint16_t maxTries, std::chrono::milliseconds initialBackoff,
+    std::chrono::milliseconds maxBackoff, double jitter,
+    std::chrono::milliseconds deadline)
+{
+    this->maxTries = maxTries;
+    this->initialBackoff = initialBackoff;
+    this->maxBackoff = std::max(maxBackoff, initialBackoff);
+    this->jitter = std::min(std::max(jitter, 0.0), 1.0);
+    this->deadline = deadline;
+}
+
+AuthenticationRetryPolicy::~AuthenticationRetryPolicy()
+{
+}
+
+bool AuthenticationRetryPolicy::nextTry(uint16_t failedTries, uint16_t waitTimeS,
+                                        std::chrono::milliseconds elapsed,
+                                        std::chrono::milliseconds &delay)
+{
+    if (waitTimeS > 0)
+    {
+        // The target hardware is busy, and said for how long
+        delay = std::chrono::seconds(waitTimeS);
+    }
+    else
+    {
+        if (failedTries >= maxTries)
+        {
+            return false;
+        }
+
+        std::chrono::milliseconds backoff = initialBackoff;
+        for (uint16_t i = 1; (i < failedTries) && (backoff < maxBackoff); i++)
+        {
+            backoff *= 2;
+        }
+        backoff = std::min(backoff, maxBackoff);
+
+        // Each thread draws its own jitter, nothing is shared
+        static thread_local std::minstd_rand generator(std::random_device{}());
+        std::uniform_real_distribution<double> distribution(0.0, jitter);
+        delay = std::chrono::milliseconds(static_cast<std::chrono::milliseconds::rep>(
+            backoff.count() * (1.0 - distribution(generator))));
+    }
+
+    return (elapsed + delay) <= deadline;
+}
+
+std::chrono::milliseconds AuthenticationRetryPolicy::statusTimeout(uint16_t exceptionTimer,
+                                                                   uint16_t estimatedTime)
+{
+    // The Exception Timer is the target hardware telling how long it will
+    // be silent. The Estimated Time covers the whole operation, status
+    // files keep coming meanwhile.
+    if (exceptionTimer > 0)
+    {
+        return std::chrono::seconds(exceptionTimer);
+    }
+    return std::chrono::seconds(DEFAULT_AUTHENTICATION_DLP_TIMEOUT);
+}
@@ -1,9 +1,11 @@
 #include <stdio.h>
 #include <cstring>
 #include <algorithm>
+#include <utility>
 
 #include "AuthenticationTargetHardware.h"
 #include "InitializationAuthenticationFile.h"
+#include "LoadAuthenticationRequestView.h"
 
 #define STATUS_AUTHENTICATION_PERIOD 1000 // ms
 
@@ -24,6 +26,8 @@ AuthenticationTargetHardware::AuthenticationTargetHardware(
 
     loadAuthenticationInitializationFileBuffer = std::make_shared<std::vector<uint8_t>>();
     loadAuthenticationRequestFileBuffer = std::make_shared<std::vector<uint8_t>>();
+    loadAuthenticationRequestMemoryFile = std::unique_ptr<AuthenticationMemoryFile>(
+        new AuthenticationMemoryFile(loadAuthenticationRequestFileBuffer));
     statusHeaderFiles = std::make_shared<std::vector<LoadAuthenticationStatusHeaderFile>>();
 
     authenticationOperationStatusCode = STATUS_AUTHENTICATION_ACCEPTED;
@@ -57,6 +61,7 @@ AuthenticationTargetHardware::~AuthenticationTargetHardware()
     loadAuthenticationInitializationFileBuffer.reset();
     loadAuthenticationInitializationFileBuffer = nullptr;
 
+    loadAuthenticationRequestMemoryFile.reset();
     loadAuthenticationRequestFileBuffer.reset();
     loadAuthenticationRequestFileBuffer = nullptr;
 }
@@ -117,7 +122,7 @@ AuthenticationOperationResult AuthenticationTargetHardware::loadAuthenticationIn
             _generateCryptographicKeyCallback(baseFileName, cryptographicKey,
                                               _generateCryptographicKeyContext);
         }
-        loadAuthenticationInitializationResponse.setCryptographicKey(cryptographicKey);
+        loadAuthenticationInitializationResponse.setCryptographicKey(std::move(cryptographicKey));
 
         nextState = AuthenticationTargetHardwareState::ACCEPTED;
     }
@@ -128,18 +133,29 @@ AuthenticationOperationResult AuthenticationTargetHardware::loadAuthenticationIn
         nextState = AuthenticationTargetHardwareState::DENIED;
     }
 
-    loadAuthenticationInitializationFileBuffer->clear();
-    loadAuthenticationInitializationFileBuffer->resize(0);
-    loadAuthenticationInitializationResponse.serialize(loadAuthenticationInitializationFileBuffer);
+    // Encode straight into the buffer handed to fmemopen
+    size_t initializationFileSize = 0;
+    loadAuthenticationInitializationResponse.getFileSize(initializationFileSize);
+    loadAuthenticationInitializationFileBuffer->resize(initializationFileSize);
+
+    size_t initializationFileWritten = 0;
+    if (loadAuthenticationInitializationResponse.serializeInto(
+            loadAuthenticationInitializationFileBuffer->data(),
+            loadAuthenticationInitializationFileBuffer->size(),
+            initializationFileWritten) != SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK)
+    {
+        (*bufferSize) = 0;
+        return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+    }
 
     (*fp) = fmemopen(loadAuthenticationInitializationFileBuffer->data(),
-                     loadAuthenticationInitializationFileBuffer->size(), "r");
+                     initializationFileWritten, "r");
     if ((*fp) == NULL)
     {
         (*bufferSize) = 0;
         return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
     }
-    (*bufferSize) = loadAuthenticationInitializationFileBuffer->size();
+    (*bufferSize) = initializationFileWritten;
 
     _mainThreadCV.notify_one();
 
@@ -156,11 +172,8 @@ AuthenticationOperationResult AuthenticationTargetHardware::loadAuthenticationRe
         return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
     }
 
-    loadAuthenticationInitializationFileBuffer->clear();
-    loadAuthenticationInitializationFileBuffer->resize(MAX_CERTIFICATE_BUFFER_SIZE);
-
-    (*fp) = fmemopen(loadAuthenticationInitializationFileBuffer->data(),
-                     loadAuthenticationInitializationFileBuffer->size(), "w");
+    // The load list grows the buffer as it arrives, whatever its length
+    (*fp) = loadAuthenticationRequestMemoryFile->open("w");
     if ((*fp) == NULL)
     {
         if (bufferSize != NULL)
@@ -171,12 +184,23 @@ AuthenticationOperationResult AuthenticationTargetHardware::loadAuthenticationRe
     }
     if (bufferSize != NULL)
     {
-        (*bufferSize) = loadAuthenticationInitializationFileBuffer->size();
+        (*bufferSize) = MAX_MEMORY_FILE_SIZE;
     }
 
     return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
 }
 
+AuthenticationOperationResult AuthenticationTargetHardware::getNumberOfRejectedFiles(
+    AuthenticationFileValidationResult reason, uint32_t &numberOfRejectedFiles)
+{
+    if (reason == AuthenticationFileValidationResult::AUTHENTICATION_FILE_VALID)
+    {
+        return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+    }
+    numberOfRejectedFiles = fileValidator.getNumberOfValidations(reason);
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
 NotifierAuthenticationOperationResult AuthenticationTargetHardware::notify(
     NotifierAuthenticationEventType event)
 {
@@ -192,32 +216,47 @@ NotifierAuthenticationOperationResult AuthenticationTargetHardware::notify(
             return NotifierAuthenticationOperationResult::NOTIFIER_ERROR;
         }
 
-        std::shared_ptr<std::vector<LoadAuthenticationRequestHeaderFile>> headerFiles;
-        headerFiles = std::make_shared<std::vector<LoadAuthenticationRequestHeaderFile>>();
-        LoadAuthenticationRequestFile loadAuthenticationRequestFile;
-
-        if (loadAuthenticationRequestFile.deserialize(loadAuthenticationInitializationFileBuffer) == SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK)
+        // Malformed requests are dropped before anything is read from them
+        if (fileValidator.validate(loadAuthenticationRequestFileBuffer->data(),
+                                   loadAuthenticationRequestFileBuffer->size(),
+                                   AuthenticationFileKind::AUTHENTICATION_FILE_KIND_LOAD_REQUEST) !=
+            AuthenticationFileValidationResult::AUTHENTICATION_FILE_VALID)
         {
-            loadAuthenticationRequestFile.getHeaderFiles(headerFiles);
+            return NotifierAuthenticationOperationResult::NOTIFIER_ERROR;
+        }
 
-            for (std::vector<LoadAuthenticationRequestHeaderFile>::iterator it =
-                     headerFiles->begin();
-                 it != headerFiles->end(); ++it)
+        // The request is only read to build the status header files, so it is
+        // not materialized: header files are read straight from the buffer.
+        LoadAuthenticationRequestView loadAuthenticationRequestView;
+
+        if (loadAuthenticationRequestView.parse(loadAuthenticationRequestFileBuffer->data(),
+                                                loadAuthenticationRequestFileBuffer->size()) ==
+            SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK)
+        {
+            std::lock_guard<std::mutex> lock(statusEncoderMutex);
+            uint16_t numberOfHeaderFiles = 0;
+            loadAuthenticationRequestView.getNumberOfHeaderFiles(numberOfHeaderFiles);
+            statusHeaderFiles->reserve(statusHeaderFiles->size() + numberOfHeaderFiles);
+
+            for (LoadAuthenticationRequestView::HeaderFileIterator it =
+                     loadAuthenticationRequestView.begin();
+                 it != loadAuthenticationRequestView.end(); ++it)
             {
-                LoadAuthenticationStatusHeaderFile statusHeaderFile;
+                statusHeaderFiles->emplace_back();
+                LoadAuthenticationStatusHeaderFile &statusHeaderFile = statusHeaderFiles->back();
 
-                std::string headerFileName;
-                (*it).getHeaderFileName(headerFileName);
-                statusHeaderFile.setHeaderFileName(headerFileName);
+                AuthenticationFieldView headerFileName;
+                it->getHeaderFileName(headerFileName);
+                statusHeaderFile.setHeaderFileName(headerFileName.toString());
 
-                std::string loadPartNumberName;
-                (*it).getLoadPartNumberName(loadPartNumberName);
-                statusHeaderFile.setLoadPartNumberName(loadPartNumberName);
+                AuthenticationFieldView loadPartNumberName;
+                it->getLoadPartNumberName(loadPartNumberName);
+                statusHeaderFile.setLoadPartNumberName(loadPartNumberName.toString());
 
                 statusHeaderFile.setLoadRatio(0);
                 statusHeaderFile.setLoadStatus(STATUS_AUTHENTICATION_ACCEPTED);
-                statusHeaderFiles->push_back(statusHeaderFile);
             }
+            statusEncoder.setHeaderFiles(statusHeaderFiles);
 
             nextState = AuthenticationTargetHardwareState::IN_PROGRESS;
             _mainThreadCV.notify_one();
@@ -388,8 +427,6 @@ AuthenticationOperationResult AuthenticationTargetHardware::statusThread()
 
     std::string statusFileName = baseFileName + LOAD_AUTHENTICATION_STATUS_FILE_EXTENSION;
 
-    std::shared_ptr<std::vector<uint8_t>> loadAuthenticationStatusFileBuffer = std::make_shared<std::vector<uint8_t>>();
-
     uint8_t sendRetry = MAX_DLP_TRIES;
 
     bool sendOnce = false;
@@ -428,46 +465,56 @@ AuthenticationOperationResult AuthenticationTargetHardware::statusThread()
             break;
         }
 
-        // Prepare the status file
-        LoadAuthenticationStatusFile loadAuthenticationStatusFile(statusFileName);
-
-        loadAuthenticationStatusFile.setAuthenticationOperationStatusCode(authenticationOperationStatusCode);
-        if (authenticationOperationStatusCode == STATUS_AUTHENTICATION_IN_PROGRESS_WITH_DESCRIPTION ||
-            authenticationOperationStatusCode == STATUS_AUTHENTICATION_ABORTED_BY_THE_TARGET_HARDWARE)
+        TftpClientOperationResult result = TftpClientOperationResult::TFTP_CLIENT_ERROR;
         {
-            loadAuthenticationStatusFile.setAuthenticationStatusDescription(authenticationStatusDescription);
-        }
+            // Only the fields that changed since the last period are written.
+            // The encoded file is copied out, so the file transfers are not
+            // held up while it is sent.
+            std::lock_guard<std::mutex> lock(statusEncoderMutex);
+
+            statusEncoder.setAuthenticationOperationStatusCode(authenticationOperationStatusCode);
+            if (authenticationOperationStatusCode == STATUS_AUTHENTICATION_IN_PROGRESS_WITH_DESCRIPTION ||
+                authenticationOperationStatusCode == STATUS_AUTHENTICATION_ABORTED_BY_THE_TARGET_HARDWARE)
+            {
+                statusEncoder.setAuthenticationStatusDescription(authenticationStatusDescription);
+            }
+            else
+            {
+                statusEncoder.clearAuthenticationStatusDescription();
+            }
 
-        uint16_t counter;
-        loadAuthenticationStatusFile.getCounter(counter);
-        loadAuthenticationStatusFile.setCounter(++counter);
-        loadAuthenticationStatusFile.setExceptionTimer(0);
+            uint16_t counter;
+            statusEncoder.getCounter(counter);
+            statusEncoder.setCounter(++counter);
+            statusEncoder.setExceptionTimer(0);
 
-        if (authenticationOperationStatusCode == STATUS_AUTHENTICATION_IN_PROGRESS ||
-            authenticationOperationStatusCode == STATUS_AUTHENTICATION_IN_PROGRESS_WITH_DESCRIPTION)
-        {
-            loadAuthenticationStatusFile.setEstimatedTime(0xFFFF);
-        }
-        else
-        {
-            loadAuthenticationStatusFile.setEstimatedTime(0);
+            if (authenticationOperationStatusCode == STATUS_AUTHENTICATION_IN_PROGRESS ||
+                authenticationOperationStatusCode == STATUS_AUTHENTICATION_IN_PROGRESS_WITH_DESCRIPTION)
+            {
+                statusEncoder.setEstimatedTime(0xFFFF);
+            }
+            else
+            {
+                statusEncoder.setEstimatedTime(0);
+            }
+
+            statusEncoder.setLoadListRatio(loadListRatio);
+
+            uint8_t *statusFileData = nullptr;
+            size_t statusFileSize = 0;
+            statusFileImage.clear();
+            if (statusEncoder.encode(statusFileData, statusFileSize) ==
+                SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK)
+            {
+                statusFileImage.assign(statusFileData, statusFileData + statusFileSize);
+            }
         }
 
-        loadAuthenticationStatusFile.setLoadListRatio(loadListRatio);
-        for (std::vector<LoadAuthenticationStatusHeaderFile>::iterator it =
-                 statusHeaderFiles->begin();
-             it != statusHeaderFiles->end(); ++it)
+        FILE *fp = NULL;
+        if (!statusFileImage.empty())
         {
-            loadAuthenticationStatusFile.addHeaderFile(*it);
+            fp = fmemopen(statusFileImage.data(), statusFileImage.size(), "r");
         }
-
-        loadAuthenticationStatusFileBuffer->clear();
-        loadAuthenticationStatusFileBuffer->resize(0);
-        loadAuthenticationStatusFile.serialize(loadAuthenticationStatusFileBuffer);
-        FILE *fp = fmemopen(loadAuthenticationStatusFileBuffer->data(),
-                            loadAuthenticationStatusFileBuffer->size(), "r");
-
-        TftpClientOperationResult result = TftpClientOperationResult::TFTP_CLIENT_ERROR;
         if (fp != NULL)
         {
             result = authenticationClient.sendFile(statusFileName.c_str(), fp);
@@ -517,8 +564,9 @@ AuthenticationOperationResult AuthenticationTargetHardware::authenticationThread
     loadListRatio = 0;
     std::vector<LoadAuthenticationStatusHeaderFile>::iterator it;
 
-    unsigned char fileBuffer[MAX_CERTIFICATE_BUFFER_SIZE];
-    std::memset(fileBuffer, 0, MAX_CERTIFICATE_BUFFER_SIZE);
+    // Certificates are received whole, the buffer grows to fit them
+    std::shared_ptr<std::vector<uint8_t>> fileBuffer = std::make_shared<std::vector<uint8_t>>();
+    AuthenticationMemoryFile certificateFile(fileBuffer);
 
     for (it = statusHeaderFiles->begin();
          (it != statusHeaderFiles->end()) && runAuthenticationThread;
@@ -526,13 +574,19 @@ AuthenticationOperationResult AuthenticationTargetHardware::authenticationThread
     {
         std::string headerFileName;
         (*it).getHeaderFileName(headerFileName);
+        size_t headerFileIndex = it - statusHeaderFiles->begin();
 
         if (authenticationWaitTime > 0)
         {
-            (*it).setLoadStatus(STATUS_AUTHENTICATION_IN_PROGRESS_WITH_DESCRIPTION);
-            (*it).setLoadRatio(0);
-            (*it).setLoadStatusDescription("Waiting " + std::to_string(authenticationWaitTime) +
-                                           " seconds before authentication...");
+            {
+                std::lock_guard<std::mutex> lock(statusEncoderMutex);
+                statusEncoder.setHeaderFileLoadStatus(
+                    headerFileIndex, STATUS_AUTHENTICATION_IN_PROGRESS_WITH_DESCRIPTION);
+                statusEncoder.setHeaderFileLoadRatio(headerFileIndex, 0);
+                statusEncoder.setHeaderFileLoadStatusDescription(
+                    headerFileIndex, "Waiting " + std::to_string(authenticationWaitTime) +
+                                         " seconds before authentication...");
+            }
 
             nextState = AuthenticationTargetHardwareState::IN_PROGRESS_WITH_DESCRIPTION;
             authenticationStatusDescription = "Waiting file " + headerFileName + " to be available...";
@@ -542,8 +596,11 @@ AuthenticationOperationResult AuthenticationTargetHardware::authenticationThread
         std::this_thread::sleep_for(std::chrono::seconds(authenticationWaitTime));
         authenticationWaitTime = 0;
 
-        (*it).setLoadStatus(STATUS_AUTHENTICATION_IN_PROGRESS);
-        (*it).setLoadRatio(0);
+        {
+            std::lock_guard<std::mutex> lock(statusEncoderMutex);
+            statusEncoder.setHeaderFileLoadStatus(headerFileIndex, STATUS_AUTHENTICATION_IN_PROGRESS);
+            statusEncoder.setHeaderFileLoadRatio(headerFileIndex, 0);
+        }
 
         nextState = AuthenticationTargetHardwareState::IN_PROGRESS_WITH_DESCRIPTION;
         _mainThreadCV.notify_one();
@@ -556,7 +613,7 @@ AuthenticationOperationResult AuthenticationTargetHardware::authenticationThread
         //     cleanHeaderFileName = headerFileName.substr(fileNamePosition + 1);
         // }
 
-        FILE *fp = fmemopen(fileBuffer, MAX_CERTIFICATE_BUFFER_SIZE, "w");
+        FILE *fp = certificateFile.open("w");
         TftpClientOperationResult result = TftpClientOperationResult::TFTP_CLIENT_ERROR;
         if (fp != NULL)
         {
@@ -574,44 +631,64 @@ AuthenticationOperationResult AuthenticationTargetHardware::authenticationThread
         }
         if (result != TftpClientOperationResult::TFTP_CLIENT_OK)
         {
-            (*it).setLoadStatus(STATUS_AUTHENTICATION_HEAD_FILE_FAILED);
-            (*it).setLoadStatusDescription("Failed to fetch header file");
+            std::lock_guard<std::mutex> lock(statusEncoderMutex);
+            statusEncoder.setHeaderFileLoadStatus(headerFileIndex,
+                                                  STATUS_AUTHENTICATION_HEAD_FILE_FAILED);
+            statusEncoder.setHeaderFileLoadStatusDescription(headerFileIndex,
+                                                             "Failed to fetch header file");
             receiveError = true;
             break;
         }
         else
         {
-            (*it).setLoadStatus(STATUS_AUTHENTICATION_IN_PROGRESS_WITH_DESCRIPTION);
-            (*it).setLoadRatio(50);
-            (*it).setLoadStatusDescription("Checking received file...");
+            {
+                std::lock_guard<std::mutex> lock(statusEncoderMutex);
+                statusEncoder.setHeaderFileLoadStatus(
+                    headerFileIndex, STATUS_AUTHENTICATION_IN_PROGRESS_WITH_DESCRIPTION);
+                statusEncoder.setHeaderFileLoadRatio(headerFileIndex, 50);
+                statusEncoder.setHeaderFileLoadStatusDescription(headerFileIndex,
+                                                                 "Checking received file...");
+            }
 
             if (_checkCertificateCallback != nullptr)
             {
                 std::string checkCertificateReport;
-                if (_checkCertificateCallback(fileBuffer,
-                                        MAX_CERTIFICATE_BUFFER_SIZE, checkCertificateReport,
+                if (_checkCertificateCallback(fileBuffer->data(),
+                                        fileBuffer->size(), checkCertificateReport,
                                         _checkCertificateContext) ==
                     AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR)
                 {
-                    (*it).setLoadStatus(STATUS_AUTHENTICATION_HEAD_FILE_FAILED);
-                    (*it).setLoadStatusDescription(checkCertificateReport);
+                    std::lock_guard<std::mutex> lock(statusEncoderMutex);
+                    statusEncoder.setHeaderFileLoadStatus(headerFileIndex,
+                                                          STATUS_AUTHENTICATION_HEAD_FILE_FAILED);
+                    statusEncoder.setHeaderFileLoadStatusDescription(headerFileIndex,
+                                                                     checkCertificateReport);
                     receiveError = true;
                     break;
                 }
             }
-            (*it).setLoadStatus(STATUS_AUTHENTICATION_COMPLETED);
-            (*it).setLoadRatio(100);
+            {
+                std::lock_guard<std::mutex> lock(statusEncoderMutex);
+                statusEncoder.setHeaderFileLoadStatus(headerFileIndex,
+                                                      STATUS_AUTHENTICATION_COMPLETED);
+                statusEncoder.setHeaderFileLoadRatio(headerFileIndex, 100);
+            }
             numOfSuccessfullAuthentications++;
             loadListRatio = (numOfSuccessfullAuthentications * 100) / numOfFilesToAuthentication;
         }
     }
 
     // In case of abort, define status of remaining files.
-    while (it != statusHeaderFiles->end())
     {
-        (*it).setLoadStatus(authenticationOperationStatusCode);
-        (*it).setLoadStatusDescription(authenticationStatusDescription);
-        it++;
+        std::lock_guard<std::mutex> lock(statusEncoderMutex);
+        for (size_t headerFileIndex = it - statusHeaderFiles->begin();
+             headerFileIndex < statusHeaderFiles->size(); headerFileIndex++)
+        {
+            statusEncoder.setHeaderFileLoadStatus(headerFileIndex,
+                                                  authenticationOperationStatusCode);
+            statusEncoder.setHeaderFileLoadStatusDescription(headerFileIndex,
+                                                             authenticationStatusDescription);
+        }
     }
 
     if (receiveError)
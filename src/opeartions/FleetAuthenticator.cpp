@@ -0,0 +1,422 @@
+#include "FleetAuthenticator.h"
+
+#include <algorithm>
+
+FleetAuthenticator::FleetAuthenticator(AuthenticationDataLoader *dataLoader,
+                                       size_t concurrency)
+{
+    this->dataLoader = dataLoader;
+    this->concurrency = std::max(concurrency, static_cast<size_t>(1));
+    _targetCompletedCallback = nullptr;
+    _targetCompletedContext = nullptr;
+    authenticating = false;
+    pendingTargets = 0;
+    nextTarget = 0;
+    aborted = false;
+    abortSource = AUTHENTICATION_ABORT_SOURCE_NONE;
+    hasReport = false;
+}
+
+FleetAuthenticator::~FleetAuthenticator()
+{
+}
+
+AuthenticationOperationResult FleetAuthenticator::setConcurrency(size_t concurrency)
+{
+    std::lock_guard<std::mutex> lock(targetsMutex);
+    if ((concurrency == 0) || authenticating)
+    {
+        return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+    }
+
+    this->concurrency = concurrency;
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
+AuthenticationOperationResult FleetAuthenticator::addTarget(
+    std::string targetHardwareId, std::string targetHardwarePosition,
+    std::string targetHardwareIp, std::vector<AuthenticationLoad> loadList)
+{
+    if (targetHardwareId.empty() || targetHardwarePosition.empty() ||
+        targetHardwareIp.empty() || loadList.empty())
+    {
+        return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+    }
+
+    std::lock_guard<std::mutex> lock(targetsMutex);
+    if (authenticating)
+    {
+        return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+    }
+    for (FleetTarget &target : targets)
+    {
+        if ((target.targetHardwareId == targetHardwareId) &&
+            (target.targetHardwarePosition == targetHardwarePosition))
+        {
+            return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+        }
+    }
+
+    FleetTarget target;
+    target.targetHardwareId = targetHardwareId;
+    target.targetHardwarePosition = targetHardwarePosition;
+    target.targetHardwareIp = targetHardwareIp;
+    target.loadList = loadList;
+    targets.push_back(target);
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
+AuthenticationOperationResult FleetAuthenticator::clearTargets()
+{
+    std::lock_guard<std::mutex> lock(targetsMutex);
+    if (authenticating)
+    {
+        return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+    }
+
+    targets.clear();
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
+AuthenticationOperationResult FleetAuthenticator::registerTargetCompletedCallback(
+    fleetTargetCompletedCallback callback, void *context)
+{
+    std::lock_guard<std::mutex> lock(targetsMutex);
+    if (authenticating)
+    {
+        return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+    }
+
+    _targetCompletedCallback = callback;
+    _targetCompletedContext = context;
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
+AuthenticationOperationResult FleetAuthenticator::authenticate()
+{
+    if (dataLoader == nullptr)
+    {
+        return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+    }
+
+    size_t numberOfTargets;
+    size_t slots;
+    {
+        std::lock_guard<std::mutex> lock(targetsMutex);
+        if (authenticating || targets.empty())
+        {
+            return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+        }
+        // The targets, the cap and the callback are left as they are until
+        // the fleet is done, so they are read without the lock meanwhile
+        authenticating = true;
+        numberOfTargets = targets.size();
+        slots = std::min(concurrency, numberOfTargets);
+    }
+    {
+        std::lock_guard<std::mutex> lock(resultsMutex);
+        results.clear();
+        results.reserve(numberOfTargets);
+        hasReport = false;
+    }
+    start = std::chrono::steady_clock::now();
+    {
+        std::lock_guard<std::mutex> lock(runsMutex);
+        runs.assign(numberOfTargets, FleetRun());
+        pendingTargets = numberOfTargets;
+        nextTarget = slots;
+        aborted = false;
+    }
+
+    // Each slot starts one target, and the end of a target starts the next
+    // one left in its slot
+    for (size_t i = 0; i < slots; i++)
+    {
+        runTargets(i);
+    }
+    {
+        std::unique_lock<std::mutex> lock(runsMutex);
+        runsCV.wait(lock, [this]
+                    { return pendingTargets == 0; });
+        runs.clear();
+    }
+    std::chrono::duration<double> makespan = std::chrono::steady_clock::now() - start;
+
+    AuthenticationOperationResult fleetResult;
+    {
+        std::lock_guard<std::mutex> lock(resultsMutex);
+        report.numberOfTargets = numberOfTargets;
+        report.numberOfCompletedTargets = 0;
+        report.numberOfFailedTargets = 0;
+        report.numberOfAbortedTargets = 0;
+        report.concurrency = slots;
+        report.makespan = makespan;
+        report.totalTargetTime = std::chrono::duration<double>::zero();
+        report.longestTargetTime = std::chrono::duration<double>::zero();
+        for (FleetTargetResult &result : results)
+        {
+            if (result.aborted)
+            {
+                report.numberOfAbortedTargets++;
+                continue;
+            }
+            if (result.result == AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK)
+            {
+                report.numberOfCompletedTargets++;
+            }
+            else
+            {
+                report.numberOfFailedTargets++;
+            }
+            std::chrono::duration<double> targetTime = result.endedAt - result.startedAt;
+            report.totalTargetTime += targetTime;
+            report.longestTargetTime = std::max(report.longestTargetTime, targetTime);
+        }
+        size_t numberOfStartedTargets = results.size() - report.numberOfAbortedTargets;
+        report.meanTargetTime = (numberOfStartedTargets > 0)
+                                    ? report.totalTargetTime / static_cast<double>(numberOfStartedTargets)
+                                    : std::chrono::duration<double>::zero();
+        report.throughput = (makespan.count() > 0) ? (numberOfStartedTargets / makespan.count()) : 0;
+        hasReport = true;
+        fleetResult = (report.numberOfCompletedTargets == report.numberOfTargets)
+                          ? AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK
+                          : AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+    }
+
+    std::lock_guard<std::mutex> lock(targetsMutex);
+    authenticating = false;
+    return fleetResult;
+}
+
+AuthenticationOperationResult FleetAuthenticator::abort(uint16_t abortSource)
+{
+    std::vector<std::shared_ptr<AuthenticationHandle>> handles;
+    size_t firstNeverStarted;
+    size_t numberOfTargets;
+    {
+        std::lock_guard<std::mutex> lock(runsMutex);
+        // The runs are only there while authenticating
+        if (runs.empty() || aborted)
+        {
+            return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+        }
+        aborted = true;
+        this->abortSource = abortSource;
+
+        // The targets left are taken from the slots at once
+        firstNeverStarted = nextTarget;
+        numberOfTargets = runs.size();
+        nextTarget = numberOfTargets;
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < numberOfTargets; i++)
+        {
+            FleetRun &run = runs[i];
+            if (i >= firstNeverStarted)
+            {
+                run.result = AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+                run.startedAt = now;
+                run.endedAt = now;
+                run.aborted = true;
+            }
+            else if ((run.handle != nullptr) && !run.ended)
+            {
+                handles.push_back(run.handle);
+            }
+        }
+    }
+
+    for (size_t i = firstNeverStarted; i < numberOfTargets; i++)
+    {
+        recordResult(i);
+    }
+    {
+        std::lock_guard<std::mutex> lock(runsMutex);
+        pendingTargets -= numberOfTargets - firstNeverStarted;
+        if (pendingTargets == 0)
+        {
+            runsCV.notify_all();
+        }
+    }
+
+    // Ending the targets in flight may call back into the fleet, so no lock
+    // is held. A target being started right now is cancelled by
+    // startTarget().
+    for (std::shared_ptr<AuthenticationHandle> &handle : handles)
+    {
+        handle->cancel(abortSource);
+    }
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
+AuthenticationOperationResult FleetAuthenticator::getResults(
+    std::vector<FleetTargetResult> &results)
+{
+    std::lock_guard<std::mutex> lock(resultsMutex);
+    results = this->results;
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
+AuthenticationOperationResult FleetAuthenticator::getReport(FleetReport &report)
+{
+    std::lock_guard<std::mutex> lock(resultsMutex);
+    if (!hasReport)
+    {
+        return AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+    }
+
+    report = this->report;
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
+AuthenticationOperationResult FleetAuthenticator::targetCompleted(
+    std::string targetHardwareId, std::string targetHardwarePosition,
+    AuthenticationOperationResult result, void *context)
+{
+    (void)targetHardwareId;
+    (void)targetHardwarePosition;
+    FleetRun *run = static_cast<FleetRun *>(context);
+    FleetAuthenticator *fleet = run->fleet;
+    size_t target = run->target;
+    bool done;
+    {
+        std::lock_guard<std::mutex> lock(fleet->runsMutex);
+        run->endedAt = std::chrono::steady_clock::now();
+        run->result = result;
+        run->ended = true;
+        done = run->returned;
+    }
+
+    size_t next;
+    if (done && fleet->finishTarget(target, next))
+    {
+        fleet->runTargets(next);
+    }
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
+void FleetAuthenticator::runTargets(size_t target)
+{
+    // A target that ends before authenticateAsync() returns is finished
+    // here, so the next one is started in a loop rather than by recursion
+    while (startTarget(target) && finishTarget(target, target))
+    {
+    }
+}
+
+bool FleetAuthenticator::startTarget(size_t target)
+{
+    FleetTarget &fleetTarget = targets[target];
+    FleetRun *run;
+    {
+        std::lock_guard<std::mutex> lock(runsMutex);
+        run = &runs[target];
+        run->fleet = this;
+        run->target = target;
+        run->handle = nullptr;
+        run->result = AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR;
+        run->returned = false;
+        run->ended = false;
+        run->aborted = false;
+        run->startedAt = std::chrono::steady_clock::now();
+        if (aborted)
+        {
+            // Taken from its slot before the abort, but never started
+            run->endedAt = run->startedAt;
+            run->returned = true;
+            run->ended = true;
+            run->aborted = true;
+            return true;
+        }
+    }
+
+    std::shared_ptr<AuthenticationHandle> handle;
+    AuthenticationOperationResult result = dataLoader->authenticateAsync(
+        fleetTarget.targetHardwareId, fleetTarget.targetHardwarePosition,
+        fleetTarget.targetHardwareIp, fleetTarget.loadList,
+        FleetAuthenticator::targetCompleted, run, handle);
+
+    bool ended;
+    bool cancel = false;
+    uint16_t abortSource = AUTHENTICATION_ABORT_SOURCE_NONE;
+    {
+        std::lock_guard<std::mutex> lock(runsMutex);
+        run->returned = true;
+        if (result == AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK)
+        {
+            run->handle = handle;
+        }
+        else if (!run->ended)
+        {
+            // Refused before any session was made, so no callback will come
+            run->endedAt = std::chrono::steady_clock::now();
+            run->ended = true;
+        }
+        ended = run->ended;
+        // The fleet was aborted while the target was started
+        cancel = aborted && !ended;
+        abortSource = this->abortSource;
+    }
+
+    if (cancel)
+    {
+        handle->cancel(abortSource);
+    }
+    return ended;
+}
+
+bool FleetAuthenticator::finishTarget(size_t target, size_t &next)
+{
+    recordResult(target);
+
+    // The slot of this target goes to the next one left, none once the
+    // fleet is aborted
+    std::lock_guard<std::mutex> lock(runsMutex);
+    bool startNext = (nextTarget < runs.size());
+    if (startNext)
+    {
+        next = nextTarget++;
+    }
+    pendingTargets--;
+    if (pendingTargets == 0)
+    {
+        runsCV.notify_all();
+    }
+    return startNext;
+}
+
+void FleetAuthenticator::recordResult(size_t target)
+{
+    FleetTarget &fleetTarget = targets[target];
+    FleetTargetResult result;
+    std::shared_ptr<AuthenticationHandle> handle;
+    {
+        std::lock_guard<std::mutex> lock(runsMutex);
+        FleetRun &run = runs[target];
+        handle = run.handle;
+        result.result = run.result;
+        result.startedAt = run.startedAt - start;
+        result.endedAt = run.endedAt - start;
+        result.aborted = run.aborted;
+    }
+    result.targetHardwareId = fleetTarget.targetHardwareId;
+    result.targetHardwarePosition = fleetTarget.targetHardwarePosition;
+    result.targetHardwareIp = fleetTarget.targetHardwareIp;
+    result.state = result.aborted ? AuthenticationTargetState::AUTHENTICATION_TARGET_PENDING
+                                  : AuthenticationTargetState::AUTHENTICATION_TARGET_FAILED;
+    result.retries = 0;
+    result.waits = 0;
+    if (handle != nullptr)
+    {
+        handle->getState(result.state);
+        handle->getRetryStatistics(result.retries, result.waits);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(resultsMutex);
+        results.push_back(result);
+    }
+    if (!result.aborted && (_targetCompletedCallback != nullptr))
+    {
+        _targetCompletedCallback(result, _targetCompletedContext);
+    }
+}
@@ -0,0 +1,314 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "authentication_dataloader_test_context.h"
+
+// The target hardwares answer from the same host, so the measures are the
+// DataLoader and TFTP costs, not the ones of a real target hardware
+class AuthenticationDataLoaderBenchmark : public AuthenticationDataLoaderTest
+{
+};
+
+TEST_F(AuthenticationDataLoaderBenchmark, MultiTargetThroughput)
+{
+    authenticateFleets([this](size_t n)
+                       {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        EXPECT_EQ(authenticationDataLoader->authenticateTargets(),
+                  AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        printf("Multi-target: %3zu targets, %8.1f authentications/s\n",
+               n, n / elapsed.count()); });
+}
+
+class StatusLatencyContext
+{
+public:
+    FleetServerContext *fleetServerContext;
+    std::mutex latenciesMutex;
+    std::vector<double> latencies;
+};
+
+AuthenticationOperationResult StatusLatency_StatusCallback(
+    std::string authenticationInformationStatusJson, void *context)
+{
+    StatusLatencyContext *statusLatencyContext = static_cast<StatusLatencyContext *>(context);
+    std::chrono::duration<double, std::micro> latency =
+        std::chrono::steady_clock::now() -
+        statusLatencyContext->fleetServerContext->statusSentAt.load();
+
+    std::lock_guard<std::mutex> lock(statusLatencyContext->latenciesMutex);
+    statusLatencyContext->latencies.push_back(latency.count());
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
+TEST_F(AuthenticationDataLoaderBenchmark, StatusLatency)
+{
+    FleetServerContext fleetServerContext;
+    StatusLatencyContext statusLatencyContext;
+    statusLatencyContext.fleetServerContext = &fleetServerContext;
+
+    tftpTargetHardwareServer->registerOpenFileCallback(
+        fleetOpenFileCallback, &fleetServerContext);
+    authenticationDataLoader->registerAuthenticationInformationStatusCallback(
+        StatusLatency_StatusCallback, &statusLatencyContext);
+
+    std::thread serverThread = std::thread([this]
+                                           { tftpTargetHardwareServer->startListening(); });
+    std::thread targetHardwareStatusThread = std::thread([&]
+                                                         { fleetServerContext.sendStatus(tftpTargetHardwareStatusClient); });
+
+    // One status file in flight at a time, so each callback matches the
+    // last status file sent
+    const int numberOfAuthentications = 200;
+    for (int i = 0; i < numberOfAuthentications; i++)
+    {
+        std::shared_ptr<AuthenticationHandle> handle;
+        ASSERT_EQ(authenticationDataLoader->authenticateAsync(
+                      TARGET_HARDWARE_ID, TARGET_HARDWARE_POSITION, TARGET_HARDWARE_IP,
+                      loadList, nullptr, nullptr, handle),
+                  AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+        ASSERT_EQ(handle->getFuture().get(),
+                  AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    }
+
+    fleetServerContext.stop();
+    targetHardwareStatusThread.join();
+
+    tftpTargetHardwareServer->stopListening();
+    serverThread.join();
+
+    std::vector<double> &latencies = statusLatencyContext.latencies;
+    ASSERT_EQ(latencies.size(), 2 * numberOfAuthentications);
+    std::sort(latencies.begin(), latencies.end());
+    printf("Status to callback latency: p50 %8.1f us, p99 %8.1f us, max %8.1f us\n",
+           latencies[latencies.size() / 2],
+           latencies[(latencies.size() * 99) / 100],
+           latencies.back());
+}
+
+TEST_F(AuthenticationDataLoaderBenchmark, WarmStart)
+{
+    FleetServerContext fleetServerContext;
+
+    tftpTargetHardwareServer->registerOpenFileCallback(
+        fleetOpenFileCallback, &fleetServerContext);
+
+    std::thread serverThread = std::thread([this]
+                                           { tftpTargetHardwareServer->startListening(); });
+    std::thread targetHardwareStatusThread = std::thread([&]
+                                                         { fleetServerContext.sendStatus(tftpTargetHardwareStatusClient); });
+
+    // Stopping the DataLoader before each authentication makes it start cold
+    const int numberOfAuthentications = 50;
+    double timeToRequest[2] = {0, 0};
+    for (int warm = 0; warm < 2; warm++)
+    {
+        for (int i = 0; i < numberOfAuthentications; i++)
+        {
+            if (!warm)
+            {
+                ASSERT_EQ(authenticationDataLoader->stop(),
+                          AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+            }
+
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            std::shared_ptr<AuthenticationHandle> handle;
+            ASSERT_EQ(authenticationDataLoader->authenticateAsync(
+                          TARGET_HARDWARE_ID, TARGET_HARDWARE_POSITION, TARGET_HARDWARE_IP,
+                          loadList, nullptr, nullptr, handle),
+                      AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+            ASSERT_EQ(handle->getFuture().get(),
+                      AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+
+            std::chrono::duration<double, std::micro> elapsed =
+                fleetServerContext.initializationRequestAt.load() - start;
+            timeToRequest[warm] += elapsed.count();
+        }
+    }
+
+    ASSERT_EQ(authenticationDataLoader->stop(),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+
+    fleetServerContext.stop();
+    targetHardwareStatusThread.join();
+
+    tftpTargetHardwareServer->stopListening();
+    serverThread.join();
+
+    printf("Time to first LAI request: cold %8.1f us, warm %8.1f us\n",
+           timeToRequest[0] / numberOfAuthentications,
+           timeToRequest[1] / numberOfAuthentications);
+}
+
+TEST_F(AuthenticationDataLoaderBenchmark, MultipleLoads)
+{
+    LoadFetchingServerContext serverContext;
+
+    tftpTargetHardwareServer->registerOpenFileCallback(
+        loadFetchingOpenFileCallback, &serverContext);
+    tftpTargetHardwareServer->registerSectionFinishedCallback(
+        loadFetchingSectionFinished, &serverContext);
+
+    std::thread serverThread = std::thread([this]
+                                           { tftpTargetHardwareServer->startListening(); });
+    std::thread targetHardwareThread = std::thread([&]
+                                                   { serverContext.run(tftpTargetHardwareStatusClient); });
+
+    const size_t maxLoads = 16;
+    std::vector<AuthenticationLoad> loads;
+    for (size_t i = 0; i < maxLoads; i++)
+    {
+        char fileName[64];
+        snprintf(fileName, sizeof(fileName), MULTIPLE_LOADS_FILE, i);
+        std::vector<char> content(MULTIPLE_LOADS_FILE_SIZE + i, (char)i);
+        std::ofstream file(fileName, std::ios::binary);
+        file.write(content.data(), content.size());
+        loads.push_back(std::make_tuple(std::string(fileName), std::to_string(i)));
+    }
+
+    // Every load in one authentication, against one authentication per load
+    const size_t numberOfLoads[] = {1, 4, 16};
+    for (size_t n : numberOfLoads)
+    {
+        std::vector<AuthenticationLoad> loadList(loads.begin(), loads.begin() + n);
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        std::shared_ptr<AuthenticationHandle> handle;
+        ASSERT_EQ(authenticationDataLoader->authenticateAsync(
+                      TARGET_HARDWARE_ID, TARGET_HARDWARE_POSITION, TARGET_HARDWARE_IP,
+                      loadList, nullptr, nullptr, handle),
+                  AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+        ASSERT_EQ(handle->getFuture().get(),
+                  AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+        std::chrono::duration<double, std::milli> together = std::chrono::steady_clock::now() - start;
+
+        start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < n; i++)
+        {
+            std::vector<AuthenticationLoad> singleLoad(1, loads[i]);
+            ASSERT_EQ(authenticationDataLoader->authenticateAsync(
+                          TARGET_HARDWARE_ID, TARGET_HARDWARE_POSITION, TARGET_HARDWARE_IP,
+                          singleLoad, nullptr, nullptr, handle),
+                      AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+            ASSERT_EQ(handle->getFuture().get(),
+                      AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+        }
+        std::chrono::duration<double, std::milli> separate = std::chrono::steady_clock::now() - start;
+
+        printf("Multiple loads: %2zu loads, %8.2f ms in one authentication, %8.2f ms in %zu\n",
+               n, together.count(), separate.count(), n);
+    }
+
+    serverContext.stop();
+    targetHardwareThread.join();
+
+    tftpTargetHardwareServer->stopListening();
+    serverThread.join();
+
+    for (size_t i = 0; i < maxLoads; i++)
+    {
+        remove(std::get<LOAD_FILE_NAME_IDX>(loads[i]).c_str());
+    }
+}
+
+TEST_F(AuthenticationDataLoaderBenchmark, AbortLatency)
+{
+    FleetServerContext fleetServerContext;
+    AbortServerContext abortServerContext(&fleetServerContext);
+
+    tftpTargetHardwareServer->registerOpenFileCallback(
+        abortOpenFileCallback, &abortServerContext);
+
+    std::thread serverThread = std::thread([this]
+                                           { tftpTargetHardwareServer->startListening(); });
+    std::thread targetHardwareStatusThread = std::thread([&]
+                                                         { fleetServerContext.sendStatus(tftpTargetHardwareStatusClient); });
+    std::thread targetHardwareAbortThread = std::thread([&]
+                                                        { abortServerContext.sendStatus(); });
+
+    // The target hardware is told to abort on its very next status file,
+    // and the authentication ends as soon as it reports the abort
+    const int numberOfAborts = 50;
+    std::vector<double> latencies;
+    for (int i = 0; i < numberOfAborts; i++)
+    {
+        std::shared_ptr<AuthenticationHandle> handle;
+        ASSERT_EQ(authenticationDataLoader->authenticateAsync(
+                      TARGET_HARDWARE_ID, TARGET_HARDWARE_POSITION, TARGET_HARDWARE_IP,
+                      loadList, nullptr, nullptr, handle),
+                  AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+        while (!abortServerContext.loadListReceived)
+        {
+            std::this_thread::yield();
+        }
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        ASSERT_EQ(authenticationDataLoader->abort(AUTHENTICATION_ABORT_SOURCE_DATALOADER),
+                  AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+        ASSERT_EQ(handle->getFuture().get(),
+                  AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR);
+        std::chrono::duration<double, std::micro> latency = std::chrono::steady_clock::now() - start;
+        latencies.push_back(latency.count());
+        while (abortServerContext.loadListReceived)
+        {
+            std::this_thread::yield();
+        }
+    }
+    std::sort(latencies.begin(), latencies.end());
+    printf("Abort to end, status files in flight: p50 %8.1f us, max %8.1f us\n",
+           latencies[latencies.size() / 2], latencies.back());
+    // One status period of a real target hardware is a whole second
+    EXPECT_LT(latencies[latencies.size() / 2], 50000);
+
+    abortServerContext.stopSending = true;
+    targetHardwareAbortThread.join();
+
+    // A transfer waiting to be retried gives up at once
+    BusyServerContext busyServerContext(&fleetServerContext);
+    busyServerContext.waitsToAnswer = 1000;
+    tftpTargetHardwareServer->registerOpenFileCallback(
+        busyOpenFileCallback, &busyServerContext);
+    const int numberOfRetryAborts = 10;
+    latencies.clear();
+    for (int i = 0; i < numberOfRetryAborts; i++)
+    {
+        std::shared_ptr<AuthenticationHandle> handle;
+        ASSERT_EQ(authenticationDataLoader->authenticateAsync(
+                      TARGET_HARDWARE_ID, TARGET_HARDWARE_POSITION, TARGET_HARDWARE_IP,
+                      loadList, nullptr, nullptr, handle),
+                  AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+        uint32_t retries = 0;
+        uint32_t waits = 0;
+        while (waits == 0)
+        {
+            handle->getRetryStatistics(retries, waits);
+            std::this_thread::yield();
+        }
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        ASSERT_EQ(authenticationDataLoader->abort(AUTHENTICATION_ABORT_SOURCE_DATALOADER),
+                  AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+        ASSERT_EQ(handle->getFuture().get(),
+                  AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR);
+        std::chrono::duration<double, std::micro> latency = std::chrono::steady_clock::now() - start;
+        latencies.push_back(latency.count());
+    }
+    std::sort(latencies.begin(), latencies.end());
+    printf("Abort to end, transfer waiting to be retried: p50 %8.1f us, max %8.1f us\n",
+           latencies[latencies.size() / 2], latencies.back());
+    // Long before the target hardware would be asked again
+    EXPECT_LT(latencies.back(), 1000000 * DEFAULT_WAIT_TIME);
+
+    fleetServerContext.stop();
+    targetHardwareStatusThread.join();
+
+    tftpTargetHardwareServer->stopListening();
+    serverThread.join();
+}
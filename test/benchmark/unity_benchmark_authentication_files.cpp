@@ -0,0 +1,782 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <string>
+
+#include "AuthenticationBufferReader.h"
+#include "AuthenticationBufferWriter.h"
+#include "AuthenticationFileValidator.h"
+#include "AuthenticationLog.h"
+#include "LoadAuthenticationRequestFile.h"
+#include "LoadAuthenticationStatusEncoder.h"
+#include "LoadAuthenticationStatusFile.h"
+#include "LoadAuthenticationStatusView.h"
+
+#define BENCHMARK_REPETITIONS 3
+
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+#include <malloc.h>
+#define BENCHMARK_HEAP_IN_USE() (mallinfo2().uordblks)
+#endif
+
+// Decoding must scale linearly with the number of header files. The per-header
+// cost may grow with the working set (caches, page faults), so the check only
+// fails when it grows by more than half the growth of the number of headers,
+// which is what copying the remaining buffer for every header file produces.
+#define BENCHMARK_MIN_PER_HEADER_GROWTH 8.0
+
+static double benchmarkMaxPerHeaderGrowth(size_t numberOfHeaders, size_t firstNumberOfHeaders)
+{
+    double countGrowth = (double)numberOfHeaders / firstNumberOfHeaders;
+    return std::max(BENCHMARK_MIN_PER_HEADER_GROWTH, countGrowth / 2);
+}
+
+static const size_t benchmarkHeaderCounts[] = {1024, 4096, 16384, 65535};
+
+static void buildLoadAuthenticationStatusFile(
+    LoadAuthenticationStatusFile &file, size_t numberOfHeaders)
+{
+    for (size_t i = 0; i < numberOfHeaders; i++)
+    {
+        LoadAuthenticationStatusHeaderFile headerFile;
+        headerFile.setHeaderFileName("HEADER_" + std::to_string(i) + ".BIN");
+        headerFile.setLoadPartNumberName("PN" + std::to_string(i));
+        headerFile.setLoadRatio(i % 100);
+        headerFile.setLoadStatus(0x0003);
+        headerFile.setLoadStatusDescription("OK");
+        file.addHeaderFile(headerFile);
+    }
+}
+
+static void buildLoadAuthenticationRequestFile(
+    LoadAuthenticationRequestFile &file, size_t numberOfHeaders)
+{
+    for (size_t i = 0; i < numberOfHeaders; i++)
+    {
+        LoadAuthenticationRequestHeaderFile headerFile;
+        headerFile.setHeaderFileName("HEADER_" + std::to_string(i) + ".BIN");
+        headerFile.setLoadPartNumberName("PN" + std::to_string(i));
+        file.addHeaderFile(headerFile);
+    }
+}
+
+template <typename FileType>
+static double benchmarkDeserializeNsPerHeader(
+    std::shared_ptr<std::vector<uint8_t>> &data, size_t numberOfHeaders)
+{
+    double best = 0;
+    for (int repetition = 0; repetition < BENCHMARK_REPETITIONS; repetition++)
+    {
+        FileType file("BENCHMARK", "A4");
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        SerializableAuthenticationOperationResult result = file.deserialize(data);
+        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        EXPECT_EQ(result, SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK);
+
+        double elapsed = std::chrono::duration<double, std::nano>(end - start).count();
+        if (repetition == 0 || elapsed < best)
+        {
+            best = elapsed;
+        }
+    }
+    return best / numberOfHeaders;
+}
+
+TEST(AuthenticationBenchmark, LoadAuthenticationStatusFileDeserializeScaling)
+{
+    double firstNsPerHeader = 0;
+    for (size_t i = 0; i < sizeof(benchmarkHeaderCounts) / sizeof(benchmarkHeaderCounts[0]); i++)
+    {
+        size_t numberOfHeaders = benchmarkHeaderCounts[i];
+        LoadAuthenticationStatusFile file("BENCHMARK", "A4");
+        buildLoadAuthenticationStatusFile(file, numberOfHeaders);
+
+        std::shared_ptr<std::vector<uint8_t>> data = std::make_shared<std::vector<uint8_t>>();
+        ASSERT_EQ(file.serialize(data),
+                  SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK);
+
+        double nsPerHeader =
+            benchmarkDeserializeNsPerHeader<LoadAuthenticationStatusFile>(data, numberOfHeaders);
+        printf("LAS deserialize: %6zu headers, %8zu bytes, %8.1f ns/header\n",
+               numberOfHeaders, data->size(), nsPerHeader);
+
+        if (i == 0)
+        {
+            firstNsPerHeader = nsPerHeader;
+        }
+        EXPECT_LT(nsPerHeader, firstNsPerHeader *
+                                   benchmarkMaxPerHeaderGrowth(numberOfHeaders,
+                                                               benchmarkHeaderCounts[0]));
+    }
+}
+
+TEST(AuthenticationBenchmark, LoadAuthenticationRequestFileDeserializeScaling)
+{
+    double firstNsPerHeader = 0;
+    for (size_t i = 0; i < sizeof(benchmarkHeaderCounts) / sizeof(benchmarkHeaderCounts[0]); i++)
+    {
+        size_t numberOfHeaders = benchmarkHeaderCounts[i];
+        LoadAuthenticationRequestFile file("BENCHMARK", "A4");
+        buildLoadAuthenticationRequestFile(file, numberOfHeaders);
+
+        std::shared_ptr<std::vector<uint8_t>> data = std::make_shared<std::vector<uint8_t>>();
+        ASSERT_EQ(file.serialize(data),
+                  SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK);
+
+        double nsPerHeader =
+            benchmarkDeserializeNsPerHeader<LoadAuthenticationRequestFile>(data, numberOfHeaders);
+        printf("LAR deserialize: %6zu headers, %8zu bytes, %8.1f ns/header\n",
+               numberOfHeaders, data->size(), nsPerHeader);
+
+        if (i == 0)
+        {
+            firstNsPerHeader = nsPerHeader;
+        }
+        EXPECT_LT(nsPerHeader, firstNsPerHeader *
+                                   benchmarkMaxPerHeaderGrowth(numberOfHeaders,
+                                                               benchmarkHeaderCounts[0]));
+    }
+}
+
+// Load lists hold thousands of entries, so each entry must only pay for the
+// bytes its strings really use, not for the largest string allowed.
+TEST(AuthenticationBenchmark, LoadAuthenticationStatusFileMemoryPerHeader)
+{
+    size_t numberOfHeaders = 65535;
+    size_t maxHeaderSize = MAX_HEADER_FILE_NAME_SIZE + MAX_LOAD_PART_NUMBER_NAME_SIZE +
+                           MAX_LOAD_STATUS_DESCRIPTION_SIZE;
+    printf("LAS header file: %zu bytes per object, %zu bytes with the largest strings\n",
+           sizeof(LoadAuthenticationStatusHeaderFile), maxHeaderSize);
+    EXPECT_LT(sizeof(LoadAuthenticationStatusHeaderFile), maxHeaderSize / 2);
+
+#ifdef BENCHMARK_HEAP_IN_USE
+    std::shared_ptr<std::vector<uint8_t>> data = std::make_shared<std::vector<uint8_t>>();
+    {
+        LoadAuthenticationStatusFile file("BENCHMARK", "A4");
+        buildLoadAuthenticationStatusFile(file, numberOfHeaders);
+        ASSERT_EQ(file.serialize(data),
+                  SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK);
+    }
+
+    size_t heapBefore = BENCHMARK_HEAP_IN_USE();
+    LoadAuthenticationStatusFile file("BENCHMARK", "A4");
+    ASSERT_EQ(file.deserialize(data),
+              SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK);
+    size_t heapAfter = BENCHMARK_HEAP_IN_USE();
+
+    double bytesPerHeader = (double)(heapAfter - heapBefore) / numberOfHeaders;
+    printf("LAS load list: %zu headers, %.1f heap bytes/header\n",
+           numberOfHeaders, bytesPerHeader);
+    EXPECT_LT(bytesPerHeader, maxHeaderSize / 2);
+#endif
+}
+
+TEST(AuthenticationBenchmark, LoadAuthenticationRequestFileMemoryPerHeader)
+{
+    size_t numberOfHeaders = 65535;
+    size_t maxHeaderSize = MAX_HEADER_FILE_NAME_SIZE + MAX_LOAD_PART_NUMBER_NAME_SIZE;
+    printf("LAR header file: %zu bytes per object, %zu bytes with the largest strings\n",
+           sizeof(LoadAuthenticationRequestHeaderFile), maxHeaderSize);
+    EXPECT_LT(sizeof(LoadAuthenticationRequestHeaderFile), maxHeaderSize / 2);
+
+#ifdef BENCHMARK_HEAP_IN_USE
+    std::shared_ptr<std::vector<uint8_t>> data = std::make_shared<std::vector<uint8_t>>();
+    {
+        LoadAuthenticationRequestFile file("BENCHMARK", "A4");
+        buildLoadAuthenticationRequestFile(file, numberOfHeaders);
+        ASSERT_EQ(file.serialize(data),
+                  SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK);
+    }
+
+    size_t heapBefore = BENCHMARK_HEAP_IN_USE();
+    LoadAuthenticationRequestFile file("BENCHMARK", "A4");
+    ASSERT_EQ(file.deserialize(data),
+              SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK);
+    size_t heapAfter = BENCHMARK_HEAP_IN_USE();
+
+    double bytesPerHeader = (double)(heapAfter - heapBefore) / numberOfHeaders;
+    printf("LAR load list: %zu headers, %.1f heap bytes/header\n",
+           numberOfHeaders, bytesPerHeader);
+    EXPECT_LT(bytesPerHeader, maxHeaderSize / 2);
+#endif
+}
+
+// Reference JSON built the way serializeJSON used to build it: each level
+// prints a cJSON tree that its parent parses back before adding its members.
+static std::string printAndDeleteCJSON(cJSON *root)
+{
+    char *printed = cJSON_PrintUnformatted(root);
+    std::string json(printed);
+    free(printed);
+    cJSON_Delete(root);
+    return json;
+}
+
+static std::string serializeJSONWithCJSON(LoadAuthenticationStatusFile &file)
+{
+    std::string fileName;
+    uint32_t fileLength = 0;
+    std::string protocolVersion;
+    file.getFileName(fileName);
+    file.getFileLength(fileLength);
+    file.getProtocolVersion(protocolVersion);
+
+    cJSON *base = cJSON_CreateObject();
+    cJSON_AddItemToObject(base, "fileName", cJSON_CreateString(fileName.c_str()));
+    cJSON_AddItemToObject(base, "fileLength", cJSON_CreateNumber(fileLength));
+    cJSON_AddItemToObject(base, "protocolVersion", cJSON_CreateString(protocolVersion.c_str()));
+    std::string baseJSON = printAndDeleteCJSON(base);
+
+    uint16_t statusCode = 0;
+    uint8_t descriptionLength = 0;
+    std::string description;
+    uint16_t counter = 0;
+    uint16_t exceptionTimer = 0;
+    uint16_t estimatedTime = 0;
+    uint32_t loadListRatio = 0;
+    std::shared_ptr<std::vector<LoadAuthenticationStatusHeaderFile>> headerFiles;
+    file.getAuthenticationOperationStatusCode(statusCode);
+    file.getAuthenticationStatusDescriptionLength(descriptionLength);
+    file.getAuthenticationStatusDescription(description);
+    file.getCounter(counter);
+    file.getExceptionTimer(exceptionTimer);
+    file.getEstimatedTime(estimatedTime);
+    file.getLoadListRatio(loadListRatio);
+    file.getHeaderFiles(headerFiles);
+
+    cJSON *root = cJSON_Parse(baseJSON.c_str());
+    cJSON_AddItemToObject(root, "authenticationOperationStatusCode", cJSON_CreateNumber(statusCode));
+    cJSON_AddItemToObject(root, "authenticationStatusDescriptionLength", cJSON_CreateNumber(descriptionLength));
+    cJSON_AddItemToObject(root, "authenticationStatusDescription", cJSON_CreateString(description.c_str()));
+    cJSON_AddItemToObject(root, "counter", cJSON_CreateNumber(counter));
+    cJSON_AddItemToObject(root, "exceptionTimer", cJSON_CreateNumber(exceptionTimer));
+    cJSON_AddItemToObject(root, "estimatedTime", cJSON_CreateNumber(estimatedTime));
+    cJSON_AddItemToObject(root, "loadListRatio", cJSON_CreateNumber(loadListRatio));
+    cJSON_AddItemToObject(root, "numberOfHeaderFiles", cJSON_CreateNumber(headerFiles->size()));
+
+    cJSON *headerFilesJSON = cJSON_CreateArray();
+    cJSON_AddItemToObject(root, "headerFiles", headerFilesJSON);
+    for (std::vector<LoadAuthenticationStatusHeaderFile>::iterator it = headerFiles->begin();
+         it != headerFiles->end(); ++it)
+    {
+        uint8_t headerFileNameLength = 0;
+        std::string headerFileName;
+        uint8_t loadPartNumberNameLength = 0;
+        std::string loadPartNumberName;
+        uint32_t loadRatio = 0;
+        uint16_t loadStatus = 0;
+        uint8_t loadStatusDescriptionLength = 0;
+        std::string loadStatusDescription;
+        it->getHeaderFileNameLength(headerFileNameLength);
+        it->getHeaderFileName(headerFileName);
+        it->getLoadPartNumberNameLength(loadPartNumberNameLength);
+        it->getLoadPartNumberName(loadPartNumberName);
+        it->getLoadRatio(loadRatio);
+        it->getLoadStatus(loadStatus);
+        it->getLoadStatusDescriptionLength(loadStatusDescriptionLength);
+        it->getLoadStatusDescription(loadStatusDescription);
+
+        cJSON *header = cJSON_CreateObject();
+        cJSON_AddItemToObject(header, "headerFileNameLength", cJSON_CreateNumber(headerFileNameLength));
+        cJSON_AddItemToObject(header, "headerFileName", cJSON_CreateString(headerFileName.c_str()));
+        cJSON_AddItemToObject(header, "loadPartNumberNameLength", cJSON_CreateNumber(loadPartNumberNameLength));
+        cJSON_AddItemToObject(header, "loadPartNumberName", cJSON_CreateString(loadPartNumberName.c_str()));
+        cJSON_AddItemToObject(header, "loadRatio", cJSON_CreateNumber(loadRatio));
+        cJSON_AddItemToObject(header, "loadStatus", cJSON_CreateNumber(loadStatus));
+        cJSON_AddItemToObject(header, "loadStatusDescriptionLength", cJSON_CreateNumber(loadStatusDescriptionLength));
+        cJSON_AddItemToObject(header, "loadStatusDescription", cJSON_CreateString(loadStatusDescription.c_str()));
+        std::string headerJSON = printAndDeleteCJSON(header);
+        cJSON_AddItemToArray(headerFilesJSON, cJSON_Parse(headerJSON.c_str()));
+    }
+
+    return printAndDeleteCJSON(root);
+}
+
+TEST(AuthenticationBenchmark, LoadAuthenticationStatusFileSerializeJSON)
+{
+    const size_t jsonHeaderCounts[] = {1, 64, 4096};
+    for (size_t i = 0; i < sizeof(jsonHeaderCounts) / sizeof(jsonHeaderCounts[0]); i++)
+    {
+        size_t numberOfHeaders = jsonHeaderCounts[i];
+        LoadAuthenticationStatusFile file("BENCHMARK", "A4");
+        file.setAuthenticationOperationStatusCode(0x0003);
+        file.setAuthenticationStatusDescription("In \"progress\"\n");
+        buildLoadAuthenticationStatusFile(file, numberOfHeaders);
+
+        double bestCJSON = 0;
+        double bestWriter = 0;
+        std::string referenceJSON;
+        std::string data;
+        for (int repetition = 0; repetition < BENCHMARK_REPETITIONS; repetition++)
+        {
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            referenceJSON = serializeJSONWithCJSON(file);
+            std::chrono::steady_clock::time_point middle = std::chrono::steady_clock::now();
+            ASSERT_EQ(file.serializeJSON(data),
+                      SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK);
+            std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+            double elapsedCJSON = std::chrono::duration<double, std::micro>(middle - start).count();
+            double elapsedWriter = std::chrono::duration<double, std::micro>(end - middle).count();
+            if (repetition == 0 || elapsedCJSON < bestCJSON)
+            {
+                bestCJSON = elapsedCJSON;
+            }
+            if (repetition == 0 || elapsedWriter < bestWriter)
+            {
+                bestWriter = elapsedWriter;
+            }
+        }
+
+        ASSERT_EQ(data, referenceJSON);
+        printf("LAS serializeJSON: %5zu headers, %8zu bytes, cJSON %9.1f us, writer %9.1f us\n",
+               numberOfHeaders, data.size(), bestCJSON, bestWriter);
+        EXPECT_LT(bestWriter, bestCJSON);
+    }
+}
+
+template <typename FileType>
+static double benchmarkDeserializeJSONNsPerHeader(std::string &data, size_t numberOfHeaders)
+{
+    double best = 0;
+    for (int repetition = 0; repetition < BENCHMARK_REPETITIONS; repetition++)
+    {
+        FileType file("BENCHMARK", "A4");
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        SerializableAuthenticationOperationResult result = file.deserializeJSON(data);
+        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        EXPECT_EQ(result, SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK);
+
+        double elapsed = std::chrono::duration<double, std::nano>(end - start).count();
+        if (repetition == 0 || elapsed < best)
+        {
+            best = elapsed;
+        }
+    }
+    return best / numberOfHeaders;
+}
+
+TEST(AuthenticationBenchmark, LoadAuthenticationStatusFileDeserializeJSONScaling)
+{
+    double firstNsPerHeader = 0;
+    for (size_t i = 0; i < sizeof(benchmarkHeaderCounts) / sizeof(benchmarkHeaderCounts[0]); i++)
+    {
+        size_t numberOfHeaders = benchmarkHeaderCounts[i];
+        LoadAuthenticationStatusFile file("BENCHMARK", "A4");
+        buildLoadAuthenticationStatusFile(file, numberOfHeaders);
+
+        std::string data;
+        ASSERT_EQ(file.serializeJSON(data),
+                  SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK);
+
+        double nsPerHeader =
+            benchmarkDeserializeJSONNsPerHeader<LoadAuthenticationStatusFile>(data, numberOfHeaders);
+        printf("LAS deserializeJSON: %6zu headers, %8zu bytes, %8.1f ns/header\n",
+               numberOfHeaders, data.size(), nsPerHeader);
+
+        if (i == 0)
+        {
+            firstNsPerHeader = nsPerHeader;
+        }
+        EXPECT_LT(nsPerHeader, firstNsPerHeader *
+                                   benchmarkMaxPerHeaderGrowth(numberOfHeaders,
+                                                               benchmarkHeaderCounts[0]));
+    }
+}
+
+TEST(AuthenticationBenchmark, LoadAuthenticationRequestFileDeserializeJSONScaling)
+{
+    double firstNsPerHeader = 0;
+    for (size_t i = 0; i < sizeof(benchmarkHeaderCounts) / sizeof(benchmarkHeaderCounts[0]); i++)
+    {
+        size_t numberOfHeaders = benchmarkHeaderCounts[i];
+        LoadAuthenticationRequestFile file("BENCHMARK", "A4");
+        buildLoadAuthenticationRequestFile(file, numberOfHeaders);
+
+        std::string data;
+        ASSERT_EQ(file.serializeJSON(data),
+                  SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK);
+
+        double nsPerHeader =
+            benchmarkDeserializeJSONNsPerHeader<LoadAuthenticationRequestFile>(data, numberOfHeaders);
+        printf("LAR deserializeJSON: %6zu headers, %8zu bytes, %8.1f ns/header\n",
+               numberOfHeaders, data.size(), nsPerHeader);
+
+        if (i == 0)
+        {
+            firstNsPerHeader = nsPerHeader;
+        }
+        EXPECT_LT(nsPerHeader, firstNsPerHeader *
+                                   benchmarkMaxPerHeaderGrowth(numberOfHeaders,
+                                                               benchmarkHeaderCounts[0]));
+    }
+}
+
+#define BENCHMARK_STATUS_PERIODS 1000
+
+// Cost of one status period when a single header file changed: the status
+// file is either built and serialized again or patched by the encoder.
+TEST(AuthenticationBenchmark, LoadAuthenticationStatusEncoderPerPeriod)
+{
+    double firstNsPerPeriod = 0;
+    for (size_t i = 0; i < sizeof(benchmarkHeaderCounts) / sizeof(benchmarkHeaderCounts[0]); i++)
+    {
+        size_t numberOfHeaders = benchmarkHeaderCounts[i];
+        LoadAuthenticationStatusFile file("BENCHMARK", "A4");
+        buildLoadAuthenticationStatusFile(file, numberOfHeaders);
+        std::shared_ptr<std::vector<LoadAuthenticationStatusHeaderFile>> headerFiles;
+        file.getHeaderFiles(headerFiles);
+
+        std::vector<uint8_t> buffer;
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        {
+            LoadAuthenticationStatusFile periodFile("BENCHMARK", "A4");
+            periodFile.setCounter(1);
+            for (std::vector<LoadAuthenticationStatusHeaderFile>::iterator it =
+                     headerFiles->begin();
+                 it != headerFiles->end(); ++it)
+            {
+                periodFile.addHeaderFile(*it);
+            }
+            size_t fileSize = 0;
+            size_t written = 0;
+            periodFile.getFileSize(fileSize);
+            buffer.resize(fileSize);
+            ASSERT_EQ(periodFile.serializeInto(buffer.data(), buffer.size(), written),
+                      SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK);
+        }
+        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        double rebuildNs = std::chrono::duration<double, std::nano>(end - start).count();
+
+        LoadAuthenticationStatusEncoder encoder("A4");
+        encoder.setHeaderFiles(headerFiles);
+        uint8_t *data = nullptr;
+        size_t size = 0;
+        ASSERT_EQ(encoder.encode(data, size),
+                  SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK);
+
+        start = std::chrono::steady_clock::now();
+        for (uint16_t period = 1; period <= BENCHMARK_STATUS_PERIODS; period++)
+        {
+            size_t headerFileIndex = (period * 7919) % numberOfHeaders;
+            encoder.setCounter(period);
+            encoder.setLoadListRatio(period % 100);
+            encoder.setHeaderFileLoadStatus(headerFileIndex, 0x0003);
+            encoder.setHeaderFileLoadRatio(headerFileIndex, 100);
+            encoder.encode(data, size);
+        }
+        end = std::chrono::steady_clock::now();
+        double nsPerPeriod =
+            std::chrono::duration<double, std::nano>(end - start).count() / BENCHMARK_STATUS_PERIODS;
+
+        ASSERT_EQ(encoder.getNumberOfFullEncodes(), 1);
+        ASSERT_EQ(size, buffer.size());
+        printf("LAS status period: %6zu headers, rebuild %11.1f ns, encoder %8.1f ns\n",
+               numberOfHeaders, rebuildNs, nsPerPeriod);
+
+        if (i == 0)
+        {
+            firstNsPerPeriod = nsPerPeriod;
+        }
+        // Flat: only cache misses on the patched header file may add up
+        EXPECT_LT(nsPerPeriod, firstNsPerPeriod * BENCHMARK_MIN_PER_HEADER_GROWTH);
+        EXPECT_LT(nsPerPeriod, rebuildNs);
+    }
+}
+
+#define BENCHMARK_CODEC_HEADERS 16384
+#define BENCHMARK_CODEC_MAX_OVERHEAD 2.0
+
+struct BenchmarkStatusHeader
+{
+    std::string headerFileName;
+    std::string loadPartNumberName;
+    uint32_t loadRatio;
+    uint16_t loadStatus;
+    std::string loadStatusDescription;
+};
+
+static std::string benchmarkWireString(std::string value)
+{
+    return std::string(value.c_str(), value.size() + 1);
+}
+
+// Hand-written encoder of the same Load Authentication Status file, as the
+// classes were written before their codecs were generated.
+static bool benchmarkReferenceEncode(AuthenticationBufferWriter &writer, uint32_t fileLength,
+                                     std::vector<BenchmarkStatusHeader> &headers)
+{
+    if (!writer.putUint32(fileLength) || !writer.putBytes("A4", PROTOCOL_VERSION_SIZE) ||
+        !writer.putUint16(0) || !writer.putUint8(0) || !writer.putUint16(0) ||
+        !writer.putUint16(0) || !writer.putUint16(0) || !writer.putUint24(0) ||
+        !writer.putUint16(headers.size()))
+    {
+        return false;
+    }
+    for (std::vector<BenchmarkStatusHeader>::iterator it = headers.begin(); it != headers.end();
+         ++it)
+    {
+        if (!writer.putUint8(it->headerFileName.size()) ||
+            !writer.putBytes(it->headerFileName.data(), it->headerFileName.size()) ||
+            !writer.putUint8(it->loadPartNumberName.size()) ||
+            !writer.putBytes(it->loadPartNumberName.data(), it->loadPartNumberName.size()) ||
+            !writer.putUint24(it->loadRatio) || !writer.putUint16(it->loadStatus) ||
+            !writer.putUint8(it->loadStatusDescription.size()) ||
+            !writer.putBytes(it->loadStatusDescription.data(), it->loadStatusDescription.size()))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool benchmarkReferenceGetString(AuthenticationBufferReader &reader, std::string &value)
+{
+    uint8_t length = 0;
+    AuthenticationFieldView field;
+    if (!reader.getUint8(length) || !reader.getField(length, field))
+    {
+        return false;
+    }
+    value.assign(reinterpret_cast<const char *>(field.data()), field.size());
+    return true;
+}
+
+static bool benchmarkReferenceDecode(AuthenticationBufferReader &reader,
+                                     std::vector<BenchmarkStatusHeader> &headers)
+{
+    uint32_t fileLength = 0;
+    AuthenticationFieldView field;
+    uint16_t value16 = 0;
+    uint32_t value24 = 0;
+    std::string description;
+    uint16_t numberOfHeaderFiles = 0;
+    if (!reader.getUint32(fileLength) || !reader.getField(PROTOCOL_VERSION_SIZE, field) ||
+        !reader.getUint16(value16) || !benchmarkReferenceGetString(reader, description) ||
+        !reader.getUint16(value16) || !reader.getUint16(value16) ||
+        !reader.getUint16(value16) || !reader.getUint24(value24) ||
+        !reader.getUint16(numberOfHeaderFiles))
+    {
+        return false;
+    }
+    headers.reserve(numberOfHeaderFiles);
+    for (uint16_t i = 0; i < numberOfHeaderFiles; i++)
+    {
+        BenchmarkStatusHeader header;
+        if (!benchmarkReferenceGetString(reader, header.headerFileName) ||
+            !benchmarkReferenceGetString(reader, header.loadPartNumberName) ||
+            !reader.getUint24(header.loadRatio) || !reader.getUint16(header.loadStatus) ||
+            !benchmarkReferenceGetString(reader, header.loadStatusDescription))
+        {
+            return false;
+        }
+        headers.push_back(header);
+    }
+    return true;
+}
+
+// Throughput of the generated codec against the hand-written reference: the
+// declarative field lists must not cost more than straight-line code.
+TEST(AuthenticationBenchmark, LoadAuthenticationStatusFileCodecThroughput)
+{
+    LoadAuthenticationStatusFile file("BENCHMARK", "A4");
+    buildLoadAuthenticationStatusFile(file, BENCHMARK_CODEC_HEADERS);
+    std::vector<BenchmarkStatusHeader> headers;
+    for (size_t i = 0; i < BENCHMARK_CODEC_HEADERS; i++)
+    {
+        BenchmarkStatusHeader header;
+        header.headerFileName = benchmarkWireString("HEADER_" + std::to_string(i) + ".BIN");
+        header.loadPartNumberName = benchmarkWireString("PN" + std::to_string(i));
+        header.loadRatio = i % 100;
+        header.loadStatus = 0x0003;
+        header.loadStatusDescription = benchmarkWireString("OK");
+        headers.push_back(header);
+    }
+
+    size_t fileSize = 0;
+    ASSERT_EQ(file.getFileSize(fileSize),
+              FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK);
+    std::vector<uint8_t> codecBuffer(fileSize);
+    std::vector<uint8_t> referenceBuffer(fileSize);
+
+    double codecEncodeNs = 0;
+    double referenceEncodeNs = 0;
+    double codecDecodeNs = 0;
+    double referenceDecodeNs = 0;
+    for (int repetition = 0; repetition < BENCHMARK_REPETITIONS; repetition++)
+    {
+        size_t written = 0;
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        SerializableAuthenticationOperationResult result =
+            file.serializeInto(codecBuffer.data(), codecBuffer.size(), written);
+        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        ASSERT_EQ(result, SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK);
+        ASSERT_EQ(written, fileSize);
+        double elapsed = std::chrono::duration<double, std::nano>(end - start).count();
+        codecEncodeNs = (repetition == 0) ? elapsed : std::min(codecEncodeNs, elapsed);
+
+        AuthenticationBufferWriter writer(referenceBuffer.data(), referenceBuffer.size());
+        start = std::chrono::steady_clock::now();
+        bool encoded = benchmarkReferenceEncode(writer, fileSize, headers);
+        end = std::chrono::steady_clock::now();
+        ASSERT_TRUE(encoded);
+        elapsed = std::chrono::duration<double, std::nano>(end - start).count();
+        referenceEncodeNs = (repetition == 0) ? elapsed : std::min(referenceEncodeNs, elapsed);
+        ASSERT_EQ(codecBuffer, referenceBuffer);
+
+        std::shared_ptr<std::vector<uint8_t>> data =
+            std::make_shared<std::vector<uint8_t>>(codecBuffer);
+        LoadAuthenticationStatusFile decodedFile("BENCHMARK", "A4");
+        start = std::chrono::steady_clock::now();
+        result = decodedFile.deserialize(data);
+        end = std::chrono::steady_clock::now();
+        ASSERT_EQ(result, SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK);
+        elapsed = std::chrono::duration<double, std::nano>(end - start).count();
+        codecDecodeNs = (repetition == 0) ? elapsed : std::min(codecDecodeNs, elapsed);
+
+        std::vector<BenchmarkStatusHeader> decodedHeaders;
+        AuthenticationBufferReader reader(referenceBuffer.data(), referenceBuffer.size());
+        start = std::chrono::steady_clock::now();
+        bool decoded = benchmarkReferenceDecode(reader, decodedHeaders);
+        end = std::chrono::steady_clock::now();
+        ASSERT_TRUE(decoded);
+        ASSERT_EQ(decodedHeaders.size(), BENCHMARK_CODEC_HEADERS);
+        elapsed = std::chrono::duration<double, std::nano>(end - start).count();
+        referenceDecodeNs = (repetition == 0) ? elapsed : std::min(referenceDecodeNs, elapsed);
+    }
+
+    // bytes per ns * 1000 = MB/s
+    printf("LAS codec: %zu bytes, encode %8.1f MB/s (reference %8.1f MB/s), "
+           "decode %8.1f MB/s (reference %8.1f MB/s)\n",
+           fileSize, fileSize * 1000.0 / codecEncodeNs, fileSize * 1000.0 / referenceEncodeNs,
+           fileSize * 1000.0 / codecDecodeNs, fileSize * 1000.0 / referenceDecodeNs);
+
+    EXPECT_LT(codecEncodeNs, referenceEncodeNs * BENCHMARK_CODEC_MAX_OVERHEAD);
+    EXPECT_LT(codecDecodeNs, referenceDecodeNs * BENCHMARK_CODEC_MAX_OVERHEAD);
+}
+
+#define BENCHMARK_STATUS_FILES 100000
+// Size of the fixed buffers status files used to be received and copied in
+#define BENCHMARK_FIXED_RECEIVE_BUFFER_SIZE (10 * 1024)
+
+// Cost of processing one received status file the way the DataLoader does:
+// validate it, read its status code, and decode it for the JSON report.
+// Decoding in place must not be slower than copying the received buffer.
+TEST(AuthenticationBenchmark, LoadAuthenticationStatusFileReceivedCost)
+{
+    LoadAuthenticationStatusFile file("BENCHMARK.LAS", "A4");
+    file.setAuthenticationOperationStatusCode(0x0002);
+    std::shared_ptr<std::vector<uint8_t>> data = std::make_shared<std::vector<uint8_t>>();
+    ASSERT_EQ(file.serialize(data),
+              SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK);
+
+    // The status file at the start of the buffer it was received in
+    std::vector<uint8_t> receiveBuffer(BENCHMARK_FIXED_RECEIVE_BUFFER_SIZE);
+    std::copy(data->begin(), data->end(), receiveBuffer.begin());
+    const uint8_t *received = receiveBuffer.data();
+    size_t receivedSize = data->size();
+
+    AuthenticationFileValidator validator("A4");
+    double copyNs = 0;
+    double inPlaceNs = 0;
+    for (int repetition = 0; repetition < BENCHMARK_REPETITIONS; repetition++)
+    {
+        for (int inPlace = 0; inPlace < 2; inPlace++)
+        {
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            for (int i = 0; i < BENCHMARK_STATUS_FILES; i++)
+            {
+                size_t size = inPlace ? receivedSize : receiveBuffer.size();
+                ASSERT_EQ(validator.validate(received, size,
+                                             AuthenticationFileKind::AUTHENTICATION_FILE_KIND_LOAD_STATUS),
+                          AuthenticationFileValidationResult::AUTHENTICATION_FILE_VALID);
+                LoadAuthenticationStatusView view;
+                ASSERT_EQ(view.parse(received, size),
+                          SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK);
+
+                LoadAuthenticationStatusFile decodedFile("BENCHMARK.LAS", "A4");
+                SerializableAuthenticationOperationResult result;
+                if (inPlace)
+                {
+                    result = decodedFile.deserializeFrom(received, receivedSize);
+                }
+                else
+                {
+                    std::shared_ptr<std::vector<uint8_t>> copy =
+                        std::make_shared<std::vector<uint8_t>>(received, received + size);
+                    result = decodedFile.deserialize(copy);
+                }
+                ASSERT_EQ(result,
+                          SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK);
+            }
+            std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+            double elapsed = std::chrono::duration<double, std::nano>(end - start).count() /
+                             BENCHMARK_STATUS_FILES;
+            double &best = inPlace ? inPlaceNs : copyNs;
+            best = (repetition == 0) ? elapsed : std::min(best, elapsed);
+        }
+    }
+
+    printf("LAS received: %zu bytes, %8.1f ns/status copying %d bytes, %8.1f ns/status in place\n",
+           receivedSize, copyNs, BENCHMARK_FIXED_RECEIVE_BUFFER_SIZE, inPlaceNs);
+    EXPECT_LT(inPlaceNs, copyNs);
+}
+
+#define BENCHMARK_LOG_RECORDS 100000
+
+static void discardLogLine(AuthenticationLogLevel, const char *, void *)
+{
+}
+
+TEST(AuthenticationBenchmark, LogRecordCost)
+{
+    // Cost paid by the thread logging, the formatting is left to the drainer
+    AuthenticationLog &log = AuthenticationLog::getInstance();
+    log.flush();
+    log.setSink(discardLogLine, nullptr);
+    std::string baseFileName("TH0_POS");
+    uint64_t dropped = log.getNumberOfDroppedRecords();
+
+    double logNs = 0;
+    double printfNs = 0;
+    FILE *devNull = fopen("/dev/null", "w");
+    ASSERT_NE(devNull, nullptr);
+    for (int repetition = 0; repetition < BENCHMARK_REPETITIONS; repetition++)
+    {
+        // Records are drained every few ms, log in bursts that fit the ring
+        std::chrono::steady_clock::duration logElapsed = std::chrono::steady_clock::duration::zero();
+        for (int i = 0; i < BENCHMARK_LOG_RECORDS; i += AUTHENTICATION_LOG_RING_SIZE)
+        {
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            for (int j = 0; j < AUTHENTICATION_LOG_RING_SIZE; j++)
+            {
+                log.log(AuthenticationLogLevel::AUTHENTICATION_LOG_INFO,
+                        "Status file of {}: status {}", baseFileName, j);
+            }
+            logElapsed += std::chrono::steady_clock::now() - start;
+            log.flush();
+        }
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (int i = 0; i < BENCHMARK_LOG_RECORDS; i++)
+        {
+            fprintf(devNull, "Status file of %s: status %d\n", baseFileName.c_str(), i);
+        }
+        std::chrono::steady_clock::duration printfElapsed = std::chrono::steady_clock::now() - start;
+
+        double elapsed = std::chrono::duration<double, std::nano>(logElapsed).count() /
+                         BENCHMARK_LOG_RECORDS;
+        logNs = (repetition == 0) ? elapsed : std::min(logNs, elapsed);
+        elapsed = std::chrono::duration<double, std::nano>(printfElapsed).count() /
+                  BENCHMARK_LOG_RECORDS;
+        printfNs = (repetition == 0) ? elapsed : std::min(printfNs, elapsed);
+    }
+    fclose(devNull);
+    log.setSink(nullptr, nullptr);
+
+    printf("Log record: %8.1f ns/record, fprintf %8.1f ns/line\n", logNs, printfNs);
+    EXPECT_EQ(log.getNumberOfDroppedRecords(), dropped);
+}
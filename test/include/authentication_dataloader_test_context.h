@@ -0,0 +1,700 @@
+#ifndef AUTHENTICATION_DATALOADER_TEST_CONTEXT_H
+#define AUTHENTICATION_DATALOADER_TEST_CONTEXT_H
+
+// DataLoader fixture and the target hardwares it is run against, shared by
+// the DataLoader unit tests and benchmarks
+
+#include <gtest/gtest.h>
+
+#include "AuthenticationDataLoader.h"
+#include "InitializationAuthenticationFile.h"
+#include "LoadAuthenticationRequestFile.h"
+#include "LoadAuthenticationStatusFile.h"
+#include "TFTPServer.h"
+#include "TFTPClient.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <functional>
+#include <list>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#define LOCALHOST "127.0.0.1"
+
+#define DELTA_TIME 2 // seconds
+
+#define TARGET_HARDWARE_ID "HNPFMS"
+#define TARGET_HARDWARE_POSITION "L"
+#define TARGET_HARDWARE_IP LOCALHOST
+
+#define TFTP_TARGETHARDWARE_SERVER_PORT 28132
+#define TFTP_DATALOADER_SERVER_PORT 45426
+
+class AuthenticationDataLoaderTest : public ::testing::Test
+{
+protected:
+    AuthenticationDataLoaderTest()
+    {
+        authenticationDataLoader =
+            new AuthenticationDataLoader(TARGET_HARDWARE_ID,
+                                          TARGET_HARDWARE_POSITION,
+                                          TARGET_HARDWARE_IP);
+        tftpTargetHardwareServer = new TFTPServer();
+        tftpTargetHardwareStatusClient = new TFTPClient();
+    }
+
+    ~AuthenticationDataLoaderTest() override
+    {
+        delete authenticationDataLoader;
+        delete tftpTargetHardwareServer;
+        delete tftpTargetHardwareStatusClient;
+    }
+    void SetUp() override
+    {
+
+        loadList.push_back(std::make_tuple("certificate/pescert.crt", "00000000"));
+
+        ASSERT_EQ(authenticationDataLoader->setLoadList(loadList),
+                  AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+
+        ASSERT_EQ(authenticationDataLoader->setTftpTargetHardwareServerPort(
+                      TFTP_TARGETHARDWARE_SERVER_PORT),
+                  AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+
+        ASSERT_EQ(authenticationDataLoader->setTftpDataLoaderServerPort(
+                      TFTP_DATALOADER_SERVER_PORT),
+                  AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+
+        ASSERT_EQ(tftpTargetHardwareServer->setPort(
+                      TFTP_TARGETHARDWARE_SERVER_PORT),
+                  TftpServerOperationResult::TFTP_SERVER_OK);
+
+        ASSERT_EQ(tftpTargetHardwareServer->setTimeout(
+                      TFTP_TARGETHARDWARE_SERVER_PORT),
+                  TftpServerOperationResult::TFTP_SERVER_OK);
+
+        ASSERT_EQ(tftpTargetHardwareStatusClient->setConnection(LOCALHOST,
+                                                                TFTP_DATALOADER_SERVER_PORT),
+                  TftpClientOperationResult::TFTP_CLIENT_OK);
+
+        baseFileName = std::string(TARGET_HARDWARE_ID) +
+                       std::string("_") +
+                       std::string(TARGET_HARDWARE_POSITION);
+    }
+
+    void TearDown() override
+    {
+    }
+
+    // Authenticates fleets of 1 to 40 targets against a single fleet server.
+    // Each fleet is added as targets TH0 to THn-1, then handed to
+    // authenticateFleet(n).
+    void authenticateFleets(const std::function<void(size_t)> &authenticateFleet);
+
+    static std::string fleetTargetHardwareId(size_t i)
+    {
+        return std::string("TH") + std::to_string(i);
+    }
+
+    AuthenticationDataLoader *authenticationDataLoader;
+    TFTPServer *tftpTargetHardwareServer;
+    TFTPClient *tftpTargetHardwareStatusClient;
+    std::string baseFileName;
+    std::vector<AuthenticationLoad> loadList;
+};
+
+// A single target hardware server answering for every target of the fleet.
+// A target told to abort in answer to a status file reports the abort.
+class FleetServerContext
+{
+public:
+    FleetServerContext()
+    {
+        stopSending = false;
+        pauseSending = false;
+        statusSentAt = std::chrono::steady_clock::time_point();
+        initializationRequestAt = std::chrono::steady_clock::time_point();
+        initializationRequests = 0;
+        exceptionTimer = 0;
+    }
+
+    // Buffers handed to the TFTP server, kept until the end of the test
+    std::mutex buffersMutex;
+    std::list<std::vector<uint8_t>> buffers;
+
+    // Status files to send to the DataLoader, as (base file name, status)
+    std::mutex statusMutex;
+    std::condition_variable statusCV;
+    std::list<std::pair<std::string, uint16_t>> pendingStatus;
+    bool stopSending;
+    bool pauseSending;
+    // Counter of the last status file sent by each target, by base file name
+    std::map<std::string, uint16_t> statusCounters;
+    // When the last status file started to be sent
+    std::atomic<std::chrono::steady_clock::time_point> statusSentAt;
+    // When the last initialization file was requested, and how many were
+    std::atomic<std::chrono::steady_clock::time_point> initializationRequestAt;
+    std::atomic<size_t> initializationRequests;
+    // Base file name of the status file being sent
+    std::string sendingBaseFileName;
+    // Exception Timer of every status file sent
+    std::atomic<uint16_t> exceptionTimer;
+
+    void queueStatus(std::string baseFileName, uint16_t status)
+    {
+        {
+            std::lock_guard<std::mutex> lock(statusMutex);
+            pendingStatus.push_back(std::make_pair(baseFileName, status));
+        }
+        statusCV.notify_one();
+    }
+
+    void setPauseSending(bool pauseSending)
+    {
+        {
+            std::lock_guard<std::mutex> lock(statusMutex);
+            this->pauseSending = pauseSending;
+        }
+        statusCV.notify_one();
+    }
+
+    void stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(statusMutex);
+            stopSending = true;
+        }
+        statusCV.notify_one();
+    }
+
+    // Send every queued status file to the DataLoader
+    void sendStatus(TFTPClient *statusClient)
+    {
+        statusClient->registerTftpErrorCallback(abortErrorCallback, this);
+        while (true)
+        {
+            std::pair<std::string, uint16_t> status;
+            {
+                std::unique_lock<std::mutex> lock(statusMutex);
+                statusCV.wait(lock, [this]
+                              { return stopSending || (!pauseSending && !pendingStatus.empty()); });
+                if (stopSending)
+                {
+                    break;
+                }
+                status = pendingStatus.front();
+                pendingStatus.pop_front();
+            }
+
+            std::string statusFileName = status.first + LOAD_AUTHENTICATION_STATUS_FILE_EXTENSION;
+            LoadAuthenticationStatusFile loadAuthenticationStatusFile(statusFileName,
+                                                                      AUTHENTICATION_VERSION);
+            loadAuthenticationStatusFile.setAuthenticationOperationStatusCode(status.second);
+            loadAuthenticationStatusFile.setCounter(++statusCounters[status.first]);
+            loadAuthenticationStatusFile.setExceptionTimer(exceptionTimer);
+            std::shared_ptr<std::vector<uint8_t>> fileBuffer =
+                std::make_shared<std::vector<uint8_t>>();
+            loadAuthenticationStatusFile.serialize(fileBuffer);
+
+            FILE *fp = fmemopen(fileBuffer->data(), fileBuffer->size(), "r");
+            if (fp != NULL)
+            {
+                sendingBaseFileName = status.first;
+                statusSentAt = std::chrono::steady_clock::now();
+                statusClient->sendFile(statusFileName.c_str(), fp);
+                fclose(fp);
+            }
+        }
+    }
+
+    // The abort codes are the status codes reporting them
+    static TftpClientOperationResult abortErrorCallback(short errorCode,
+                                                        std::string &errorMessage,
+                                                        void *context)
+    {
+        FleetServerContext *fleetServerContext = static_cast<FleetServerContext *>(context);
+        std::string abortPrefix = std::string(AUTHENTICATION_ABORT_MSG_PREFIX) +
+                                  std::string(AUTHENTICATION_ERROR_MSG_DELIMITER);
+        if (errorMessage.compare(0, abortPrefix.length(), abortPrefix) == 0)
+        {
+            uint16_t abortCode = static_cast<uint16_t>(
+                std::stoul(errorMessage.substr(abortPrefix.length()), nullptr, 16));
+            std::lock_guard<std::mutex> lock(fleetServerContext->statusMutex);
+            fleetServerContext->pendingStatus.push_front(
+                std::make_pair(fleetServerContext->sendingBaseFileName, abortCode));
+        }
+        return TftpClientOperationResult::TFTP_CLIENT_OK;
+    }
+};
+
+inline TftpServerOperationResult fleetOpenFileCallback(
+    ITFTPSection *sectionHandler,
+    FILE **fp,
+    char *filename,
+    char *mode,
+    size_t *bufferSize,
+    void *context)
+{
+    if (context == nullptr)
+    {
+        return TftpServerOperationResult::TFTP_SERVER_ERROR;
+    }
+    FleetServerContext *fleetServerContext = static_cast<FleetServerContext *>(context);
+
+    std::string baseFileName(filename);
+    baseFileName = baseFileName.substr(0, baseFileName.find_last_of("."));
+
+    std::vector<uint8_t> *buffer;
+    {
+        std::lock_guard<std::mutex> lock(fleetServerContext->buffersMutex);
+        fleetServerContext->buffers.push_back(std::vector<uint8_t>());
+        buffer = &fleetServerContext->buffers.back();
+    }
+
+    if (strcmp(mode, "r") == 0)
+    {
+        fleetServerContext->initializationRequestAt = std::chrono::steady_clock::now();
+        fleetServerContext->initializationRequests++;
+
+        // Accept every initialization, and tell it right away
+        InitializationAuthenticationFile authenticationFileLAI(filename, AUTHENTICATION_VERSION);
+        authenticationFileLAI.setOperationAcceptanceStatusCode(OPERATION_IS_ACCEPTED);
+        std::shared_ptr<std::vector<uint8_t>> data = std::make_shared<std::vector<uint8_t>>();
+        authenticationFileLAI.serialize(data);
+        *buffer = *data;
+        fleetServerContext->queueStatus(baseFileName, STATUS_AUTHENTICATION_ACCEPTED);
+    }
+    else
+    {
+        // Complete every authentication as soon as its load list arrives
+        buffer->resize(MAX_CERTIFICATE_BUFFER_SIZE);
+        fleetServerContext->queueStatus(baseFileName, STATUS_AUTHENTICATION_COMPLETED);
+    }
+
+    (*fp) = fmemopen(buffer->data(), buffer->size(), mode);
+    if (bufferSize != NULL)
+    {
+        *bufferSize = buffer->size();
+    }
+    return ((*fp) == NULL) ? TftpServerOperationResult::TFTP_SERVER_ERROR
+                           : TftpServerOperationResult::TFTP_SERVER_OK;
+}
+
+inline void AuthenticationDataLoaderTest::authenticateFleets(
+    const std::function<void(size_t)> &authenticateFleet)
+{
+    FleetServerContext fleetServerContext;
+
+    tftpTargetHardwareServer->registerOpenFileCallback(
+        fleetOpenFileCallback, &fleetServerContext);
+
+    std::thread serverThread = std::thread([this]
+                                           { tftpTargetHardwareServer->startListening(); });
+
+    // Every target sends its status files through the same client
+    std::thread targetHardwareStatusThread = std::thread([&]
+                                                         { fleetServerContext.sendStatus(tftpTargetHardwareStatusClient); });
+
+    const size_t numberOfTargets[] = {1, 4, 16, 40};
+    for (size_t n : numberOfTargets)
+    {
+        EXPECT_EQ(authenticationDataLoader->clearTargets(),
+                  AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+        for (size_t i = 0; i < n; i++)
+        {
+            EXPECT_EQ(authenticationDataLoader->addTarget(
+                          fleetTargetHardwareId(i), TARGET_HARDWARE_POSITION,
+                          TARGET_HARDWARE_IP, loadList),
+                      AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+        }
+
+        authenticateFleet(n);
+    }
+
+    fleetServerContext.stop();
+    targetHardwareStatusThread.join();
+
+    tftpTargetHardwareServer->stopListening();
+    serverThread.join();
+}
+
+// Target hardware that fetches every load of its load list from the
+// DataLoader, and reports the progress of each load in its status files
+class LoadFetchingServerContext
+{
+public:
+    LoadFetchingServerContext()
+    {
+        stopTarget = false;
+        receivingLoadList = false;
+    }
+
+    std::mutex eventsMutex;
+    std::condition_variable eventsCV;
+    // Base file name, and the load list received, empty for an initialization
+    std::list<std::pair<std::string, std::vector<uint8_t>>> events;
+    bool stopTarget;
+
+    // Files served to the DataLoader, kept until the end of the test
+    std::list<std::vector<uint8_t>> buffers;
+    std::string loadListBaseFileName;
+    std::vector<uint8_t> *loadListBuffer;
+    bool receivingLoadList;
+
+    // Bytes of each load fetched, by file name
+    std::mutex fetchedMutex;
+    std::unordered_map<std::string, size_t> fetchedSize;
+    // Counter of the last status file sent by each target, by base file name
+    std::map<std::string, uint16_t> statusCounters;
+
+    void queueEvent(std::string baseFileName, std::vector<uint8_t> loadList)
+    {
+        {
+            std::lock_guard<std::mutex> lock(eventsMutex);
+            events.push_back(std::make_pair(baseFileName, loadList));
+        }
+        eventsCV.notify_one();
+    }
+
+    void stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(eventsMutex);
+            stopTarget = true;
+        }
+        eventsCV.notify_one();
+    }
+
+    void sendStatus(TFTPClient *statusClient, std::string baseFileName,
+                    uint16_t status, LoadAuthenticationRequestFile *loadList,
+                    size_t fetchedLoads)
+    {
+        std::string statusFileName = baseFileName + LOAD_AUTHENTICATION_STATUS_FILE_EXTENSION;
+        LoadAuthenticationStatusFile loadAuthenticationStatusFile(statusFileName,
+                                                                  AUTHENTICATION_VERSION);
+        loadAuthenticationStatusFile.setAuthenticationOperationStatusCode(status);
+        loadAuthenticationStatusFile.setCounter(++statusCounters[baseFileName]);
+        if (loadList != nullptr)
+        {
+            std::shared_ptr<std::vector<LoadAuthenticationRequestHeaderFile>> headerFiles;
+            loadList->getHeaderFiles(headerFiles);
+            for (size_t i = 0; i < headerFiles->size(); i++)
+            {
+                std::string headerFileName;
+                std::string loadPartNumberName;
+                (*headerFiles)[i].getHeaderFileName(headerFileName);
+                (*headerFiles)[i].getLoadPartNumberName(loadPartNumberName);
+
+                LoadAuthenticationStatusHeaderFile headerFile;
+                headerFile.setHeaderFileName(headerFileName);
+                headerFile.setLoadPartNumberName(loadPartNumberName);
+                headerFile.setLoadRatio((i < fetchedLoads) ? 100 : 0);
+                headerFile.setLoadStatus((i < fetchedLoads) ? STATUS_AUTHENTICATION_COMPLETED
+                                                            : STATUS_AUTHENTICATION_IN_PROGRESS);
+                loadAuthenticationStatusFile.addHeaderFile(headerFile);
+            }
+            loadAuthenticationStatusFile.setLoadListRatio(
+                (100 * fetchedLoads) / headerFiles->size());
+        }
+
+        std::shared_ptr<std::vector<uint8_t>> fileBuffer =
+            std::make_shared<std::vector<uint8_t>>();
+        loadAuthenticationStatusFile.serialize(fileBuffer);
+        FILE *fp = fmemopen(fileBuffer->data(), fileBuffer->size(), "r");
+        if (fp != NULL)
+        {
+            statusClient->sendFile(statusFileName.c_str(), fp);
+            fclose(fp);
+        }
+    }
+
+    // Accept each initialization, then fetch each load of the load list,
+    // reporting after each one
+    void run(TFTPClient *statusClient)
+    {
+        TFTPClient fetchClient;
+        fetchClient.setConnection(LOCALHOST, TFTP_DATALOADER_SERVER_PORT);
+        while (true)
+        {
+            std::pair<std::string, std::vector<uint8_t>> event;
+            {
+                std::unique_lock<std::mutex> lock(eventsMutex);
+                eventsCV.wait(lock, [this]
+                              { return stopTarget || !events.empty(); });
+                if (stopTarget)
+                {
+                    break;
+                }
+                event = events.front();
+                events.pop_front();
+            }
+
+            if (event.second.empty())
+            {
+                sendStatus(statusClient, event.first, STATUS_AUTHENTICATION_ACCEPTED,
+                           nullptr, 0);
+                continue;
+            }
+
+            LoadAuthenticationRequestFile loadList;
+            std::shared_ptr<std::vector<uint8_t>> loadListBuffer =
+                std::make_shared<std::vector<uint8_t>>(event.second);
+            loadList.deserialize(loadListBuffer);
+            std::shared_ptr<std::vector<LoadAuthenticationRequestHeaderFile>> headerFiles;
+            loadList.getHeaderFiles(headerFiles);
+            for (size_t i = 0; i < headerFiles->size(); i++)
+            {
+                std::string headerFileName;
+                (*headerFiles)[i].getHeaderFileName(headerFileName);
+
+                char *data = NULL;
+                size_t size = 0;
+                FILE *fp = open_memstream(&data, &size);
+                ASSERT_NE(fp, nullptr);
+                ASSERT_EQ(fetchClient.fetchFile(headerFileName.c_str(), fp),
+                          TftpClientOperationResult::TFTP_CLIENT_OK);
+                fclose(fp);
+                free(data);
+                {
+                    std::lock_guard<std::mutex> lock(fetchedMutex);
+                    fetchedSize[headerFileName] = size;
+                }
+
+                uint16_t status = (i + 1 < headerFiles->size()) ? STATUS_AUTHENTICATION_IN_PROGRESS
+                                                                : STATUS_AUTHENTICATION_COMPLETED;
+                sendStatus(statusClient, event.first, status, &loadList, i + 1);
+            }
+        }
+    }
+};
+
+inline TftpServerOperationResult loadFetchingOpenFileCallback(
+    ITFTPSection *sectionHandler,
+    FILE **fp,
+    char *filename,
+    char *mode,
+    size_t *bufferSize,
+    void *context)
+{
+    if (context == nullptr)
+    {
+        return TftpServerOperationResult::TFTP_SERVER_ERROR;
+    }
+    LoadFetchingServerContext *serverContext = static_cast<LoadFetchingServerContext *>(context);
+
+    std::string baseFileName(filename);
+    baseFileName = baseFileName.substr(0, baseFileName.find_last_of("."));
+
+    serverContext->buffers.push_back(std::vector<uint8_t>());
+    std::vector<uint8_t> *buffer = &serverContext->buffers.back();
+    if (strcmp(mode, "r") == 0)
+    {
+        InitializationAuthenticationFile authenticationFileLAI(filename, AUTHENTICATION_VERSION);
+        authenticationFileLAI.setOperationAcceptanceStatusCode(OPERATION_IS_ACCEPTED);
+        std::shared_ptr<std::vector<uint8_t>> data = std::make_shared<std::vector<uint8_t>>();
+        authenticationFileLAI.serialize(data);
+        *buffer = *data;
+        serverContext->queueEvent(baseFileName, std::vector<uint8_t>());
+    }
+    else
+    {
+        buffer->resize(MAX_CERTIFICATE_BUFFER_SIZE);
+        serverContext->loadListBaseFileName = baseFileName;
+        serverContext->loadListBuffer = buffer;
+        serverContext->receivingLoadList = true;
+    }
+
+    (*fp) = fmemopen(buffer->data(), buffer->size(), mode);
+    if (bufferSize != NULL)
+    {
+        *bufferSize = buffer->size();
+    }
+    return ((*fp) == NULL) ? TftpServerOperationResult::TFTP_SERVER_ERROR
+                           : TftpServerOperationResult::TFTP_SERVER_OK;
+}
+
+inline TftpServerOperationResult loadFetchingSectionFinished(
+    ITFTPSection *sectionHandler, void *context)
+{
+    if (context != nullptr)
+    {
+        LoadFetchingServerContext *serverContext =
+            static_cast<LoadFetchingServerContext *>(context);
+        if (serverContext->receivingLoadList)
+        {
+            serverContext->receivingLoadList = false;
+            serverContext->queueEvent(serverContext->loadListBaseFileName,
+                                      *serverContext->loadListBuffer);
+        }
+    }
+    return TftpServerOperationResult::TFTP_SERVER_OK;
+}
+
+#define MULTIPLE_LOADS_FILE "multiple_load_%zu.crt"
+#define MULTIPLE_LOADS_FILE_SIZE (4 * 1024)
+
+// Target hardware answering its first initialization requests with an error,
+// then asking to wait, before serving them as the fleet does. With
+// silentLoadList, the load list is received but never answered.
+class BusyServerContext
+{
+public:
+    BusyServerContext(FleetServerContext *fleetServerContext)
+    {
+        this->fleetServerContext = fleetServerContext;
+        failuresToAnswer = 0;
+        waitsToAnswer = 0;
+        silentLoadList = false;
+    }
+
+    FleetServerContext *fleetServerContext;
+    std::atomic<int> failuresToAnswer;
+    std::atomic<int> waitsToAnswer;
+    bool silentLoadList;
+    std::vector<uint8_t> loadListBuffer;
+};
+
+inline TftpServerOperationResult busyOpenFileCallback(
+    ITFTPSection *sectionHandler,
+    FILE **fp,
+    char *filename,
+    char *mode,
+    size_t *bufferSize,
+    void *context)
+{
+    BusyServerContext *busyServerContext = static_cast<BusyServerContext *>(context);
+    if (strcmp(mode, "r") == 0)
+    {
+        if (busyServerContext->failuresToAnswer > 0)
+        {
+            busyServerContext->failuresToAnswer--;
+            return TftpServerOperationResult::TFTP_SERVER_ERROR;
+        }
+        if (busyServerContext->waitsToAnswer > 0)
+        {
+            busyServerContext->waitsToAnswer--;
+            std::string waitMessage = std::string(AUTHENTICATION_WAIT_MSG_PREFIX) +
+                                      std::string(AUTHENTICATION_ERROR_MSG_DELIMITER) +
+                                      std::to_string(DEFAULT_WAIT_TIME);
+            sectionHandler->setErrorMessage(waitMessage);
+            return TftpServerOperationResult::TFTP_SERVER_ERROR;
+        }
+    }
+    else if (busyServerContext->silentLoadList)
+    {
+        busyServerContext->loadListBuffer.resize(MAX_CERTIFICATE_BUFFER_SIZE);
+        (*fp) = fmemopen(busyServerContext->loadListBuffer.data(),
+                         busyServerContext->loadListBuffer.size(), mode);
+        return TftpServerOperationResult::TFTP_SERVER_OK;
+    }
+    return fleetOpenFileCallback(sectionHandler, fp, filename, mode, bufferSize,
+                                 busyServerContext->fleetServerContext);
+}
+
+// Target hardware sending its status files back to back once the load list
+// is received, and reporting an abort as soon as it is told to
+class AbortServerContext
+{
+public:
+    AbortServerContext(FleetServerContext *fleetServerContext)
+    {
+        this->fleetServerContext = fleetServerContext;
+        loadListReceived = false;
+        abortCode = 0;
+        stopSending = false;
+        statusCounter = 0;
+    }
+
+    FleetServerContext *fleetServerContext;
+    std::vector<uint8_t> loadListBuffer;
+    std::atomic<bool> loadListReceived;
+    std::atomic<uint16_t> abortCode;
+    std::atomic<bool> stopSending;
+    uint16_t statusCounter;
+
+    void sendStatus()
+    {
+        TFTPClient statusClient;
+        statusClient.setConnection(LOCALHOST, TFTP_DATALOADER_SERVER_PORT);
+        statusClient.registerTftpErrorCallback(abortErrorCallback, this);
+
+        std::string statusFileName = std::string(TARGET_HARDWARE_ID) + "_" +
+                                     TARGET_HARDWARE_POSITION +
+                                     LOAD_AUTHENTICATION_STATUS_FILE_EXTENSION;
+        while (!stopSending)
+        {
+            if (!loadListReceived)
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+                continue;
+            }
+
+            uint16_t aborted = abortCode;
+            LoadAuthenticationStatusFile loadAuthenticationStatusFile(statusFileName,
+                                                                      AUTHENTICATION_VERSION);
+            loadAuthenticationStatusFile.setAuthenticationOperationStatusCode(
+                (aborted != 0) ? aborted : STATUS_AUTHENTICATION_IN_PROGRESS);
+            loadAuthenticationStatusFile.setCounter(++statusCounter);
+            std::shared_ptr<std::vector<uint8_t>> fileBuffer =
+                std::make_shared<std::vector<uint8_t>>();
+            loadAuthenticationStatusFile.serialize(fileBuffer);
+
+            FILE *fp = fmemopen(fileBuffer->data(), fileBuffer->size(), "r");
+            TftpClientOperationResult result = statusClient.sendFile(statusFileName.c_str(), fp);
+            fclose(fp);
+            if ((aborted != 0) && (result == TftpClientOperationResult::TFTP_CLIENT_OK))
+            {
+                // The abort is reported, wait for the next authentication
+                loadListReceived = false;
+                abortCode = 0;
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+
+    static TftpClientOperationResult abortErrorCallback(short errorCode,
+                                                        std::string &errorMessage,
+                                                        void *context)
+    {
+        AbortServerContext *abortServerContext = static_cast<AbortServerContext *>(context);
+        std::string abortPrefix = std::string(AUTHENTICATION_ABORT_MSG_PREFIX) +
+                                  std::string(AUTHENTICATION_ERROR_MSG_DELIMITER);
+        if (errorMessage.compare(0, abortPrefix.length(), abortPrefix) == 0)
+        {
+            abortServerContext->abortCode = static_cast<uint16_t>(
+                std::stoul(errorMessage.substr(abortPrefix.length()), nullptr, 16));
+        }
+        return TftpClientOperationResult::TFTP_CLIENT_OK;
+    }
+};
+
+inline TftpServerOperationResult abortOpenFileCallback(
+    ITFTPSection *sectionHandler,
+    FILE **fp,
+    char *filename,
+    char *mode,
+    size_t *bufferSize,
+    void *context)
+{
+    AbortServerContext *abortServerContext = static_cast<AbortServerContext *>(context);
+    if (strcmp(mode, "w") == 0)
+    {
+        // Never completes, the status thread takes over
+        abortServerContext->loadListBuffer.resize(MAX_CERTIFICATE_BUFFER_SIZE);
+        (*fp) = fmemopen(abortServerContext->loadListBuffer.data(),
+                         abortServerContext->loadListBuffer.size(), mode);
+        abortServerContext->loadListReceived = true;
+        return TftpServerOperationResult::TFTP_SERVER_OK;
+    }
+    return fleetOpenFileCallback(sectionHandler, fp, filename, mode, bufferSize,
+                                 abortServerContext->fleetServerContext);
+}
+
+#endif // AUTHENTICATION_DATALOADER_TEST_CONTEXT_H
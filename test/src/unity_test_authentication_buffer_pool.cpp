@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <thread>
+
+#include "AuthenticationBufferPool.h"
+
+#define POOL_TEST_BUFFER_SIZE 64
+#define POOL_TEST_CAPACITY 6
+#define POOL_TEST_BUFFERS_PER_SLAB 4
+#define POOL_TEST_THREADS 4
+#define POOL_TEST_ROUNDS 10000
+
+TEST(AuthenticationPoolTest, BufferPoolRecycle)
+{
+    AuthenticationBufferPool pool(POOL_TEST_BUFFER_SIZE, POOL_TEST_CAPACITY,
+                                  POOL_TEST_BUFFERS_PER_SLAB);
+    ASSERT_EQ(pool.getBufferSize(), POOL_TEST_BUFFER_SIZE);
+    ASSERT_EQ(pool.getCapacity(), POOL_TEST_CAPACITY);
+    ASSERT_EQ(pool.getNumberOfBuffersInUse(), 0);
+
+    // A released buffer is the next one handed out
+    char *buffer = pool.acquire();
+    ASSERT_NE(buffer, nullptr);
+    std::memset(buffer, 0xAA, POOL_TEST_BUFFER_SIZE);
+    pool.release(buffer);
+    ASSERT_EQ(pool.acquire(), buffer);
+    pool.release(buffer);
+    pool.release(NULL);
+
+    ASSERT_EQ(pool.getNumberOfBuffersInUse(), 0);
+    ASSERT_EQ(pool.getHighWaterMark(), 1);
+    ASSERT_EQ(pool.getNumberOfOverflows(), 0);
+}
+
+TEST(AuthenticationPoolTest, BufferPoolExhausted)
+{
+    AuthenticationBufferPool pool(POOL_TEST_BUFFER_SIZE, POOL_TEST_CAPACITY,
+                                  POOL_TEST_BUFFERS_PER_SLAB);
+
+    // Two slabs, the second one cut down to the capacity, then the heap
+    std::vector<char *> buffers;
+    for (int i = 0; i < POOL_TEST_CAPACITY + 2; i++)
+    {
+        buffers.push_back(pool.acquire());
+        ASSERT_NE(buffers.back(), nullptr);
+        std::memset(buffers.back(), i, POOL_TEST_BUFFER_SIZE);
+    }
+    ASSERT_EQ(pool.getNumberOfBuffersInUse(), POOL_TEST_CAPACITY);
+    ASSERT_EQ(pool.getHighWaterMark(), POOL_TEST_CAPACITY);
+    ASSERT_EQ(pool.getNumberOfOverflows(), 2);
+
+    for (size_t i = 0; i < buffers.size(); i++)
+    {
+        ASSERT_EQ(buffers[i][POOL_TEST_BUFFER_SIZE - 1], (char)i);
+        pool.release(buffers[i]);
+    }
+    ASSERT_EQ(pool.getNumberOfBuffersInUse(), 0);
+    ASSERT_EQ(pool.getHighWaterMark(), POOL_TEST_CAPACITY);
+
+    // Heap buffers are not kept, the pool still holds its capacity
+    for (int i = 0; i < POOL_TEST_CAPACITY; i++)
+    {
+        pool.acquire();
+    }
+    ASSERT_EQ(pool.getNumberOfOverflows(), 2);
+}
+
+TEST(AuthenticationPoolTest, BufferPoolConcurrentUsers)
+{
+    AuthenticationBufferPool pool(POOL_TEST_BUFFER_SIZE, POOL_TEST_THREADS,
+                                  POOL_TEST_BUFFERS_PER_SLAB);
+    std::vector<std::thread> users;
+    for (int user = 0; user < POOL_TEST_THREADS; user++)
+    {
+        users.push_back(std::thread([&pool, user]
+                                    {
+            for (int i = 0; i < POOL_TEST_ROUNDS; i++)
+            {
+                char *buffer = pool.acquire();
+                std::memset(buffer, user, POOL_TEST_BUFFER_SIZE);
+                ASSERT_EQ(buffer[POOL_TEST_BUFFER_SIZE - 1], (char)user);
+                pool.release(buffer);
+            } }));
+    }
+    for (std::vector<std::thread>::iterator it = users.begin(); it != users.end(); ++it)
+    {
+        it->join();
+    }
+
+    // One buffer per user is always enough
+    ASSERT_EQ(pool.getNumberOfBuffersInUse(), 0);
+    ASSERT_LE(pool.getHighWaterMark(), POOL_TEST_THREADS);
+    ASSERT_EQ(pool.getNumberOfOverflows(), 0);
+}
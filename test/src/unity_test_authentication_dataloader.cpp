@@ -1,92 +1,23 @@
 #include <gtest/gtest.h>
 
 #include "AuthenticationDataLoader.h"
+#include "FleetAuthenticator.h"
 #include "InitializationAuthenticationFile.h"
 #include "LoadAuthenticationStatusFile.h"
 #include "TFTPServer.h"
 #include "TFTPClient.h"
 #include "ISerializableAuthentication.h"
+#include <cjson/cJSON.h>
 
 #include <thread>
 #include <list>
+#include <map>
 #include <fstream>
 #include <algorithm>
 #include <iterator>
 #include <string>
 
-#define LOCALHOST "127.0.0.1"
-
-#define DELTA_TIME 2 // seconds
-
-#define TARGET_HARDWARE_ID "HNPFMS"
-#define TARGET_HARDWARE_POSITION "L"
-#define TARGET_HARDWARE_IP LOCALHOST
-
-#define TFTP_TARGETHARDWARE_SERVER_PORT 28132
-#define TFTP_DATALOADER_SERVER_PORT 45426
-
-class AuthenticationDataLoaderTest : public ::testing::Test
-{
-protected:
-    AuthenticationDataLoaderTest()
-    {
-        authenticationDataLoader =
-            new AuthenticationDataLoader(TARGET_HARDWARE_ID,
-                                          TARGET_HARDWARE_POSITION,
-                                          TARGET_HARDWARE_IP);
-        tftpTargetHardwareServer = new TFTPServer();
-        tftpTargetHardwareStatusClient = new TFTPClient();
-    }
-
-    ~AuthenticationDataLoaderTest() override
-    {
-        delete authenticationDataLoader;
-        delete tftpTargetHardwareServer;
-        delete tftpTargetHardwareStatusClient;
-    }
-    void SetUp() override
-    {
-
-        loadList.push_back(std::make_tuple("certificate/pescert.crt", "00000000"));
-
-        ASSERT_EQ(authenticationDataLoader->setLoadList(loadList),
-                  AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
-
-        ASSERT_EQ(authenticationDataLoader->setTftpTargetHardwareServerPort(
-                      TFTP_TARGETHARDWARE_SERVER_PORT),
-                  AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
-
-        ASSERT_EQ(authenticationDataLoader->setTftpDataLoaderServerPort(
-                      TFTP_DATALOADER_SERVER_PORT),
-                  AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
-
-        ASSERT_EQ(tftpTargetHardwareServer->setPort(
-                      TFTP_TARGETHARDWARE_SERVER_PORT),
-                  TftpServerOperationResult::TFTP_SERVER_OK);
-
-        ASSERT_EQ(tftpTargetHardwareServer->setTimeout(
-                      TFTP_TARGETHARDWARE_SERVER_PORT),
-                  TftpServerOperationResult::TFTP_SERVER_OK);
-
-        ASSERT_EQ(tftpTargetHardwareStatusClient->setConnection(LOCALHOST,
-                                                                TFTP_DATALOADER_SERVER_PORT),
-                  TftpClientOperationResult::TFTP_CLIENT_OK);
-
-        baseFileName = std::string(TARGET_HARDWARE_ID) +
-                       std::string("_") +
-                       std::string(TARGET_HARDWARE_POSITION);
-    }
-
-    void TearDown() override
-    {
-    }
-
-    AuthenticationDataLoader *authenticationDataLoader;
-    TFTPServer *tftpTargetHardwareServer;
-    TFTPClient *tftpTargetHardwareStatusClient;
-    std::string baseFileName;
-    std::vector<AuthenticationLoad> loadList;
-};
+#include "authentication_dataloader_test_context.h"
 
 class TargetServerClienContext
 {
@@ -203,17 +134,34 @@ TEST_F(AuthenticationDataLoaderTest, AuthenticationDataLoaderOverloadLoadList)
     std::vector<AuthenticationLoad> loadList;
     loadList.clear();
 
-    //Max number of certificates = 1
+    // Several loads per authentication
     for (int i = 0; i < 10; i++)
     {
         loadList.push_back(std::make_tuple(std::string("certificate/file") + std::to_string(i),
                                            std::to_string(i)));
     }
+    ASSERT_EQ(authenticationDataLoader->setLoadList(loadList),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
 
+    // Up to the number of header files a load authentication request holds
+    for (int i = 10; i <= MAX_AUTHENTICATION_LOADS; i++)
+    {
+        loadList.push_back(std::make_tuple(std::string("certificate/file") + std::to_string(i),
+                                           std::to_string(i)));
+    }
     ASSERT_EQ(authenticationDataLoader->setLoadList(loadList),
               AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR);
 
-    ASSERT_EQ(authenticationDataLoader->authenticate(),
+    // Loads are told apart by file name
+    std::vector<AuthenticationLoad> duplicatedLoadList;
+    duplicatedLoadList.push_back(std::make_tuple("certificate/pescert.crt", "00000000"));
+    duplicatedLoadList.push_back(std::make_tuple("certificate/pescert.crt", "00000001"));
+    ASSERT_EQ(authenticationDataLoader->setLoadList(duplicatedLoadList),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR);
+
+    std::vector<AuthenticationLoad> longLoadList;
+    longLoadList.push_back(std::make_tuple(std::string(MAX_HEADER_FILE_NAME_SIZE, 'A'), "00000000"));
+    ASSERT_EQ(authenticationDataLoader->setLoadList(longLoadList),
               AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR);
 }
 
@@ -365,13 +313,18 @@ TEST_F(AuthenticationDataLoaderTest, AuthenticationDataLoaderLoadAuthenticationR
         loadAuthenticationStatusFile.setAuthenticationOperationStatusCode(
                 STATUS_AUTHENTICATION_ACCEPTED);
 
-        // Serialize message
-        std::shared_ptr<std::vector<uint8_t>> fileBuffer =
-                std::make_shared<std::vector<uint8_t>>();
-        loadAuthenticationStatusFile.serialize(fileBuffer);
-
         // Send heartbeat
         while (sendHeartBeat) {
+            // Each status file sent is counted
+            uint16_t counter;
+            loadAuthenticationStatusFile.getCounter(counter);
+            loadAuthenticationStatusFile.setCounter(++counter);
+
+            // Serialize message
+            std::shared_ptr<std::vector<uint8_t>> fileBuffer =
+                    std::make_shared<std::vector<uint8_t>>();
+            loadAuthenticationStatusFile.serialize(fileBuffer);
+
             FILE *fp = fmemopen(fileBuffer->data(), fileBuffer->size(), "r");
             if (fp != NULL) {
                 tftpTargetHardwareStatusClient->sendFile(
@@ -573,6 +526,11 @@ TEST_F(AuthenticationDataLoaderTest, AuthenticationDataLoaderAuthenticationSucce
             loadAuthenticationStatusFile.setAuthenticationOperationStatusCode(
                     targetServerClienContext.authenticationOperationStatusCode);
 
+            // Each status file sent is counted
+            uint16_t counter;
+            loadAuthenticationStatusFile.getCounter(counter);
+            loadAuthenticationStatusFile.setCounter(++counter);
+
             // Serialize message
             std::shared_ptr<std::vector<uint8_t>> fileBuffer =
                     std::make_shared<std::vector<uint8_t>>();
@@ -730,6 +688,11 @@ TEST_F(AuthenticationDataLoaderTest, AuthenticationDataLoaderTargetHardwareAbort
             uint16_t statusCode;
             loadAuthenticationStatusFile.getAuthenticationOperationStatusCode(statusCode);
 
+            // Each status file sent is counted
+            uint16_t counter;
+            loadAuthenticationStatusFile.getCounter(counter);
+            loadAuthenticationStatusFile.setCounter(++counter);
+
             // Serialize message
             std::shared_ptr<std::vector<uint8_t>> fileBuffer =
                     std::make_shared<std::vector<uint8_t>>();
@@ -934,6 +897,11 @@ TEST_F(AuthenticationDataLoaderTest, AuthenticationDataLoaderDataLoaderAbort)
                 }                
             }
 
+            // Each status file sent is counted
+            uint16_t counter;
+            loadAuthenticationStatusFile.getCounter(counter);
+            loadAuthenticationStatusFile.setCounter(++counter);
+
             // Serialize message
             std::shared_ptr<std::vector<uint8_t>> fileBuffer =
                     std::make_shared<std::vector<uint8_t>>();
@@ -1107,6 +1075,11 @@ TEST_F(AuthenticationDataLoaderTest, AuthenticationDataLoaderOperatorAbort)
                 }                
             }
 
+            // Each status file sent is counted
+            uint16_t counter;
+            loadAuthenticationStatusFile.getCounter(counter);
+            loadAuthenticationStatusFile.setCounter(++counter);
+
             // Serialize message
             std::shared_ptr<std::vector<uint8_t>> fileBuffer =
                     std::make_shared<std::vector<uint8_t>>();
@@ -1220,6 +1193,11 @@ TEST_F(AuthenticationDataLoaderTest, AuthenticationDataLoaderFileNotFound)
             loadAuthenticationStatusFile.setAuthenticationOperationStatusCode(
                     targetServerClienContext.authenticationOperationStatusCode);
 
+            // Each status file sent is counted
+            uint16_t counter;
+            loadAuthenticationStatusFile.getCounter(counter);
+            loadAuthenticationStatusFile.setCounter(++counter);
+
             // Serialize message
             std::shared_ptr<std::vector<uint8_t>> fileBuffer =
                     std::make_shared<std::vector<uint8_t>>();
@@ -1300,4 +1278,1321 @@ TEST_F(AuthenticationDataLoaderTest, AuthenticationDataLoaderFileNotFound)
 
     ASSERT_EQ(targetServerClienContext.waitsReceived,
               inexistentLoadList.size() * DEFAULT_WAIT_TIME);
-}
\ No newline at end of file
+}
+TEST_F(AuthenticationDataLoaderTest, AuthenticationDataLoaderAddTarget)
+{
+    AuthenticationTargetState state;
+
+    ASSERT_EQ(authenticationDataLoader->authenticateTargets(),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR);
+
+    ASSERT_EQ(authenticationDataLoader->addTarget("", TARGET_HARDWARE_POSITION,
+                                                  TARGET_HARDWARE_IP, loadList),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR);
+
+    ASSERT_EQ(authenticationDataLoader->addTarget(TARGET_HARDWARE_ID, TARGET_HARDWARE_POSITION,
+                                                  TARGET_HARDWARE_IP,
+                                                  std::vector<AuthenticationLoad>()),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR);
+
+    ASSERT_EQ(authenticationDataLoader->addTarget(TARGET_HARDWARE_ID, TARGET_HARDWARE_POSITION,
+                                                  TARGET_HARDWARE_IP, loadList),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+
+    ASSERT_EQ(authenticationDataLoader->addTarget(TARGET_HARDWARE_ID, "R",
+                                                  TARGET_HARDWARE_IP, loadList),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+
+    // Same id and position means same files: the target is already there
+    ASSERT_EQ(authenticationDataLoader->addTarget(TARGET_HARDWARE_ID, TARGET_HARDWARE_POSITION,
+                                                  TARGET_HARDWARE_IP, loadList),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR);
+
+    ASSERT_EQ(authenticationDataLoader->getTargetState(TARGET_HARDWARE_ID, "R", state),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(state, AuthenticationTargetState::AUTHENTICATION_TARGET_PENDING);
+
+    ASSERT_EQ(authenticationDataLoader->getTargetState(TARGET_HARDWARE_ID, "C", state),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR);
+
+    ASSERT_EQ(authenticationDataLoader->clearTargets(),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+
+    ASSERT_EQ(authenticationDataLoader->getTargetState(TARGET_HARDWARE_ID, "R", state),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR);
+}
+
+TEST_F(AuthenticationDataLoaderTest, AuthenticationDataLoaderMultiTarget)
+{
+    authenticateFleets([this](size_t n)
+                       {
+        EXPECT_EQ(authenticationDataLoader->authenticateTargets(),
+                  AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+
+        for (size_t i = 0; i < n; i++)
+        {
+            AuthenticationTargetState state;
+            ASSERT_EQ(authenticationDataLoader->getTargetState(
+                          fleetTargetHardwareId(i), TARGET_HARDWARE_POSITION, state),
+                      AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+            EXPECT_EQ(state, AuthenticationTargetState::AUTHENTICATION_TARGET_COMPLETED);
+        } });
+}
+
+AuthenticationOperationResult AuthenticationDataLoaderAsync_CompletedCallback(
+    std::string targetHardwareId, std::string targetHardwarePosition,
+    AuthenticationOperationResult result, void *context)
+{
+    if ((context != nullptr) && (result == AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK))
+    {
+        (*static_cast<std::atomic<int> *>(context))++;
+    }
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
+TEST_F(AuthenticationDataLoaderTest, AuthenticationDataLoaderAsync)
+{
+    FleetServerContext fleetServerContext;
+
+    tftpTargetHardwareServer->registerOpenFileCallback(
+        fleetOpenFileCallback, &fleetServerContext);
+
+    std::thread serverThread = std::thread([this]
+                                           { tftpTargetHardwareServer->startListening(); });
+    std::thread targetHardwareStatusThread = std::thread([&]
+                                                         { fleetServerContext.sendStatus(tftpTargetHardwareStatusClient); });
+
+    // Many authentications in flight, started and waited from this thread only
+    const int numberOfTargets = 32;
+    std::atomic<int> completedAuthentications(0);
+    std::vector<std::shared_ptr<AuthenticationHandle>> handles;
+    for (int i = 0; i < numberOfTargets; i++)
+    {
+        std::shared_ptr<AuthenticationHandle> handle;
+        ASSERT_EQ(authenticationDataLoader->authenticateAsync(
+                      std::string("TH") + std::to_string(i), TARGET_HARDWARE_POSITION,
+                      TARGET_HARDWARE_IP, loadList,
+                      AuthenticationDataLoaderAsync_CompletedCallback,
+                      &completedAuthentications, handle),
+                  AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+        handles.push_back(handle);
+    }
+
+    for (std::vector<std::shared_ptr<AuthenticationHandle>>::iterator it = handles.begin();
+         it != handles.end(); ++it)
+    {
+        ASSERT_EQ((*it)->getFuture().get(),
+                  AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+        AuthenticationTargetState state;
+        (*it)->getState(state);
+        ASSERT_EQ(state, AuthenticationTargetState::AUTHENTICATION_TARGET_COMPLETED);
+
+        // Nothing left to cancel
+        ASSERT_EQ((*it)->cancel(),
+                  AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR);
+    }
+    ASSERT_EQ(completedAuthentications, numberOfTargets);
+
+    fleetServerContext.stop();
+    targetHardwareStatusThread.join();
+
+    tftpTargetHardwareServer->stopListening();
+    serverThread.join();
+}
+
+TEST_F(AuthenticationDataLoaderTest, AuthenticationDataLoaderAsyncCancel)
+{
+    FleetServerContext fleetServerContext;
+
+    tftpTargetHardwareServer->registerOpenFileCallback(
+        fleetOpenFileCallback, &fleetServerContext);
+
+    std::thread serverThread = std::thread([this]
+                                           { tftpTargetHardwareServer->startListening(); });
+
+    // Keep the target hardware quiet, so the authentication stays in flight
+    fleetServerContext.setPauseSending(true);
+    std::thread targetHardwareStatusThread = std::thread([&]
+                                                         { fleetServerContext.sendStatus(tftpTargetHardwareStatusClient); });
+
+    std::atomic<int> completedAuthentications(0);
+    std::shared_ptr<AuthenticationHandle> handle;
+    ASSERT_EQ(authenticationDataLoader->authenticateAsync(
+                  TARGET_HARDWARE_ID, TARGET_HARDWARE_POSITION, TARGET_HARDWARE_IP, loadList,
+                  AuthenticationDataLoaderAsync_CompletedCallback,
+                  &completedAuthentications, handle),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+
+    // The same target can not be authenticated twice at the same time
+    std::shared_ptr<AuthenticationHandle> duplicatedHandle;
+    ASSERT_EQ(authenticationDataLoader->authenticateAsync(
+                  TARGET_HARDWARE_ID, TARGET_HARDWARE_POSITION, TARGET_HARDWARE_IP, loadList,
+                  nullptr, nullptr, duplicatedHandle),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR);
+
+    ASSERT_EQ(handle->cancel(AUTHENTICATION_ABORT_SOURCE_OPERATOR),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+
+    // The load list is never sent once the authentication is cancelled, and
+    // the target hardware reports the abort if it accepted already
+    fleetServerContext.setPauseSending(false);
+    ASSERT_EQ(handle->getFuture().get(),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR);
+
+    AuthenticationTargetState state;
+    handle->getState(state);
+    ASSERT_EQ(state, AuthenticationTargetState::AUTHENTICATION_TARGET_FAILED);
+    ASSERT_EQ(completedAuthentications, 0);
+    {
+        std::lock_guard<std::mutex> lock(fleetServerContext.statusMutex);
+        ASSERT_EQ(std::count_if(fleetServerContext.pendingStatus.begin(),
+                                fleetServerContext.pendingStatus.end(),
+                                [](const std::pair<std::string, uint16_t> &status)
+                                { return status.second == STATUS_AUTHENTICATION_COMPLETED; }),
+                  0);
+    }
+
+    fleetServerContext.stop();
+    targetHardwareStatusThread.join();
+
+    tftpTargetHardwareServer->stopListening();
+    serverThread.join();
+}
+
+TEST_F(AuthenticationDataLoaderTest, AuthenticationDataLoaderAsyncCancelAfterDestroy)
+{
+    FleetServerContext fleetServerContext;
+
+    tftpTargetHardwareServer->registerOpenFileCallback(
+        fleetOpenFileCallback, &fleetServerContext);
+
+    std::thread serverThread = std::thread([this]
+                                           { tftpTargetHardwareServer->startListening(); });
+
+    // Keep the target hardware quiet, so the authentication stays in flight
+    fleetServerContext.setPauseSending(true);
+    std::thread targetHardwareStatusThread = std::thread([&]
+                                                         { fleetServerContext.sendStatus(tftpTargetHardwareStatusClient); });
+
+    std::shared_ptr<AuthenticationHandle> handle;
+    ASSERT_EQ(authenticationDataLoader->authenticateAsync(
+                  TARGET_HARDWARE_ID, TARGET_HARDWARE_POSITION, TARGET_HARDWARE_IP, loadList,
+                  nullptr, nullptr, handle),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+
+    // The handle outlives the DataLoader, which ends its authentication
+    delete authenticationDataLoader;
+    authenticationDataLoader = nullptr;
+    ASSERT_EQ(handle->getFuture().get(),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR);
+    AuthenticationTargetState state;
+    handle->getState(state);
+    ASSERT_EQ(state, AuthenticationTargetState::AUTHENTICATION_TARGET_FAILED);
+    ASSERT_EQ(handle->cancel(AUTHENTICATION_ABORT_SOURCE_OPERATOR),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR);
+
+    fleetServerContext.setPauseSending(false);
+    fleetServerContext.stop();
+    targetHardwareStatusThread.join();
+
+    tftpTargetHardwareServer->stopListening();
+    serverThread.join();
+}
+
+AuthenticationOperationResult AuthenticationDataLoaderStatusCallback_StatusCallback(
+    std::string authenticationInformationStatusJson, void *context)
+{
+    (*static_cast<std::atomic<int> *>(context))++;
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
+TEST_F(AuthenticationDataLoaderTest, AuthenticationDataLoaderStatusCallback)
+{
+    FleetServerContext fleetServerContext;
+    std::atomic<int> reportedStatusFiles(0);
+
+    tftpTargetHardwareServer->registerOpenFileCallback(
+        fleetOpenFileCallback, &fleetServerContext);
+    authenticationDataLoader->registerAuthenticationInformationStatusCallback(
+        AuthenticationDataLoaderStatusCallback_StatusCallback, &reportedStatusFiles);
+
+    std::thread serverThread = std::thread([this]
+                                           { tftpTargetHardwareServer->startListening(); });
+    std::thread targetHardwareStatusThread = std::thread([&]
+                                                         { fleetServerContext.sendStatus(tftpTargetHardwareStatusClient); });
+
+    // Every status file is reported once, the accepted and the completed one
+    const int numberOfAuthentications = 20;
+    for (int i = 0; i < numberOfAuthentications; i++)
+    {
+        std::shared_ptr<AuthenticationHandle> handle;
+        ASSERT_EQ(authenticationDataLoader->authenticateAsync(
+                      TARGET_HARDWARE_ID, TARGET_HARDWARE_POSITION, TARGET_HARDWARE_IP,
+                      loadList, nullptr, nullptr, handle),
+                  AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+        ASSERT_EQ(handle->getFuture().get(),
+                  AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    }
+    ASSERT_EQ(reportedStatusFiles, 2 * numberOfAuthentications);
+
+    fleetServerContext.stop();
+    targetHardwareStatusThread.join();
+
+    tftpTargetHardwareServer->stopListening();
+    serverThread.join();
+}
+
+TEST_F(AuthenticationDataLoaderTest, AuthenticationDataLoaderWarmStart)
+{
+    FleetServerContext fleetServerContext;
+
+    tftpTargetHardwareServer->registerOpenFileCallback(
+        fleetOpenFileCallback, &fleetServerContext);
+
+    std::thread serverThread = std::thread([this]
+                                           { tftpTargetHardwareServer->startListening(); });
+    std::thread targetHardwareStatusThread = std::thread([&]
+                                                         { fleetServerContext.sendStatus(tftpTargetHardwareStatusClient); });
+
+    // Stopping the DataLoader before each authentication makes it start cold
+    const size_t numberOfAuthentications = 50;
+    for (size_t warm = 0; warm < 2; warm++)
+    {
+        for (size_t i = 0; i < numberOfAuthentications; i++)
+        {
+            if (!warm)
+            {
+                ASSERT_EQ(authenticationDataLoader->stop(),
+                          AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+            }
+
+            std::shared_ptr<AuthenticationHandle> handle;
+            ASSERT_EQ(authenticationDataLoader->authenticateAsync(
+                          TARGET_HARDWARE_ID, TARGET_HARDWARE_POSITION, TARGET_HARDWARE_IP,
+                          loadList, nullptr, nullptr, handle),
+                      AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+            ASSERT_EQ(handle->getFuture().get(),
+                      AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+
+            // The initialization file was requested by this authentication
+            ASSERT_EQ(fleetServerContext.initializationRequests,
+                      warm * numberOfAuthentications + i + 1);
+        }
+    }
+
+    // Nothing in flight anymore
+    ASSERT_EQ(authenticationDataLoader->stop(),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+
+    fleetServerContext.stop();
+    targetHardwareStatusThread.join();
+
+    tftpTargetHardwareServer->stopListening();
+    serverThread.join();
+}
+
+TEST_F(AuthenticationDataLoaderTest, AuthenticationDataLoaderReceiveBufferPool)
+{
+    FleetServerContext fleetServerContext;
+
+    tftpTargetHardwareServer->registerOpenFileCallback(
+        fleetOpenFileCallback, &fleetServerContext);
+
+    std::thread serverThread = std::thread([this]
+                                           { tftpTargetHardwareServer->startListening(); });
+    std::thread targetHardwareStatusThread = std::thread([&]
+                                                         { fleetServerContext.sendStatus(tftpTargetHardwareStatusClient); });
+
+    // Every status file is received in a buffer of the pool, and one file
+    // at a time needs only a few of them
+    const int numberOfAuthentications = 100;
+    for (int i = 0; i < numberOfAuthentications; i++)
+    {
+        std::shared_ptr<AuthenticationHandle> handle;
+        ASSERT_EQ(authenticationDataLoader->authenticateAsync(
+                      TARGET_HARDWARE_ID, TARGET_HARDWARE_POSITION, TARGET_HARDWARE_IP,
+                      loadList, nullptr, nullptr, handle),
+                  AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+        ASSERT_EQ(handle->getFuture().get(),
+                  AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    }
+    ASSERT_EQ(authenticationDataLoader->stop(),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+
+    size_t buffersInUse = 0;
+    size_t highWaterMark = 0;
+    size_t overflows = 0;
+    ASSERT_EQ(authenticationDataLoader->getReceiveBufferPoolUsage(
+                  buffersInUse, highWaterMark, overflows),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(buffersInUse, 0);
+    ASSERT_GE(highWaterMark, 1);
+    ASSERT_LE(highWaterMark, DEFAULT_RECEIVE_BUFFER_POOL_SLAB);
+    ASSERT_EQ(overflows, 0);
+
+    fleetServerContext.stop();
+    targetHardwareStatusThread.join();
+
+    tftpTargetHardwareServer->stopListening();
+    serverThread.join();
+}
+
+TEST_F(AuthenticationDataLoaderTest, AuthenticationDataLoaderCertificateCache)
+{
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+
+    // Preloaded once, served from memory afterwards
+    ASSERT_EQ(authenticationDataLoader->preloadCertificate("certificate/pescert.crt"),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(authenticationDataLoader->preloadCertificate("certificate/pescert.crt"),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(authenticationDataLoader->preloadCertificate("certificate/inexistent_pescert.crt"),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR);
+    ASSERT_EQ(authenticationDataLoader->getCertificateCacheStatistics(hits, misses, evictions),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(hits, 1);
+    ASSERT_EQ(misses, 1);
+    ASSERT_EQ(evictions, 0);
+
+    // No budget, no cache
+    ASSERT_EQ(authenticationDataLoader->setCertificateCacheBudget(0),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(authenticationDataLoader->preloadCertificate("certificate/pescert.crt"),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR);
+    ASSERT_EQ(authenticationDataLoader->getCertificateCacheStatistics(hits, misses, evictions),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(hits, 1);
+    ASSERT_EQ(misses, 2);
+    ASSERT_EQ(evictions, 1);
+}
+
+TEST_F(AuthenticationDataLoaderTest, AuthenticationDataLoaderMultipleLoads)
+{
+    LoadFetchingServerContext serverContext;
+
+    tftpTargetHardwareServer->registerOpenFileCallback(
+        loadFetchingOpenFileCallback, &serverContext);
+    tftpTargetHardwareServer->registerSectionFinishedCallback(
+        loadFetchingSectionFinished, &serverContext);
+
+    std::thread serverThread = std::thread([this]
+                                           { tftpTargetHardwareServer->startListening(); });
+    std::thread targetHardwareThread = std::thread([&]
+                                                   { serverContext.run(tftpTargetHardwareStatusClient); });
+
+    const size_t maxLoads = 16;
+    std::vector<AuthenticationLoad> loads;
+    for (size_t i = 0; i < maxLoads; i++)
+    {
+        char fileName[64];
+        snprintf(fileName, sizeof(fileName), MULTIPLE_LOADS_FILE, i);
+        std::vector<char> content(MULTIPLE_LOADS_FILE_SIZE + i, (char)i);
+        std::ofstream file(fileName, std::ios::binary);
+        file.write(content.data(), content.size());
+        loads.push_back(std::make_tuple(std::string(fileName), std::to_string(i)));
+    }
+
+    // Every load in one authentication
+    const size_t numberOfLoads[] = {1, 4, 16};
+    for (size_t n : numberOfLoads)
+    {
+        std::vector<AuthenticationLoad> loadList(loads.begin(), loads.begin() + n);
+        std::shared_ptr<AuthenticationHandle> handle;
+        ASSERT_EQ(authenticationDataLoader->authenticateAsync(
+                      TARGET_HARDWARE_ID, TARGET_HARDWARE_POSITION, TARGET_HARDWARE_IP,
+                      loadList, nullptr, nullptr, handle),
+                  AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+        ASSERT_EQ(handle->getFuture().get(),
+                  AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+
+        // Each load fetched whole, and reported completed
+        std::vector<AuthenticationLoadProgress> loadProgress;
+        uint32_t loadListRatio = 0;
+        ASSERT_EQ(handle->getLoadProgress(loadProgress, loadListRatio),
+                  AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+        ASSERT_EQ(loadProgress.size(), n);
+        ASSERT_EQ(loadListRatio, 100);
+        for (size_t i = 0; i < n; i++)
+        {
+            ASSERT_EQ(loadProgress[i].headerFileName, std::get<LOAD_FILE_NAME_IDX>(loads[i]));
+            ASSERT_EQ(loadProgress[i].loadPartNumberName, std::get<LOAD_PART_NUMBER_IDX>(loads[i]));
+            ASSERT_EQ(loadProgress[i].loadStatus, STATUS_AUTHENTICATION_COMPLETED);
+            ASSERT_EQ(loadProgress[i].loadRatio, 100);
+
+            std::lock_guard<std::mutex> lock(serverContext.fetchedMutex);
+            ASSERT_EQ(serverContext.fetchedSize[std::get<LOAD_FILE_NAME_IDX>(loads[i])],
+                      MULTIPLE_LOADS_FILE_SIZE + i);
+        }
+    }
+
+    // Every load read was timed, from its open to its close
+    size_t numberOfReads = 0;
+    for (size_t n : numberOfLoads)
+    {
+        numberOfReads += n;
+    }
+    AuthenticationLatencySummary summary;
+    ASSERT_EQ(authenticationDataLoader->getPhaseLatency(
+                  AuthenticationPhase::AUTHENTICATION_PHASE_CERTIFICATE_READ, summary),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(summary.count, numberOfReads);
+
+    serverContext.stop();
+    targetHardwareThread.join();
+
+    tftpTargetHardwareServer->stopListening();
+    serverThread.join();
+
+    for (size_t i = 0; i < maxLoads; i++)
+    {
+        remove(std::get<LOAD_FILE_NAME_IDX>(loads[i]).c_str());
+    }
+}
+
+TEST_F(AuthenticationDataLoaderTest, AuthenticationDataLoaderRetryAndWait)
+{
+    FleetServerContext fleetServerContext;
+    BusyServerContext busyServerContext(&fleetServerContext);
+
+    tftpTargetHardwareServer->registerOpenFileCallback(
+        busyOpenFileCallback, &busyServerContext);
+
+    std::thread serverThread = std::thread([this]
+                                           { tftpTargetHardwareServer->startListening(); });
+    std::thread targetHardwareStatusThread = std::thread([&]
+                                                         { fleetServerContext.sendStatus(tftpTargetHardwareStatusClient); });
+
+    // A failed try is retried after a backoff, a WAIT after the time asked
+    busyServerContext.failuresToAnswer = 1;
+    busyServerContext.waitsToAnswer = 1;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::shared_ptr<AuthenticationHandle> handle;
+    ASSERT_EQ(authenticationDataLoader->authenticateAsync(
+                  TARGET_HARDWARE_ID, TARGET_HARDWARE_POSITION, TARGET_HARDWARE_IP,
+                  loadList, nullptr, nullptr, handle),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(handle->getFuture().get(),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    ASSERT_GE(elapsed.count(), DEFAULT_WAIT_TIME);
+
+    uint32_t retries = 0;
+    uint32_t waits = 0;
+    ASSERT_EQ(handle->getRetryStatistics(retries, waits),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(retries, 1);
+    ASSERT_EQ(waits, 1);
+
+    // Out of tries, the authentication fails
+    busyServerContext.failuresToAnswer = MAX_DLP_TRIES;
+    ASSERT_EQ(authenticationDataLoader->setRetryPolicy(nullptr),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR);
+    ASSERT_EQ(authenticationDataLoader->setRetryPolicy(
+                  std::make_shared<AuthenticationRetryPolicy>(MAX_DLP_TRIES, std::chrono::milliseconds(1))),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(authenticationDataLoader->authenticateAsync(
+                  TARGET_HARDWARE_ID, TARGET_HARDWARE_POSITION, TARGET_HARDWARE_IP,
+                  loadList, nullptr, nullptr, handle),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(handle->getFuture().get(),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR);
+    ASSERT_EQ(handle->getRetryStatistics(retries, waits),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(retries, MAX_DLP_TRIES - 1);
+    ASSERT_EQ(waits, 0);
+
+    fleetServerContext.stop();
+    targetHardwareStatusThread.join();
+
+    tftpTargetHardwareServer->stopListening();
+    serverThread.join();
+}
+
+TEST_F(AuthenticationDataLoaderTest, AuthenticationDataLoaderExceptionTimer)
+{
+    FleetServerContext fleetServerContext;
+    BusyServerContext busyServerContext(&fleetServerContext);
+    busyServerContext.silentLoadList = true;
+
+    tftpTargetHardwareServer->registerOpenFileCallback(
+        busyOpenFileCallback, &busyServerContext);
+
+    std::thread serverThread = std::thread([this]
+                                           { tftpTargetHardwareServer->startListening(); });
+    std::thread targetHardwareStatusThread = std::thread([&]
+                                                         { fleetServerContext.sendStatus(tftpTargetHardwareStatusClient); });
+
+    // The target hardware tells it will be silent for a second only, so its
+    // silence is noticed long before the default timeout
+    const uint16_t exceptionTimer = 1;
+    fleetServerContext.exceptionTimer = exceptionTimer;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::shared_ptr<AuthenticationHandle> handle;
+    ASSERT_EQ(authenticationDataLoader->authenticateAsync(
+                  TARGET_HARDWARE_ID, TARGET_HARDWARE_POSITION, TARGET_HARDWARE_IP,
+                  loadList, nullptr, nullptr, handle),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(handle->getFuture().get(),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    ASSERT_GE(elapsed.count(), exceptionTimer);
+
+    fleetServerContext.stop();
+    targetHardwareStatusThread.join();
+
+    tftpTargetHardwareServer->stopListening();
+    serverThread.join();
+}
+
+// Fleet whose first targets are slow to answer their initialization
+TftpServerOperationResult slowFleetOpenFileCallback(
+    ITFTPSection *sectionHandler,
+    FILE **fp,
+    char *filename,
+    char *mode,
+    size_t *bufferSize,
+    void *context)
+{
+    std::string baseFileName(filename);
+    if ((strcmp(mode, "r") == 0) &&
+        ((baseFileName.find("TH0_") == 0) || (baseFileName.find("TH4_") == 0)))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    return fleetOpenFileCallback(sectionHandler, fp, filename, mode, bufferSize, context);
+}
+
+AuthenticationOperationResult FleetAuthenticator_TargetCompletedCallback(
+    const FleetTargetResult &result, void *context)
+{
+    if ((context != nullptr) && (result.result == AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK))
+    {
+        (*static_cast<std::atomic<int> *>(context))++;
+    }
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
+TEST_F(AuthenticationDataLoaderTest, AuthenticationDataLoaderFleetAuthenticator)
+{
+    FleetServerContext fleetServerContext;
+
+    tftpTargetHardwareServer->registerOpenFileCallback(
+        slowFleetOpenFileCallback, &fleetServerContext);
+
+    std::thread serverThread = std::thread([this]
+                                           { tftpTargetHardwareServer->startListening(); });
+    std::thread targetHardwareStatusThread = std::thread([&]
+                                                         { fleetServerContext.sendStatus(tftpTargetHardwareStatusClient); });
+
+    const size_t numberOfTargets = 16;
+    const size_t concurrency = 4;
+    FleetAuthenticator fleetAuthenticator(authenticationDataLoader, concurrency);
+    FleetReport report;
+    ASSERT_EQ(fleetAuthenticator.getReport(report),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR);
+    ASSERT_EQ(fleetAuthenticator.authenticate(),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR);
+    ASSERT_EQ(fleetAuthenticator.setConcurrency(0),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR);
+
+    for (size_t i = 0; i < numberOfTargets; i++)
+    {
+        ASSERT_EQ(fleetAuthenticator.addTarget(
+                      std::string("TH") + std::to_string(i), TARGET_HARDWARE_POSITION,
+                      TARGET_HARDWARE_IP, loadList),
+                  AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    }
+    ASSERT_EQ(fleetAuthenticator.addTarget(std::string("TH0"), TARGET_HARDWARE_POSITION,
+                                           TARGET_HARDWARE_IP, loadList),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR);
+
+    std::atomic<int> completedTargets(0);
+    ASSERT_EQ(fleetAuthenticator.registerTargetCompletedCallback(
+                  FleetAuthenticator_TargetCompletedCallback, &completedTargets),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(fleetAuthenticator.authenticate(),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(completedTargets, numberOfTargets);
+
+    std::vector<FleetTargetResult> results;
+    ASSERT_EQ(fleetAuthenticator.getResults(results),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(results.size(), numberOfTargets);
+    for (std::vector<FleetTargetResult>::iterator it = results.begin(); it != results.end(); ++it)
+    {
+        ASSERT_EQ(it->result, AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+        ASSERT_EQ(it->state, AuthenticationTargetState::AUTHENTICATION_TARGET_COMPLETED);
+        ASSERT_LE(it->startedAt, it->endedAt);
+
+        // A target starts only once another one ended past the cap
+        size_t inFlight = 0;
+        for (std::vector<FleetTargetResult>::iterator other = results.begin();
+             other != results.end(); ++other)
+        {
+            if ((other->startedAt <= it->startedAt) && (it->startedAt < other->endedAt))
+            {
+                inFlight++;
+            }
+        }
+        ASSERT_LE(inFlight, concurrency);
+    }
+
+    // The slow TH0 and TH4 hold up their own slot only
+    ASSERT_EQ(fleetAuthenticator.getReport(report),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(report.numberOfTargets, numberOfTargets);
+    ASSERT_EQ(report.numberOfCompletedTargets, numberOfTargets);
+    ASSERT_EQ(report.numberOfFailedTargets, 0);
+    ASSERT_EQ(report.concurrency, concurrency);
+    ASSERT_LE(report.longestTargetTime, report.makespan);
+    ASSERT_LT(report.makespan, report.totalTargetTime);
+    ASSERT_GT(report.throughput, 0);
+
+    fleetServerContext.stop();
+    targetHardwareStatusThread.join();
+
+    tftpTargetHardwareServer->stopListening();
+    serverThread.join();
+}
+
+TEST_F(AuthenticationDataLoaderTest, AuthenticationDataLoaderFleetAuthenticatorAbort)
+{
+    FleetServerContext fleetServerContext;
+
+    tftpTargetHardwareServer->registerOpenFileCallback(
+        fleetOpenFileCallback, &fleetServerContext);
+
+    std::thread serverThread = std::thread([this]
+                                           { tftpTargetHardwareServer->startListening(); });
+
+    // Keep the target hardwares quiet, so the first targets stay in flight
+    fleetServerContext.setPauseSending(true);
+    std::thread targetHardwareStatusThread = std::thread([&]
+                                                         { fleetServerContext.sendStatus(tftpTargetHardwareStatusClient); });
+
+    const size_t numberOfTargets = 16;
+    const size_t concurrency = 4;
+    FleetAuthenticator fleetAuthenticator(authenticationDataLoader, concurrency);
+    ASSERT_EQ(fleetAuthenticator.abort(),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR);
+    for (size_t i = 0; i < numberOfTargets; i++)
+    {
+        ASSERT_EQ(fleetAuthenticator.addTarget(
+                      std::string("TH") + std::to_string(i), TARGET_HARDWARE_POSITION,
+                      TARGET_HARDWARE_IP, loadList),
+                  AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    }
+    std::atomic<int> completedTargets(0);
+    ASSERT_EQ(fleetAuthenticator.registerTargetCompletedCallback(
+                  FleetAuthenticator_TargetCompletedCallback, &completedTargets),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+
+    std::atomic<AuthenticationOperationResult> fleetResult(
+        AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    std::thread fleetThread([&]
+                            { fleetResult = fleetAuthenticator.authenticate(); });
+
+    // Every slot is taken once each target in flight was initialized
+    while (fleetServerContext.initializationRequests < concurrency)
+    {
+        std::this_thread::yield();
+    }
+    ASSERT_EQ(fleetAuthenticator.abort(AUTHENTICATION_ABORT_SOURCE_OPERATOR),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(fleetAuthenticator.abort(AUTHENTICATION_ABORT_SOURCE_OPERATOR),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR);
+
+    // The targets in flight accepted, and end once they report the abort
+    fleetServerContext.setPauseSending(false);
+    fleetThread.join();
+    ASSERT_EQ(fleetResult, AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR);
+    ASSERT_EQ(completedTargets, 0);
+
+    // No target was started past the ones in flight
+    ASSERT_EQ(fleetServerContext.initializationRequests, concurrency);
+
+    std::vector<FleetTargetResult> results;
+    ASSERT_EQ(fleetAuthenticator.getResults(results),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(results.size(), numberOfTargets);
+    size_t abortedTargets = 0;
+    for (std::vector<FleetTargetResult>::iterator it = results.begin(); it != results.end(); ++it)
+    {
+        ASSERT_EQ(it->result, AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR);
+        ASSERT_EQ(it->state, it->aborted ? AuthenticationTargetState::AUTHENTICATION_TARGET_PENDING
+                                         : AuthenticationTargetState::AUTHENTICATION_TARGET_FAILED);
+        if (it->aborted)
+        {
+            abortedTargets++;
+        }
+    }
+    ASSERT_EQ(abortedTargets, numberOfTargets - concurrency);
+
+    FleetReport report;
+    ASSERT_EQ(fleetAuthenticator.getReport(report),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(report.numberOfTargets, numberOfTargets);
+    ASSERT_EQ(report.numberOfCompletedTargets, 0);
+    ASSERT_EQ(report.numberOfFailedTargets, concurrency);
+    ASSERT_EQ(report.numberOfAbortedTargets, numberOfTargets - concurrency);
+
+    fleetServerContext.stop();
+    targetHardwareStatusThread.join();
+
+    tftpTargetHardwareServer->stopListening();
+    serverThread.join();
+}
+
+TEST_F(AuthenticationDataLoaderTest, AuthenticationDataLoaderPhaseLatencies)
+{
+    FleetServerContext fleetServerContext;
+
+    tftpTargetHardwareServer->registerOpenFileCallback(
+        fleetOpenFileCallback, &fleetServerContext);
+
+    std::thread serverThread = std::thread([this]
+                                           { tftpTargetHardwareServer->startListening(); });
+    std::thread targetHardwareStatusThread = std::thread([&]
+                                                         { fleetServerContext.sendStatus(tftpTargetHardwareStatusClient); });
+
+    const size_t numberOfTargets = 16;
+    for (size_t i = 0; i < numberOfTargets; i++)
+    {
+        ASSERT_EQ(authenticationDataLoader->addTarget(
+                      std::string("TH") + std::to_string(i), TARGET_HARDWARE_POSITION,
+                      TARGET_HARDWARE_IP, loadList),
+                  AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    }
+    ASSERT_EQ(authenticationDataLoader->authenticateTargets(),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+
+    // The engine started once, every other phase ran once per target
+    AuthenticationLatencySummary summary;
+    ASSERT_EQ(authenticationDataLoader->getPhaseLatency(
+                  AuthenticationPhase::AUTHENTICATION_PHASE_TFTP_INIT, summary),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(summary.count, 1);
+    const AuthenticationPhase targetPhases[] = {
+        AuthenticationPhase::AUTHENTICATION_PHASE_INITIALIZATION_FETCH,
+        AuthenticationPhase::AUTHENTICATION_PHASE_ACCEPTANCE_WAIT,
+        AuthenticationPhase::AUTHENTICATION_PHASE_LOAD_LIST_SEND,
+        AuthenticationPhase::AUTHENTICATION_PHASE_COMPLETION_WAIT,
+        AuthenticationPhase::AUTHENTICATION_PHASE_TOTAL};
+    for (AuthenticationPhase phase : targetPhases)
+    {
+        ASSERT_EQ(authenticationDataLoader->getPhaseLatency(phase, summary),
+                  AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+        ASSERT_EQ(summary.count, numberOfTargets);
+        ASSERT_LE(summary.min, summary.p50);
+        ASSERT_LE(summary.p50, summary.p99);
+        ASSERT_LE(summary.p99, summary.max);
+
+        ASSERT_EQ(authenticationDataLoader->getTargetPhaseLatency(
+                      "TH0", TARGET_HARDWARE_POSITION, phase, summary),
+                  AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+        ASSERT_EQ(summary.count, 1);
+    }
+    ASSERT_EQ(authenticationDataLoader->getTargetPhaseLatency(
+                  "UNKNOWN", TARGET_HARDWARE_POSITION,
+                  AuthenticationPhase::AUTHENTICATION_PHASE_TOTAL, summary),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR);
+
+    // Certificates are shared, so their reads are timed for the DataLoader only
+    ASSERT_EQ(authenticationDataLoader->getTargetPhaseLatency(
+                  "TH0", TARGET_HARDWARE_POSITION,
+                  AuthenticationPhase::AUTHENTICATION_PHASE_CERTIFICATE_READ, summary),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR);
+
+    std::string report;
+    ASSERT_EQ(authenticationDataLoader->serializeLatencies(report),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    ASSERT_NE(report.find("initialization_fetch"), std::string::npos);
+    size_t targetTables = report.find("TH0");
+    ASSERT_NE(targetTables, std::string::npos);
+    ASSERT_LT(report.find("certificate_read"), targetTables);
+    ASSERT_EQ(report.find("certificate_read", targetTables), std::string::npos);
+
+    ASSERT_EQ(authenticationDataLoader->serializeLatenciesJSON(report),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    cJSON *root = cJSON_Parse(report.c_str());
+    ASSERT_NE(root, nullptr);
+    cJSON *targets = cJSON_GetObjectItem(root, "targets");
+    ASSERT_NE(targets, nullptr);
+    ASSERT_EQ(cJSON_GetArraySize(targets), numberOfTargets);
+    cJSON *target = cJSON_GetObjectItem(targets, (std::string("TH0_") + TARGET_HARDWARE_POSITION).c_str());
+    ASSERT_NE(target, nullptr);
+    ASSERT_EQ(cJSON_GetObjectItem(target, "certificate_read"), nullptr);
+    ASSERT_NE(cJSON_GetObjectItem(target, "total"), nullptr);
+    cJSON *total = cJSON_GetObjectItem(cJSON_GetObjectItem(root, "dataLoader"), "total");
+    ASSERT_NE(total, nullptr);
+    ASSERT_EQ(cJSON_GetObjectItem(total, "count")->valuedouble, numberOfTargets);
+    cJSON_Delete(root);
+
+    ASSERT_EQ(authenticationDataLoader->resetLatencies(),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(authenticationDataLoader->getPhaseLatency(
+                  AuthenticationPhase::AUTHENTICATION_PHASE_TOTAL, summary),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(summary.count, 0);
+
+    fleetServerContext.stop();
+    targetHardwareStatusThread.join();
+
+    tftpTargetHardwareServer->stopListening();
+    serverThread.join();
+}
+
+TEST_F(AuthenticationDataLoaderTest, AuthenticationDataLoaderAbortInFlight)
+{
+    FleetServerContext fleetServerContext;
+    AbortServerContext abortServerContext(&fleetServerContext);
+
+    tftpTargetHardwareServer->registerOpenFileCallback(
+        abortOpenFileCallback, &abortServerContext);
+
+    std::thread serverThread = std::thread([this]
+                                           { tftpTargetHardwareServer->startListening(); });
+    std::thread targetHardwareStatusThread = std::thread([&]
+                                                         { fleetServerContext.sendStatus(tftpTargetHardwareStatusClient); });
+    std::thread targetHardwareAbortThread = std::thread([&]
+                                                        { abortServerContext.sendStatus(); });
+
+    // The target hardware is told to abort on its very next status file,
+    // and the authentication ends as soon as it reports the abort
+    const int numberOfAborts = 50;
+    for (int i = 0; i < numberOfAborts; i++)
+    {
+        std::shared_ptr<AuthenticationHandle> handle;
+        ASSERT_EQ(authenticationDataLoader->authenticateAsync(
+                      TARGET_HARDWARE_ID, TARGET_HARDWARE_POSITION, TARGET_HARDWARE_IP,
+                      loadList, nullptr, nullptr, handle),
+                  AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+        while (!abortServerContext.loadListReceived)
+        {
+            std::this_thread::yield();
+        }
+
+        ASSERT_EQ(authenticationDataLoader->abort(AUTHENTICATION_ABORT_SOURCE_DATALOADER),
+                  AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+        ASSERT_EQ(handle->getFuture().get(),
+                  AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR);
+        AuthenticationTargetState state;
+        handle->getState(state);
+        ASSERT_EQ(state, AuthenticationTargetState::AUTHENTICATION_TARGET_FAILED);
+
+        // Cleared once the target hardware got the abort and reported it
+        while (abortServerContext.loadListReceived)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    abortServerContext.stopSending = true;
+    targetHardwareAbortThread.join();
+
+    // A transfer waiting to be retried gives up at once, which ends an
+    // authentication the target hardware never accepted
+    const uint32_t waitsToAnswer = 1000;
+    BusyServerContext busyServerContext(&fleetServerContext);
+    busyServerContext.waitsToAnswer = waitsToAnswer;
+    tftpTargetHardwareServer->registerOpenFileCallback(
+        busyOpenFileCallback, &busyServerContext);
+    std::shared_ptr<AuthenticationHandle> handle;
+    ASSERT_EQ(authenticationDataLoader->authenticateAsync(
+                  TARGET_HARDWARE_ID, TARGET_HARDWARE_POSITION, TARGET_HARDWARE_IP,
+                  loadList, nullptr, nullptr, handle),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    uint32_t retries = 0;
+    uint32_t waits = 0;
+    while (waits == 0)
+    {
+        handle->getRetryStatistics(retries, waits);
+        std::this_thread::yield();
+    }
+    ASSERT_EQ(authenticationDataLoader->abort(AUTHENTICATION_ABORT_SOURCE_DATALOADER),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(handle->getFuture().get(),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR);
+
+    // The transfer gave up long before the target hardware would answer
+    AuthenticationTargetState state;
+    handle->getState(state);
+    ASSERT_EQ(state, AuthenticationTargetState::AUTHENTICATION_TARGET_FAILED);
+    handle->getRetryStatistics(retries, waits);
+    ASSERT_LT(waits, waitsToAnswer);
+
+    fleetServerContext.stop();
+    targetHardwareStatusThread.join();
+
+    tftpTargetHardwareServer->stopListening();
+    serverThread.join();
+}
+
+static TftpClientOperationResult fetchCertificate(TFTPClient *fetchClient)
+{
+    char *data = NULL;
+    size_t size = 0;
+    FILE *fp = open_memstream(&data, &size);
+    TftpClientOperationResult result = fetchClient->fetchFile("certificate/pescert.crt", fp);
+    fclose(fp);
+    free(data);
+    return result;
+}
+
+TEST_F(AuthenticationDataLoaderTest, AuthenticationDataLoaderAbortNewTarget)
+{
+    FleetServerContext fleetServerContext;
+    AbortServerContext abortServerContext(&fleetServerContext);
+
+    tftpTargetHardwareServer->registerOpenFileCallback(
+        abortOpenFileCallback, &abortServerContext);
+
+    std::thread serverThread = std::thread([this]
+                                           { tftpTargetHardwareServer->startListening(); });
+    std::thread targetHardwareStatusThread = std::thread([&]
+                                                         { fleetServerContext.sendStatus(tftpTargetHardwareStatusClient); });
+
+    TFTPClient fetchClient;
+    ASSERT_EQ(fetchClient.setConnection(LOCALHOST, TFTP_DATALOADER_SERVER_PORT),
+              TftpClientOperationResult::TFTP_CLIENT_OK);
+
+    std::shared_ptr<AuthenticationHandle> abortedHandle;
+    ASSERT_EQ(authenticationDataLoader->authenticateAsync(
+                  TARGET_HARDWARE_ID, TARGET_HARDWARE_POSITION, TARGET_HARDWARE_IP,
+                  loadList, nullptr, nullptr, abortedHandle),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    while (!abortServerContext.loadListReceived)
+    {
+        std::this_thread::yield();
+    }
+
+    // The target hardware is not told of the abort until it sends a status
+    // file, so the abort is still running
+    ASSERT_EQ(authenticationDataLoader->abort(AUTHENTICATION_ABORT_SOURCE_DATALOADER),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(fetchCertificate(&fetchClient), TftpClientOperationResult::TFTP_CLIENT_ERROR);
+
+    // A target started meanwhile is not aborted, and reads its certificates
+    fleetServerContext.setPauseSending(true);
+    std::shared_ptr<AuthenticationHandle> newHandle;
+    ASSERT_EQ(authenticationDataLoader->authenticateAsync(
+                  "TH1", TARGET_HARDWARE_POSITION, TARGET_HARDWARE_IP,
+                  loadList, nullptr, nullptr, newHandle),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(fetchCertificate(&fetchClient), TftpClientOperationResult::TFTP_CLIENT_OK);
+    AuthenticationTargetState state;
+    newHandle->getState(state);
+    ASSERT_NE(state, AuthenticationTargetState::AUTHENTICATION_TARGET_FAILED);
+
+    // Its initialization file was served, so it ends once the target
+    // hardware reports the abort
+    while (fleetServerContext.initializationRequests < 2)
+    {
+        std::this_thread::yield();
+    }
+    ASSERT_EQ(newHandle->cancel(AUTHENTICATION_ABORT_SOURCE_OPERATOR),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    fleetServerContext.setPauseSending(false);
+    ASSERT_EQ(newHandle->getFuture().get(),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR);
+
+    std::thread targetHardwareAbortThread = std::thread([&]
+                                                        { abortServerContext.sendStatus(); });
+    ASSERT_EQ(abortedHandle->getFuture().get(),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR);
+    abortServerContext.stopSending = true;
+    targetHardwareAbortThread.join();
+
+    // Nothing in flight is aborted anymore
+    ASSERT_EQ(fetchCertificate(&fetchClient), TftpClientOperationResult::TFTP_CLIENT_OK);
+
+    fleetServerContext.stop();
+    targetHardwareStatusThread.join();
+
+    tftpTargetHardwareServer->stopListening();
+    serverThread.join();
+}
+
+// Counts the status files reported, and holds the client processor while
+// the test queues more of them
+class StatusGateContext
+{
+public:
+    StatusGateContext()
+    {
+        reported = 0;
+        holding = false;
+        held = false;
+    }
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    uint32_t reported;
+    bool holding;
+    bool held;
+
+    void waitReported(uint32_t expected)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&]
+                { return reported >= expected; });
+    }
+};
+
+AuthenticationOperationResult gatedStatusCallback(std::string authenticationInformationStatusJson,
+                                                  void *context)
+{
+    StatusGateContext *statusGateContext = static_cast<StatusGateContext *>(context);
+    std::unique_lock<std::mutex> lock(statusGateContext->mutex);
+    statusGateContext->reported++;
+    statusGateContext->held = statusGateContext->holding;
+    statusGateContext->cv.notify_all();
+    statusGateContext->cv.wait(lock, [&]
+                               { return !statusGateContext->holding; });
+    return AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK;
+}
+
+// A malformed status file keeps its counter, but claims more header files
+// than it holds
+static TftpClientOperationResult trySendCountedStatus(TFTPClient *statusClient,
+                                                      uint16_t status, uint16_t counter,
+                                                      bool malformed = false)
+{
+    std::string statusFileName = std::string(TARGET_HARDWARE_ID) + "_" +
+                                 TARGET_HARDWARE_POSITION +
+                                 LOAD_AUTHENTICATION_STATUS_FILE_EXTENSION;
+    LoadAuthenticationStatusFile loadAuthenticationStatusFile(statusFileName,
+                                                              AUTHENTICATION_VERSION);
+    loadAuthenticationStatusFile.setAuthenticationOperationStatusCode(status);
+    loadAuthenticationStatusFile.setCounter(counter);
+    std::shared_ptr<std::vector<uint8_t>> fileBuffer =
+        std::make_shared<std::vector<uint8_t>>();
+    loadAuthenticationStatusFile.serialize(fileBuffer);
+    if (malformed)
+    {
+        // With no header file, the file ends with their count
+        (*fileBuffer)[fileBuffer->size() - 2] = 0xFF;
+        (*fileBuffer)[fileBuffer->size() - 1] = 0xFF;
+    }
+
+    FILE *fp = fmemopen(fileBuffer->data(), fileBuffer->size(), "r");
+    TftpClientOperationResult result = statusClient->sendFile(statusFileName.c_str(), fp);
+    fclose(fp);
+    return result;
+}
+
+static void sendCountedStatus(TFTPClient *statusClient, uint16_t status, uint16_t counter,
+                              bool malformed = false)
+{
+    ASSERT_EQ(trySendCountedStatus(statusClient, status, counter, malformed),
+              TftpClientOperationResult::TFTP_CLIENT_OK);
+}
+
+TEST_F(AuthenticationDataLoaderTest, AuthenticationDataLoaderStatusDeduplication)
+{
+    // Status files are only sent by the test, the ones queued by the target
+    // hardware server are never sent
+    FleetServerContext fleetServerContext;
+    StatusGateContext statusGateContext;
+    tftpTargetHardwareServer->registerOpenFileCallback(
+        fleetOpenFileCallback, &fleetServerContext);
+    authenticationDataLoader->registerAuthenticationInformationStatusCallback(
+        gatedStatusCallback, &statusGateContext);
+
+    std::thread serverThread = std::thread([this]
+                                           { tftpTargetHardwareServer->startListening(); });
+
+    std::shared_ptr<AuthenticationHandle> handle;
+    ASSERT_EQ(authenticationDataLoader->authenticateAsync(
+                  TARGET_HARDWARE_ID, TARGET_HARDWARE_POSITION, TARGET_HARDWARE_IP,
+                  loadList, nullptr, nullptr, handle),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+
+    // Counters start close to wrapping around
+    sendCountedStatus(tftpTargetHardwareStatusClient, STATUS_AUTHENTICATION_ACCEPTED, 0xFFFB);
+    statusGateContext.waitReported(1);
+
+    // A retransmission and an older status file are dropped unseen
+    sendCountedStatus(tftpTargetHardwareStatusClient, STATUS_AUTHENTICATION_ACCEPTED, 0xFFFB);
+    sendCountedStatus(tftpTargetHardwareStatusClient, STATUS_AUTHENTICATION_ACCEPTED, 0xFFFA);
+    uint32_t duplicates = 0;
+    uint32_t dropped = 0;
+    while ((duplicates + dropped) < 2)
+    {
+        handle->getStatusStatistics(duplicates, dropped);
+        std::this_thread::yield();
+    }
+    ASSERT_EQ(duplicates, 1);
+    ASSERT_EQ(dropped, 1);
+
+    // Of the status files queued while the client processor is busy, only
+    // the newest is processed
+    {
+        std::lock_guard<std::mutex> lock(statusGateContext.mutex);
+        statusGateContext.holding = true;
+    }
+    sendCountedStatus(tftpTargetHardwareStatusClient, STATUS_AUTHENTICATION_IN_PROGRESS, 0xFFFC);
+    {
+        std::unique_lock<std::mutex> lock(statusGateContext.mutex);
+        statusGateContext.cv.wait(lock, [&]
+                                  { return statusGateContext.held; });
+    }
+    sendCountedStatus(tftpTargetHardwareStatusClient, STATUS_AUTHENTICATION_IN_PROGRESS, 0xFFFE);
+    sendCountedStatus(tftpTargetHardwareStatusClient, STATUS_AUTHENTICATION_IN_PROGRESS, 0xFFFD);
+    {
+        std::lock_guard<std::mutex> lock(statusGateContext.mutex);
+        statusGateContext.holding = false;
+    }
+    statusGateContext.cv.notify_all();
+    statusGateContext.waitReported(3);
+
+    // Once wrapped around, the counters before are older
+    sendCountedStatus(tftpTargetHardwareStatusClient, STATUS_AUTHENTICATION_IN_PROGRESS, 0x0001);
+    statusGateContext.waitReported(4);
+    sendCountedStatus(tftpTargetHardwareStatusClient, STATUS_AUTHENTICATION_IN_PROGRESS, 0xFFFF);
+    sendCountedStatus(tftpTargetHardwareStatusClient, STATUS_AUTHENTICATION_COMPLETED, 0x0002);
+    ASSERT_EQ(handle->getFuture().get(),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    handle->getStatusStatistics(duplicates, dropped);
+    ASSERT_EQ(duplicates, 1);
+    ASSERT_EQ(dropped, 3);
+    {
+        std::lock_guard<std::mutex> lock(statusGateContext.mutex);
+        ASSERT_EQ(statusGateContext.reported, 5);
+    }
+
+    tftpTargetHardwareServer->stopListening();
+    serverThread.join();
+}
+
+TEST_F(AuthenticationDataLoaderTest, AuthenticationDataLoaderStatusMalformedNewest)
+{
+    // Status files are only sent by the test, the ones queued by the target
+    // hardware server are never sent
+    FleetServerContext fleetServerContext;
+    StatusGateContext statusGateContext;
+    tftpTargetHardwareServer->registerOpenFileCallback(
+        fleetOpenFileCallback, &fleetServerContext);
+    authenticationDataLoader->registerAuthenticationInformationStatusCallback(
+        gatedStatusCallback, &statusGateContext);
+
+    std::thread serverThread = std::thread([this]
+                                           { tftpTargetHardwareServer->startListening(); });
+
+    std::shared_ptr<AuthenticationHandle> handle;
+    ASSERT_EQ(authenticationDataLoader->authenticateAsync(
+                  TARGET_HARDWARE_ID, TARGET_HARDWARE_POSITION, TARGET_HARDWARE_IP,
+                  loadList, nullptr, nullptr, handle),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+
+    sendCountedStatus(tftpTargetHardwareStatusClient, STATUS_AUTHENTICATION_ACCEPTED, 1);
+    statusGateContext.waitReported(1);
+
+    // A malformed status file queued after a valid one, with a newer
+    // counter, does not drop it
+    {
+        std::lock_guard<std::mutex> lock(statusGateContext.mutex);
+        statusGateContext.holding = true;
+    }
+    sendCountedStatus(tftpTargetHardwareStatusClient, STATUS_AUTHENTICATION_IN_PROGRESS, 2);
+    {
+        std::unique_lock<std::mutex> lock(statusGateContext.mutex);
+        statusGateContext.cv.wait(lock, [&]
+                                  { return statusGateContext.held; });
+    }
+    sendCountedStatus(tftpTargetHardwareStatusClient, STATUS_AUTHENTICATION_IN_PROGRESS, 3);
+    sendCountedStatus(tftpTargetHardwareStatusClient, STATUS_AUTHENTICATION_IN_PROGRESS, 4, true);
+    {
+        std::lock_guard<std::mutex> lock(statusGateContext.mutex);
+        statusGateContext.holding = false;
+    }
+    statusGateContext.cv.notify_all();
+    statusGateContext.waitReported(3);
+
+    uint32_t duplicates = 0;
+    uint32_t dropped = 0;
+    handle->getStatusStatistics(duplicates, dropped);
+    ASSERT_EQ(duplicates, 0);
+    ASSERT_EQ(dropped, 0);
+
+    // The valid one was applied, so the next one follows it
+    sendCountedStatus(tftpTargetHardwareStatusClient, STATUS_AUTHENTICATION_COMPLETED, 4);
+    ASSERT_EQ(handle->getFuture().get(),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    handle->getStatusStatistics(duplicates, dropped);
+    ASSERT_EQ(duplicates, 0);
+    ASSERT_EQ(dropped, 0);
+    {
+        std::lock_guard<std::mutex> lock(statusGateContext.mutex);
+        ASSERT_EQ(statusGateContext.reported, 4);
+    }
+
+    tftpTargetHardwareServer->stopListening();
+    serverThread.join();
+}
+
+TEST_F(AuthenticationDataLoaderTest, AuthenticationDataLoaderAbortBeforeAccepted)
+{
+    // Status files are only sent by the test, the ones queued by the target
+    // hardware server are never sent
+    FleetServerContext fleetServerContext;
+    AbortServerContext abortServerContext(&fleetServerContext);
+    tftpTargetHardwareServer->registerOpenFileCallback(
+        fleetOpenFileCallback, &fleetServerContext);
+
+    std::thread serverThread = std::thread([this]
+                                           { tftpTargetHardwareServer->startListening(); });
+
+    TFTPClient statusClient;
+    ASSERT_EQ(statusClient.setConnection(LOCALHOST, TFTP_DATALOADER_SERVER_PORT),
+              TftpClientOperationResult::TFTP_CLIENT_OK);
+    statusClient.registerTftpErrorCallback(AbortServerContext::abortErrorCallback,
+                                           &abortServerContext);
+
+    std::shared_ptr<AuthenticationHandle> handle;
+    ASSERT_EQ(authenticationDataLoader->authenticateAsync(
+                  TARGET_HARDWARE_ID, TARGET_HARDWARE_POSITION, TARGET_HARDWARE_IP,
+                  loadList, nullptr, nullptr, handle),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    while (fleetServerContext.initializationRequests == 0)
+    {
+        std::this_thread::yield();
+    }
+
+    // The target hardware accepted with its initialization file, so the
+    // authentication is kept until it is told of the abort
+    ASSERT_EQ(authenticationDataLoader->abort(AUTHENTICATION_ABORT_SOURCE_DATALOADER),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    AuthenticationTargetState state;
+    handle->getState(state);
+    ASSERT_NE(state, AuthenticationTargetState::AUTHENTICATION_TARGET_FAILED);
+
+    // Its accepted status file is answered with the abort
+    ASSERT_EQ(trySendCountedStatus(&statusClient, STATUS_AUTHENTICATION_ACCEPTED, 1),
+              TftpClientOperationResult::TFTP_CLIENT_ERROR);
+    ASSERT_EQ(abortServerContext.abortCode, AUTHENTICATION_ABORT_SOURCE_DATALOADER);
+
+    // and the one reporting the abort ends the authentication
+    ASSERT_EQ(trySendCountedStatus(&statusClient,
+                                   STATUS_AUTHENTICATION_ABORTED_IN_THE_TARGET_DL_REQUEST, 2),
+              TftpClientOperationResult::TFTP_CLIENT_OK);
+    ASSERT_EQ(handle->getFuture().get(),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_ERROR);
+    handle->getState(state);
+    ASSERT_EQ(state, AuthenticationTargetState::AUTHENTICATION_TARGET_FAILED);
+
+    // No load list was sent
+    {
+        std::lock_guard<std::mutex> lock(fleetServerContext.statusMutex);
+        ASSERT_EQ(std::count_if(fleetServerContext.pendingStatus.begin(),
+                                fleetServerContext.pendingStatus.end(),
+                                [](const std::pair<std::string, uint16_t> &status)
+                                { return status.second == STATUS_AUTHENTICATION_COMPLETED; }),
+                  0);
+    }
+
+    tftpTargetHardwareServer->stopListening();
+    serverThread.join();
+}
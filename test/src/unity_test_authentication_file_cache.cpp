@@ -0,0 +1,178 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/stat.h>
+
+#include "AuthenticationFileCache.h"
+
+#define FILE_CACHE_TEST_FILE "file_cache_test_%d.bin"
+#define FILE_CACHE_TEST_FILE_SIZE 1000
+#define FILE_CACHE_TEST_BUDGET (3 * FILE_CACHE_TEST_FILE_SIZE)
+
+class AuthenticationFileCacheTest : public ::testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        for (std::vector<std::string>::iterator it = files.begin(); it != files.end(); ++it)
+        {
+            remove(it->c_str());
+        }
+    }
+
+    std::string writeFile(int index, size_t size, uint8_t value)
+    {
+        char path[64];
+        snprintf(path, sizeof(path), FILE_CACHE_TEST_FILE, index);
+        std::vector<uint8_t> content(size, value);
+        FILE *fp = fopen(path, "w");
+        EXPECT_NE(fp, nullptr);
+        if (fp != NULL)
+        {
+            fwrite(content.data(), 1, content.size(), fp);
+            fclose(fp);
+        }
+        if (std::find(files.begin(), files.end(), std::string(path)) == files.end())
+        {
+            files.push_back(path);
+        }
+        return path;
+    }
+
+    std::vector<uint8_t> readAll(FILE *fp)
+    {
+        std::vector<uint8_t> content;
+        uint8_t chunk[256];
+        size_t readSize;
+        while ((readSize = fread(chunk, 1, sizeof(chunk), fp)) > 0)
+        {
+            content.insert(content.end(), chunk, chunk + readSize);
+        }
+        return content;
+    }
+
+    void expectStatistics(AuthenticationFileCache &cache, uint64_t expectedHits,
+                          uint64_t expectedMisses, uint64_t expectedEvictions)
+    {
+        uint64_t hits, misses, evictions;
+        cache.getStatistics(hits, misses, evictions);
+        EXPECT_EQ(hits, expectedHits);
+        EXPECT_EQ(misses, expectedMisses);
+        EXPECT_EQ(evictions, expectedEvictions);
+    }
+
+    std::vector<std::string> files;
+};
+
+TEST_F(AuthenticationFileCacheTest, FileCacheHit)
+{
+    AuthenticationFileCache cache(FILE_CACHE_TEST_BUDGET);
+    std::string path = writeFile(0, FILE_CACHE_TEST_FILE_SIZE, 0xA5);
+
+    // Read from disk once, then served from memory
+    for (int i = 0; i < 3; i++)
+    {
+        FILE *fp = cache.open(path);
+        ASSERT_NE(fp, nullptr);
+        ASSERT_EQ(readAll(fp), std::vector<uint8_t>(FILE_CACHE_TEST_FILE_SIZE, 0xA5));
+        fclose(fp);
+    }
+    expectStatistics(cache, 2, 1, 0);
+    ASSERT_EQ(cache.getSize(), FILE_CACHE_TEST_FILE_SIZE);
+
+    // Read only
+    FILE *fp = cache.open(path);
+    ASSERT_NE(fp, nullptr);
+    ASSERT_EQ(fwrite("X", 1, 1, fp), 0);
+    ASSERT_EQ(fseek(fp, 10, SEEK_SET), 0);
+    ASSERT_EQ(fgetc(fp), 0xA5);
+    fclose(fp);
+
+    ASSERT_EQ(cache.open("file_cache_test_inexistent.bin"), nullptr);
+    ASSERT_FALSE(cache.preload("file_cache_test_inexistent.bin"));
+}
+
+TEST_F(AuthenticationFileCacheTest, FileCacheModified)
+{
+    AuthenticationFileCache cache(FILE_CACHE_TEST_BUDGET);
+    std::string path = writeFile(0, FILE_CACHE_TEST_FILE_SIZE, 0x01);
+    ASSERT_TRUE(cache.preload(path));
+
+    // A new size is read again
+    writeFile(0, FILE_CACHE_TEST_FILE_SIZE / 2, 0x02);
+    FILE *fp = cache.open(path);
+    ASSERT_NE(fp, nullptr);
+    ASSERT_EQ(readAll(fp), std::vector<uint8_t>(FILE_CACHE_TEST_FILE_SIZE / 2, 0x02));
+    fclose(fp);
+
+    // And so is a new modification time
+    writeFile(0, FILE_CACHE_TEST_FILE_SIZE / 2, 0x03);
+    struct timespec times[2];
+    times[0].tv_sec = 1000;
+    times[0].tv_nsec = 0;
+    times[1] = times[0];
+    ASSERT_EQ(utimensat(AT_FDCWD, path.c_str(), times, 0), 0);
+    fp = cache.open(path);
+    ASSERT_NE(fp, nullptr);
+    ASSERT_EQ(readAll(fp), std::vector<uint8_t>(FILE_CACHE_TEST_FILE_SIZE / 2, 0x03));
+    fclose(fp);
+    expectStatistics(cache, 0, 3, 0);
+    ASSERT_EQ(cache.getSize(), FILE_CACHE_TEST_FILE_SIZE / 2);
+
+    // A removed file is dropped
+    remove(path.c_str());
+    ASSERT_EQ(cache.open(path), nullptr);
+    ASSERT_EQ(cache.getSize(), 0);
+}
+
+TEST_F(AuthenticationFileCacheTest, FileCacheEviction)
+{
+    AuthenticationFileCache cache(FILE_CACHE_TEST_BUDGET);
+    std::string paths[4];
+    for (int i = 0; i < 4; i++)
+    {
+        paths[i] = writeFile(i, FILE_CACHE_TEST_FILE_SIZE, i);
+    }
+    for (int i = 0; i < 3; i++)
+    {
+        ASSERT_TRUE(cache.preload(paths[i]));
+    }
+
+    // The least recently used file goes first, and an open FILE outlives it
+    FILE *fp = cache.open(paths[0]);
+    ASSERT_NE(fp, nullptr);
+    ASSERT_TRUE(cache.preload(paths[3]));
+    expectStatistics(cache, 1, 4, 1);
+    ASSERT_EQ(cache.getSize(), FILE_CACHE_TEST_BUDGET);
+    ASSERT_TRUE(cache.preload(paths[0]));
+    ASSERT_TRUE(cache.preload(paths[2]));
+    ASSERT_TRUE(cache.preload(paths[3]));
+    expectStatistics(cache, 4, 4, 1);
+
+    cache.setBudget(FILE_CACHE_TEST_FILE_SIZE);
+    expectStatistics(cache, 4, 4, 3);
+    ASSERT_EQ(readAll(fp), std::vector<uint8_t>(FILE_CACHE_TEST_FILE_SIZE, 0));
+    fclose(fp);
+    ASSERT_TRUE(cache.preload(paths[3]));
+    expectStatistics(cache, 5, 4, 3);
+
+    cache.clear();
+    ASSERT_EQ(cache.getSize(), 0);
+}
+
+TEST_F(AuthenticationFileCacheTest, FileCacheOverBudget)
+{
+    AuthenticationFileCache cache(FILE_CACHE_TEST_FILE_SIZE);
+    std::string path = writeFile(0, 2 * FILE_CACHE_TEST_FILE_SIZE, 0x5A);
+
+    // Served from disk, never cached
+    ASSERT_FALSE(cache.preload(path));
+    FILE *fp = cache.open(path);
+    ASSERT_NE(fp, nullptr);
+    ASSERT_EQ(readAll(fp), std::vector<uint8_t>(2 * FILE_CACHE_TEST_FILE_SIZE, 0x5A));
+    fclose(fp);
+    expectStatistics(cache, 0, 2, 0);
+    ASSERT_EQ(cache.getSize(), 0);
+}
@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include "AuthenticationFileCodec.h"
+
+struct CodecTestElement
+{
+    std::string name;
+    uint32_t ratio;
+
+    struct Codec
+    {
+        typedef CodecTestElement Owner;
+
+        AUTHENTICATION_CODEC_FIELD(AuthenticationString8Encoding, name);
+        AUTHENTICATION_CODEC_FIELD(AuthenticationUint24Encoding, ratio);
+
+        typedef AuthenticationCodec<Owner, nameField, ratioField> Fields;
+    };
+};
+
+struct CodecTestFile
+{
+    CodecTestFile() : code(0), elements(std::make_shared<std::vector<CodecTestElement>>())
+    {
+    }
+
+    uint16_t code;
+    std::vector<uint8_t> key;
+    std::shared_ptr<std::vector<CodecTestElement>> elements;
+
+    struct Codec
+    {
+        typedef CodecTestFile Owner;
+
+        AUTHENTICATION_CODEC_FIELD(AuthenticationUint16Encoding, code);
+        AUTHENTICATION_CODEC_FIELD(AuthenticationBytes16Encoding, key);
+        AUTHENTICATION_CODEC_LIST(CodecTestElement::Codec::Fields, CodecTestElement,
+                                  elements, numberOfElements);
+
+        typedef AuthenticationCodec<Owner, codeField, keyField, elementsField> Fields;
+    };
+};
+
+static CodecTestFile buildCodecTestFile()
+{
+    CodecTestFile file;
+    file.code = 0x1234;
+    file.key = {0x00, 0xAB, 0xFF};
+    CodecTestElement element;
+    element.name = std::string("FIRST", 6);
+    element.ratio = 0x123456;
+    file.elements->push_back(element);
+    element.name = std::string("", 1);
+    element.ratio = 100;
+    file.elements->push_back(element);
+    return file;
+}
+
+TEST(AuthenticationFilesTest, FileCodecEncode)
+{
+    CodecTestFile file = buildCodecTestFile();
+    const uint8_t expected[] = {
+        0x12, 0x34,
+        0x00, 0x03, 0x00, 0xAB, 0xFF,
+        0x00, 0x02,
+        0x06, 'F', 'I', 'R', 'S', 'T', 0x00, 0x12, 0x34, 0x56,
+        0x01, 0x00, 0x00, 0x00, 0x64};
+
+    ASSERT_EQ(CodecTestFile::Codec::Fields::size(file), sizeof(expected));
+
+    uint8_t buffer[sizeof(expected)];
+    AuthenticationBufferWriter writer(buffer, sizeof(buffer));
+    ASSERT_TRUE(CodecTestFile::Codec::Fields::encode(writer, file));
+    ASSERT_EQ(writer.getWritten(), sizeof(expected));
+    ASSERT_EQ(std::memcmp(buffer, expected, sizeof(expected)), 0);
+
+    // Not enough room for the last field
+    AuthenticationBufferWriter shortWriter(buffer, sizeof(buffer) - 1);
+    ASSERT_FALSE(CodecTestFile::Codec::Fields::encode(shortWriter, file));
+}
+
+TEST(AuthenticationFilesTest, FileCodecDecode)
+{
+    CodecTestFile file = buildCodecTestFile();
+    std::vector<uint8_t> buffer(CodecTestFile::Codec::Fields::size(file));
+    AuthenticationBufferWriter writer(buffer.data(), buffer.size());
+    ASSERT_TRUE(CodecTestFile::Codec::Fields::encode(writer, file));
+
+    CodecTestFile decoded;
+    AuthenticationBufferReader reader(buffer.data(), buffer.size());
+    ASSERT_TRUE(CodecTestFile::Codec::Fields::decode(reader, decoded));
+    ASSERT_EQ(reader.getOffset(), buffer.size());
+    ASSERT_EQ(decoded.code, file.code);
+    ASSERT_EQ(decoded.key, file.key);
+    ASSERT_EQ(decoded.elements->size(), 2);
+    ASSERT_EQ(decoded.elements->at(0).name, file.elements->at(0).name);
+    ASSERT_EQ(decoded.elements->at(0).ratio, file.elements->at(0).ratio);
+    ASSERT_EQ(decoded.elements->at(1).name, file.elements->at(1).name);
+    ASSERT_EQ(decoded.elements->at(1).ratio, file.elements->at(1).ratio);
+
+    // Every truncation fails, and leaves no half decoded element behind
+    for (size_t size = 0; size < buffer.size(); size++)
+    {
+        CodecTestFile truncated;
+        AuthenticationBufferReader truncatedReader(buffer.data(), size);
+        ASSERT_FALSE(CodecTestFile::Codec::Fields::decode(truncatedReader, truncated));
+        ASSERT_LE(truncated.elements->size(), 1);
+    }
+}
+
+TEST(AuthenticationFilesTest, FileCodecJSON)
+{
+    CodecTestFile file = buildCodecTestFile();
+    std::string data;
+    AuthenticationJsonWriter writer(data);
+    writer.beginObject();
+    CodecTestFile::Codec::Fields::toJSON(writer, file);
+    writer.endObject();
+
+    ASSERT_EQ(data, "{\"code\":4660,\"keyLength\":3,\"key\":\"00abff\",\"numberOfElements\":2,"
+                    "\"elements\":[{\"nameLength\":6,\"name\":\"FIRST\",\"ratio\":1193046},"
+                    "{\"nameLength\":1,\"name\":\"\",\"ratio\":100}]}");
+
+    cJSON *root = cJSON_Parse(data.c_str());
+    ASSERT_NE(root, nullptr);
+    CodecTestFile decoded;
+    ASSERT_TRUE(CodecTestFile::Codec::Fields::fromJSON(root, decoded));
+    cJSON_Delete(root);
+    ASSERT_EQ(decoded.code, file.code);
+    ASSERT_EQ(decoded.key, file.key);
+    ASSERT_EQ(decoded.elements->size(), 2);
+    ASSERT_EQ(decoded.elements->at(0).name, file.elements->at(0).name);
+    ASSERT_EQ(decoded.elements->at(1).ratio, file.elements->at(1).ratio);
+}
+
+TEST(AuthenticationFilesTest, FileCodecInvalidJSON)
+{
+    const char *invalid[] = {
+        "{\"key\":\"00\",\"keyLength\":1,\"numberOfElements\":0,\"elements\":[]}",
+        "{\"code\":\"1\",\"keyLength\":1,\"key\":\"00\",\"numberOfElements\":0,\"elements\":[]}",
+        "{\"code\":1,\"keyLength\":2,\"key\":\"00\",\"numberOfElements\":0,\"elements\":[]}",
+        "{\"code\":1,\"keyLength\":1,\"key\":\"0g\",\"numberOfElements\":0,\"elements\":[]}",
+        "{\"code\":1,\"keyLength\":1,\"key\":\"00\",\"numberOfElements\":1,\"elements\":[]}",
+        "{\"code\":1,\"keyLength\":1,\"key\":\"00\",\"numberOfElements\":1,\"elements\":[{}]}"};
+
+    for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); i++)
+    {
+        cJSON *root = cJSON_Parse(invalid[i]);
+        ASSERT_NE(root, nullptr);
+        CodecTestFile decoded;
+        EXPECT_FALSE(CodecTestFile::Codec::Fields::fromJSON(root, decoded)) << invalid[i];
+        cJSON_Delete(root);
+    }
+}
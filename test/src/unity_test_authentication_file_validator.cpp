@@ -0,0 +1,217 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include "AuthenticationFileValidator.h"
+#include "InitializationAuthenticationFile.h"
+#include "LoadAuthenticationRequestFile.h"
+#include "LoadAuthenticationStatusFile.h"
+
+#define VALIDATOR_TEST_BUFFER_SIZE 1024
+
+static std::vector<uint8_t> serializeRequestFile(size_t numberOfHeaderFiles)
+{
+    LoadAuthenticationRequestFile file("TEST_FILE.LAR");
+    for (size_t i = 0; i < numberOfHeaderFiles; i++)
+    {
+        LoadAuthenticationRequestHeaderFile headerFile;
+        headerFile.setHeaderFileName("HEADER_" + std::to_string(i) + ".BIN");
+        headerFile.setLoadPartNumberName("PN" + std::to_string(i));
+        file.addHeaderFile(headerFile);
+    }
+    std::shared_ptr<std::vector<uint8_t>> data = std::make_shared<std::vector<uint8_t>>();
+    EXPECT_EQ(file.serialize(data),
+              SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK);
+    return *data;
+}
+
+static std::vector<uint8_t> serializeStatusFile(size_t numberOfHeaderFiles)
+{
+    LoadAuthenticationStatusFile file("TEST_FILE.LAS");
+    file.setAuthenticationStatusDescription("IN PROGRESS");
+    for (size_t i = 0; i < numberOfHeaderFiles; i++)
+    {
+        LoadAuthenticationStatusHeaderFile headerFile;
+        headerFile.setHeaderFileName("HEADER_" + std::to_string(i) + ".BIN");
+        headerFile.setLoadPartNumberName("PN" + std::to_string(i));
+        headerFile.setLoadStatusDescription("OK");
+        file.addHeaderFile(headerFile);
+    }
+    std::shared_ptr<std::vector<uint8_t>> data = std::make_shared<std::vector<uint8_t>>();
+    EXPECT_EQ(file.serialize(data),
+              SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK);
+    return *data;
+}
+
+static std::vector<uint8_t> serializeInitializationFile()
+{
+    InitializationAuthenticationFile file("TEST_FILE.LAI");
+    file.setOperationAcceptanceStatusCode(0x0001);
+    std::vector<uint8_t> key = {0x01, 0x02, 0x03, 0x04};
+    file.setCryptographicKey(key);
+    file.setStatusDescription("ACCEPTED");
+    std::shared_ptr<std::vector<uint8_t>> data = std::make_shared<std::vector<uint8_t>>();
+    EXPECT_EQ(file.serialize(data),
+              SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK);
+    return *data;
+}
+
+static void setFileLength(std::vector<uint8_t> &data, uint32_t fileLength)
+{
+    data[0] = (fileLength >> 24) & 0xFF;
+    data[1] = (fileLength >> 16) & 0xFF;
+    data[2] = (fileLength >> 8) & 0xFF;
+    data[3] = fileLength & 0xFF;
+}
+
+TEST(AuthenticationFilesTest, FileValidatorValidFiles)
+{
+    AuthenticationFileValidator validator;
+
+    std::vector<uint8_t> data = serializeInitializationFile();
+    ASSERT_EQ(validator.validate(data.data(), data.size(),
+                                 AuthenticationFileKind::AUTHENTICATION_FILE_KIND_INITIALIZATION),
+              AuthenticationFileValidationResult::AUTHENTICATION_FILE_VALID);
+
+    data = serializeRequestFile(3);
+    ASSERT_EQ(validator.validate(data.data(), data.size(),
+                                 AuthenticationFileKind::AUTHENTICATION_FILE_KIND_LOAD_REQUEST),
+              AuthenticationFileValidationResult::AUTHENTICATION_FILE_VALID);
+
+    // Received files land in larger buffers: only File Length bytes count
+    data = serializeStatusFile(3);
+    data.resize(VALIDATOR_TEST_BUFFER_SIZE, 0xFF);
+    ASSERT_EQ(validator.validate(data.data(), data.size(),
+                                 AuthenticationFileKind::AUTHENTICATION_FILE_KIND_LOAD_STATUS),
+              AuthenticationFileValidationResult::AUTHENTICATION_FILE_VALID);
+
+    data = serializeRequestFile(0);
+    ASSERT_EQ(validator.validate(data.data(), data.size(),
+                                 AuthenticationFileKind::AUTHENTICATION_FILE_KIND_LOAD_REQUEST),
+              AuthenticationFileValidationResult::AUTHENTICATION_FILE_VALID);
+
+    ASSERT_EQ(validator.getNumberOfValidations(
+                  AuthenticationFileValidationResult::AUTHENTICATION_FILE_VALID),
+              4);
+    ASSERT_EQ(validator.getNumberOfRejectedFiles(), 0);
+}
+
+TEST(AuthenticationFilesTest, FileValidatorLengthPrefix)
+{
+    AuthenticationFileValidator validator;
+    std::vector<uint8_t> data = serializeStatusFile(2);
+
+    ASSERT_EQ(validator.validate(nullptr, 0,
+                                 AuthenticationFileKind::AUTHENTICATION_FILE_KIND_LOAD_STATUS),
+              AuthenticationFileValidationResult::AUTHENTICATION_FILE_TRUNCATED);
+    ASSERT_EQ(validator.validate(data.data(), 3,
+                                 AuthenticationFileKind::AUTHENTICATION_FILE_KIND_LOAD_STATUS),
+              AuthenticationFileValidationResult::AUTHENTICATION_FILE_TRUNCATED);
+    ASSERT_EQ(validator.validate(data.data(), data.size() - 1,
+                                 AuthenticationFileKind::AUTHENTICATION_FILE_KIND_LOAD_STATUS),
+              AuthenticationFileValidationResult::AUTHENTICATION_FILE_TRUNCATED);
+
+    // A file length shorter than the fixed fields
+    setFileLength(data, 10);
+    ASSERT_EQ(validator.validate(data.data(), data.size(),
+                                 AuthenticationFileKind::AUTHENTICATION_FILE_KIND_LOAD_STATUS),
+              AuthenticationFileValidationResult::AUTHENTICATION_FILE_INVALID_FILE_LENGTH);
+
+    // Fields end before the file length
+    data = serializeStatusFile(2);
+    data.push_back(0);
+    setFileLength(data, data.size());
+    ASSERT_EQ(validator.validate(data.data(), data.size(),
+                                 AuthenticationFileKind::AUTHENTICATION_FILE_KIND_LOAD_STATUS),
+              AuthenticationFileValidationResult::AUTHENTICATION_FILE_TRAILING_DATA);
+
+    ASSERT_EQ(validator.getNumberOfValidations(
+                  AuthenticationFileValidationResult::AUTHENTICATION_FILE_TRUNCATED),
+              3);
+    ASSERT_EQ(validator.getNumberOfValidations(
+                  AuthenticationFileValidationResult::AUTHENTICATION_FILE_INVALID_FILE_LENGTH),
+              1);
+    ASSERT_EQ(validator.getNumberOfValidations(
+                  AuthenticationFileValidationResult::AUTHENTICATION_FILE_TRAILING_DATA),
+              1);
+    ASSERT_EQ(validator.getNumberOfRejectedFiles(), 5);
+}
+
+TEST(AuthenticationFilesTest, FileValidatorProtocolVersion)
+{
+    AuthenticationFileValidator validator;
+    std::vector<uint8_t> data = serializeRequestFile(1);
+    data[4] = 'Z';
+    ASSERT_EQ(validator.validate(data.data(), data.size(),
+                                 AuthenticationFileKind::AUTHENTICATION_FILE_KIND_LOAD_REQUEST),
+              AuthenticationFileValidationResult::AUTHENTICATION_FILE_INVALID_PROTOCOL_VERSION);
+
+    AuthenticationFileValidator otherVersionValidator("A4");
+    data = serializeRequestFile(1);
+    ASSERT_EQ(otherVersionValidator.validate(
+                  data.data(), data.size(),
+                  AuthenticationFileKind::AUTHENTICATION_FILE_KIND_LOAD_REQUEST),
+              AuthenticationFileValidationResult::AUTHENTICATION_FILE_INVALID_PROTOCOL_VERSION);
+}
+
+TEST(AuthenticationFilesTest, FileValidatorNestedLengths)
+{
+    AuthenticationFileValidator validator;
+
+    // Authentication Status Description running past the file
+    std::vector<uint8_t> data = serializeStatusFile(0);
+    data[8] = 0xFF;
+    ASSERT_EQ(validator.validate(data.data(), data.size(),
+                                 AuthenticationFileKind::AUTHENTICATION_FILE_KIND_LOAD_STATUS),
+              AuthenticationFileValidationResult::AUTHENTICATION_FILE_INVALID_FIELD_LENGTH);
+
+    // Cryptographic key running past the file
+    data = serializeInitializationFile();
+    data[8] = 0xFF;
+    ASSERT_EQ(validator.validate(data.data(), data.size(),
+                                 AuthenticationFileKind::AUTHENTICATION_FILE_KIND_INITIALIZATION),
+              AuthenticationFileValidationResult::AUTHENTICATION_FILE_INVALID_FIELD_LENGTH);
+
+    // Name of the last header file running past the file
+    data = serializeRequestFile(2);
+    size_t lastHeaderFileOffset = data.size() - (1 + strlen("PN1") + 1) - (1 + strlen("HEADER_1.BIN") + 1);
+    data[lastHeaderFileOffset] = 0xFF;
+    ASSERT_EQ(validator.validate(data.data(), data.size(),
+                                 AuthenticationFileKind::AUTHENTICATION_FILE_KIND_LOAD_REQUEST),
+              AuthenticationFileValidationResult::AUTHENTICATION_FILE_INVALID_FIELD_LENGTH);
+
+    ASSERT_EQ(validator.getNumberOfValidations(
+                  AuthenticationFileValidationResult::AUTHENTICATION_FILE_INVALID_FIELD_LENGTH),
+              3);
+}
+
+TEST(AuthenticationFilesTest, FileValidatorHeaderCount)
+{
+    AuthenticationFileValidator validator;
+
+    // Far more header files than the file can hold
+    std::vector<uint8_t> data = serializeRequestFile(2);
+    data[6] = 0xFF;
+    data[7] = 0xFF;
+    ASSERT_EQ(validator.validate(data.data(), data.size(),
+                                 AuthenticationFileKind::AUTHENTICATION_FILE_KIND_LOAD_REQUEST),
+              AuthenticationFileValidationResult::AUTHENTICATION_FILE_INVALID_HEADER_COUNT);
+
+    // One header file more than sent
+    data = serializeRequestFile(2);
+    data[7] = 3;
+    ASSERT_EQ(validator.validate(data.data(), data.size(),
+                                 AuthenticationFileKind::AUTHENTICATION_FILE_KIND_LOAD_REQUEST),
+              AuthenticationFileValidationResult::AUTHENTICATION_FILE_INVALID_HEADER_COUNT);
+
+    // One header file less than sent
+    data = serializeRequestFile(2);
+    data[7] = 1;
+    ASSERT_EQ(validator.validate(data.data(), data.size(),
+                                 AuthenticationFileKind::AUTHENTICATION_FILE_KIND_LOAD_REQUEST),
+              AuthenticationFileValidationResult::AUTHENTICATION_FILE_TRAILING_DATA);
+
+    ASSERT_EQ(validator.getNumberOfValidations(
+                  AuthenticationFileValidationResult::AUTHENTICATION_FILE_INVALID_HEADER_COUNT),
+              2);
+}
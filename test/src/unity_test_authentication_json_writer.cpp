@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+
+#include "AuthenticationJsonWriter.h"
+#include <cjson/cJSON.h>
+
+static std::string printCJSON(cJSON *root)
+{
+    char *printed = cJSON_PrintUnformatted(root);
+    std::string json(printed);
+    free(printed);
+    cJSON_Delete(root);
+    return json;
+}
+
+TEST(AuthenticationFilesTest, JsonWriterStructure)
+{
+    std::string data;
+    AuthenticationJsonWriter writer(data);
+    writer.beginObject();
+    writer.addString("name", "TEST");
+    writer.beginArray("list");
+    writer.beginObject();
+    writer.addNumber("a", 1);
+    writer.endObject();
+    writer.beginObject();
+    writer.endObject();
+    writer.endArray();
+    writer.beginArray("empty");
+    writer.endArray();
+    writer.addNumber("last", 2);
+    writer.endObject();
+
+    ASSERT_EQ(data, "{\"name\":\"TEST\",\"list\":[{\"a\":1},{}],\"empty\":[],\"last\":2}");
+}
+
+TEST(AuthenticationFilesTest, JsonWriterStringsMatchCJSON)
+{
+    const char *strings[] = {
+        "", "TEST_FILE.TEST", "quote\" backslash\\ slash/",
+        "\b\f\n\r\t", "\x01\x1f control", "\xc3\xa7 utf-8"};
+
+    for (size_t i = 0; i < sizeof(strings) / sizeof(strings[0]); i++)
+    {
+        std::string data;
+        AuthenticationJsonWriter writer(data);
+        writer.beginObject();
+        writer.addString("value", strings[i]);
+        writer.endObject();
+
+        cJSON *root = cJSON_CreateObject();
+        cJSON_AddItemToObject(root, "value", cJSON_CreateString(strings[i]));
+        ASSERT_EQ(data, printCJSON(root));
+    }
+}
+
+TEST(AuthenticationFilesTest, JsonWriterNumbersMatchCJSON)
+{
+    const double numbers[] = {
+        0, 1, 255, 65535, 16777215, 2147483647.0, 4294967295.0,
+        -1, 0.5, 1.0 / 3.0, 1e300};
+
+    for (size_t i = 0; i < sizeof(numbers) / sizeof(numbers[0]); i++)
+    {
+        std::string data;
+        AuthenticationJsonWriter writer(data);
+        writer.beginArray();
+        writer.addNumber(nullptr, numbers[i]);
+        writer.endArray();
+
+        cJSON *root = cJSON_CreateArray();
+        cJSON_AddItemToArray(root, cJSON_CreateNumber(numbers[i]));
+        ASSERT_EQ(data, printCJSON(root));
+    }
+}
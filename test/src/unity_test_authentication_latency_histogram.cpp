@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+
+#include "AuthenticationLatencyHistogram.h"
+
+#include <thread>
+#include <vector>
+
+#define HISTOGRAM_TEST_THREADS 4
+#define HISTOGRAM_TEST_RECORDS_PER_THREAD 10000
+
+TEST(AuthenticationLatencyHistogramTest, LatencyHistogramBuckets)
+{
+    // Exact below the first power of two split in sub-buckets
+    for (uint64_t i = 0; i < LATENCY_HISTOGRAM_SUB_BUCKETS; i++)
+    {
+        ASSERT_EQ(AuthenticationLatencyHistogram::getBucket(i), i);
+        ASSERT_EQ(AuthenticationLatencyHistogram::getBucketUpperBound(i), i);
+    }
+
+    // Every latency falls in a bucket holding it, within 12.5% of its bound
+    const uint64_t latencies[] = {8, 9, 15, 16, 17, 100, 1000, 123456, 999999999,
+                                  (static_cast<uint64_t>(1) << LATENCY_HISTOGRAM_MAX_BITS) - 1};
+    for (uint64_t latency : latencies)
+    {
+        size_t bucket = AuthenticationLatencyHistogram::getBucket(latency);
+        ASSERT_LT(bucket, LATENCY_HISTOGRAM_BUCKETS);
+        uint64_t upperBound = AuthenticationLatencyHistogram::getBucketUpperBound(bucket);
+        ASSERT_GE(upperBound, latency);
+        ASSERT_LE(upperBound - latency, latency / LATENCY_HISTOGRAM_SUB_BUCKETS);
+        ASSERT_GT(latency, AuthenticationLatencyHistogram::getBucketUpperBound(bucket - 1));
+    }
+    ASSERT_EQ(AuthenticationLatencyHistogram::getBucket(UINT64_MAX), LATENCY_HISTOGRAM_BUCKETS - 1);
+}
+
+TEST(AuthenticationLatencyHistogramTest, LatencyHistogramPercentiles)
+{
+    AuthenticationLatencyHistogram histogram;
+    AuthenticationLatencySummary summary;
+    histogram.getSummary(summary);
+    ASSERT_EQ(summary.count, 0);
+    ASSERT_EQ(summary.p99.count(), 0);
+
+    // 1 to 1000 microseconds
+    for (int i = 1; i <= 1000; i++)
+    {
+        histogram.record(std::chrono::microseconds(i));
+    }
+    histogram.getSummary(summary);
+    ASSERT_EQ(summary.count, 1000);
+    ASSERT_EQ(summary.min, std::chrono::microseconds(1));
+    ASSERT_EQ(summary.max, std::chrono::microseconds(1000));
+    ASSERT_EQ(summary.mean, std::chrono::nanoseconds(500500));
+    ASSERT_GE(summary.p50, std::chrono::microseconds(500));
+    ASSERT_LE(summary.p50.count(), 500000 + 500000 / LATENCY_HISTOGRAM_SUB_BUCKETS);
+    ASSERT_GE(summary.p99, std::chrono::microseconds(990));
+    ASSERT_LE(summary.p99, summary.max);
+    ASSERT_EQ(histogram.getPercentile(100), summary.max);
+
+    histogram.reset();
+    ASSERT_EQ(histogram.getCount(), 0);
+    histogram.record(std::chrono::nanoseconds(-5));
+    histogram.getSummary(summary);
+    ASSERT_EQ(summary.max.count(), 0);
+}
+
+TEST(AuthenticationLatencyHistogramTest, LatencyHistogramConcurrentRecords)
+{
+    AuthenticationLatencyHistogram histogram;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < HISTOGRAM_TEST_THREADS; i++)
+    {
+        threads.push_back(std::thread([&histogram, i]
+                                      {
+            for (int j = 0; j < HISTOGRAM_TEST_RECORDS_PER_THREAD; j++)
+            {
+                histogram.record(std::chrono::microseconds(i + 1));
+            } }));
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    AuthenticationLatencySummary summary;
+    histogram.getSummary(summary);
+    ASSERT_EQ(summary.count, HISTOGRAM_TEST_THREADS * HISTOGRAM_TEST_RECORDS_PER_THREAD);
+    ASSERT_EQ(summary.min, std::chrono::microseconds(1));
+    ASSERT_EQ(summary.max, std::chrono::microseconds(HISTOGRAM_TEST_THREADS));
+}
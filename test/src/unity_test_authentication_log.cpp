@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+
+#include "AuthenticationLog.h"
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define LOG_TEST_THREADS 4
+#define LOG_TEST_RECORDS_PER_THREAD 100
+
+class AuthenticationLogTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        AuthenticationLog::getInstance().flush();
+        AuthenticationLog::getInstance().setSink(captureLine, this);
+        AuthenticationLog::getInstance().setLevel(AuthenticationLogLevel::AUTHENTICATION_LOG_INFO);
+    }
+
+    void TearDown() override
+    {
+        AuthenticationLog::getInstance().flush();
+        AuthenticationLog::getInstance().setSink(nullptr, nullptr);
+    }
+
+    static void captureLine(AuthenticationLogLevel level, const char *line, void *context)
+    {
+        AuthenticationLogTest *thiz = static_cast<AuthenticationLogTest *>(context);
+        std::lock_guard<std::mutex> lock(thiz->linesMutex);
+        thiz->levels.push_back(level);
+        thiz->lines.push_back(std::string(line));
+    }
+
+    std::mutex linesMutex;
+    std::vector<AuthenticationLogLevel> levels;
+    std::vector<std::string> lines;
+};
+
+TEST_F(AuthenticationLogTest, LogFormat)
+{
+    std::string name("TH0_POS");
+    std::string longName("/tmp/");
+    longName.append(2 * AUTHENTICATION_LOG_STRING_SIZE, 'd');
+    longName += "/TH0_POS.LUH";
+    AuthenticationLog::getInstance().log(AuthenticationLogLevel::AUTHENTICATION_LOG_WARNING,
+                                         "{} {} {} {} {}", name, -3, 42u, 0.5);
+    AuthenticationLog::getInstance().log(AuthenticationLogLevel::AUTHENTICATION_LOG_ERROR,
+                                         "{}", longName);
+    AuthenticationLog::getInstance().flush();
+
+    ASSERT_EQ(lines.size(), 2);
+    ASSERT_EQ(levels[0], AuthenticationLogLevel::AUTHENTICATION_LOG_WARNING);
+    ASSERT_NE(lines[0].find("[WARNING]"), std::string::npos);
+    // Missing arguments leave their {} as is
+    ASSERT_NE(lines[0].find("TH0_POS -3 42 0.5 {}"), std::string::npos);
+    // Long strings keep both ends
+    ASSERT_NE(lines[1].find("] /tmp/ddd"), std::string::npos);
+    ASSERT_NE(lines[1].find("dd" AUTHENTICATION_LOG_ELLIPSIS "dd"), std::string::npos);
+    ASSERT_EQ(lines[1].substr(lines[1].size() - 12), "/TH0_POS.LUH");
+    ASSERT_EQ(lines[1].size() - lines[1].find("] /tmp/") - 2, AUTHENTICATION_LOG_STRING_SIZE - 1);
+}
+
+TEST_F(AuthenticationLogTest, LogLevel)
+{
+    AuthenticationLog &log = AuthenticationLog::getInstance();
+    log.log(AuthenticationLogLevel::AUTHENTICATION_LOG_DEBUG, "debug");
+    log.log(AuthenticationLogLevel::AUTHENTICATION_LOG_INFO, "info");
+    log.setLevel(AuthenticationLogLevel::AUTHENTICATION_LOG_ERROR);
+    ASSERT_FALSE(log.isEnabled(AuthenticationLogLevel::AUTHENTICATION_LOG_WARNING));
+    log.log(AuthenticationLogLevel::AUTHENTICATION_LOG_WARNING, "warning");
+    log.log(AuthenticationLogLevel::AUTHENTICATION_LOG_ERROR, "error");
+
+    // Stripped at compile time below BLSEC_LOG_LEVEL
+    BLSEC_LOG_TRACE("trace");
+    log.flush();
+
+    ASSERT_EQ(lines.size(), 2);
+    ASSERT_NE(lines[0].find("info"), std::string::npos);
+    ASSERT_NE(lines[1].find("error"), std::string::npos);
+}
+
+TEST_F(AuthenticationLogTest, LogDrainedInBackground)
+{
+    // The drainer wakes up on its own, without a flush
+    BLSEC_LOG_WARNING("background {}", 1);
+    for (int i = 0; i < 1000; i++)
+    {
+        {
+            std::lock_guard<std::mutex> lock(linesMutex);
+            if (!lines.empty())
+            {
+                break;
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    std::lock_guard<std::mutex> lock(linesMutex);
+    ASSERT_EQ(lines.size(), 1);
+    ASSERT_NE(lines[0].find("background 1"), std::string::npos);
+}
+
+TEST_F(AuthenticationLogTest, LogThreads)
+{
+    // Each thread logs into its own ring, drained in the background
+    std::vector<std::thread> threads;
+    for (int i = 0; i < LOG_TEST_THREADS; i++)
+    {
+        threads.push_back(std::thread([i]
+                                      {
+            for (int j = 0; j < LOG_TEST_RECORDS_PER_THREAD; j++)
+            {
+                BLSEC_LOG_INFO("thread {} record {}", i, j);
+            } }));
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+    AuthenticationLog::getInstance().flush();
+
+    std::lock_guard<std::mutex> lock(linesMutex);
+    ASSERT_EQ(lines.size(), LOG_TEST_THREADS * LOG_TEST_RECORDS_PER_THREAD);
+    // In order within each thread
+    std::vector<int> nextRecord(LOG_TEST_THREADS, 0);
+    for (std::string &line : lines)
+    {
+        int thread = 0;
+        int record = 0;
+        ASSERT_EQ(sscanf(line.c_str() + line.find("thread"), "thread %d record %d", &thread, &record), 2);
+        ASSERT_EQ(record, nextRecord[thread]++);
+    }
+}
+
+TEST_F(AuthenticationLogTest, LogRingFull)
+{
+    // A full ring drops records instead of blocking the thread logging
+    uint64_t dropped = AuthenticationLog::getInstance().getNumberOfDroppedRecords();
+    std::thread thread([]
+                       {
+        for (int i = 0; i < 4 * AUTHENTICATION_LOG_RING_SIZE; i++)
+        {
+            AuthenticationLog::getInstance().log(AuthenticationLogLevel::AUTHENTICATION_LOG_INFO,
+                                                 "record {}", i);
+        } });
+    thread.join();
+    AuthenticationLog::getInstance().flush();
+
+    std::lock_guard<std::mutex> lock(linesMutex);
+    uint64_t newlyDropped = AuthenticationLog::getInstance().getNumberOfDroppedRecords() - dropped;
+    ASSERT_EQ(lines.size() + newlyDropped, 4 * AUTHENTICATION_LOG_RING_SIZE);
+    ASSERT_GE(lines.size(), AUTHENTICATION_LOG_RING_SIZE);
+}
@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include "AuthenticationMemoryFile.h"
+
+#define MEMORY_FILE_TEST_POOL_BUFFER_SIZE 64
+#define MEMORY_FILE_TEST_POOL_CAPACITY 2
+#define MEMORY_FILE_TEST_LARGE_SIZE (100 * 1024)
+
+static std::vector<uint8_t> makeContent(size_t size)
+{
+    std::vector<uint8_t> content(size);
+    for (size_t i = 0; i < size; i++)
+    {
+        content[i] = (uint8_t)(i * 7);
+    }
+    return content;
+}
+
+TEST(AuthenticationMemoryFileTest, MemoryFileGrows)
+{
+    std::shared_ptr<std::vector<uint8_t>> buffer = std::make_shared<std::vector<uint8_t>>();
+    AuthenticationMemoryFile memoryFile(buffer);
+    std::vector<uint8_t> content = makeContent(MEMORY_FILE_TEST_LARGE_SIZE);
+
+    FILE *fp = memoryFile.open("w");
+    ASSERT_NE(fp, nullptr);
+    // Starts small
+    ASSERT_LE(buffer->capacity(), DEFAULT_MEMORY_FILE_CAPACITY);
+    for (size_t offset = 0; offset < content.size(); offset += 512)
+    {
+        ASSERT_EQ(fwrite(content.data() + offset, 1, 512, fp), 512);
+    }
+    fclose(fp);
+
+    // The exact number of bytes written, in the caller's vector
+    ASSERT_EQ(memoryFile.getSize(), content.size());
+    ASSERT_EQ(buffer->size(), content.size());
+    ASSERT_EQ(*buffer, content);
+    ASSERT_EQ(memoryFile.getBuffer(), buffer);
+    ASSERT_FALSE(memoryFile.isOverflowed());
+
+    // Read it back
+    fp = memoryFile.open("r");
+    ASSERT_NE(fp, nullptr);
+    std::vector<uint8_t> readBack(content.size() + 1);
+    ASSERT_EQ(fread(readBack.data(), 1, readBack.size(), fp), content.size());
+    fclose(fp);
+    readBack.resize(content.size());
+    ASSERT_EQ(readBack, content);
+}
+
+TEST(AuthenticationMemoryFileTest, MemoryFileRewrite)
+{
+    AuthenticationMemoryFile memoryFile;
+    std::vector<uint8_t> content = makeContent(1000);
+
+    // A transfer restarted from the beginning ends where the new one ends
+    FILE *fp = memoryFile.open("w");
+    ASSERT_NE(fp, nullptr);
+    ASSERT_EQ(fwrite(content.data(), 1, content.size(), fp), content.size());
+    ASSERT_EQ(fseek(fp, 0, SEEK_SET), 0);
+    ASSERT_EQ(fwrite(content.data(), 1, 100, fp), 100);
+    fclose(fp);
+    ASSERT_EQ(memoryFile.getSize(), 100);
+    ASSERT_EQ(std::memcmp(memoryFile.getData(), content.data(), 100), 0);
+
+    // Opening for writing empties the file
+    fp = memoryFile.open("w");
+    ASSERT_NE(fp, nullptr);
+    fclose(fp);
+    ASSERT_EQ(memoryFile.getSize(), 0);
+}
+
+TEST(AuthenticationMemoryFileTest, MemoryFileMaximumSize)
+{
+    AuthenticationMemoryFile memoryFile(nullptr, 1024);
+    std::vector<uint8_t> content = makeContent(2048);
+
+    // Refused instead of truncated
+    FILE *fp = memoryFile.open("w");
+    ASSERT_NE(fp, nullptr);
+    fwrite(content.data(), 1, content.size(), fp);
+    fflush(fp);
+    ASSERT_NE(ferror(fp), 0);
+    fclose(fp);
+    ASSERT_TRUE(memoryFile.isOverflowed());
+    ASSERT_LE(memoryFile.getSize(), 1024);
+
+    ASSERT_EQ(memoryFile.open("a"), nullptr);
+}
+
+TEST(AuthenticationMemoryFileTest, MemoryFilePooled)
+{
+    AuthenticationBufferPool pool(MEMORY_FILE_TEST_POOL_BUFFER_SIZE,
+                                  MEMORY_FILE_TEST_POOL_CAPACITY,
+                                  MEMORY_FILE_TEST_POOL_CAPACITY);
+    std::vector<uint8_t> content = makeContent(MEMORY_FILE_TEST_POOL_BUFFER_SIZE * 4);
+    {
+        AuthenticationMemoryFile memoryFile(&pool);
+
+        // Small files stay in the pool buffer
+        FILE *fp = memoryFile.open("w");
+        ASSERT_NE(fp, nullptr);
+        ASSERT_EQ(fwrite(content.data(), 1, MEMORY_FILE_TEST_POOL_BUFFER_SIZE, fp),
+                  MEMORY_FILE_TEST_POOL_BUFFER_SIZE);
+        fclose(fp);
+        ASSERT_EQ(pool.getNumberOfBuffersInUse(), 1);
+        ASSERT_EQ(memoryFile.getSize(), MEMORY_FILE_TEST_POOL_BUFFER_SIZE);
+        ASSERT_EQ(std::memcmp(memoryFile.getData(), content.data(),
+                              MEMORY_FILE_TEST_POOL_BUFFER_SIZE),
+                  0);
+        ASSERT_EQ(memoryFile.getBuffer()->size(), MEMORY_FILE_TEST_POOL_BUFFER_SIZE);
+
+        // Larger ones leave it for memory of their own
+        fp = memoryFile.open("w");
+        ASSERT_NE(fp, nullptr);
+        ASSERT_EQ(fwrite(content.data(), 1, content.size(), fp), content.size());
+        fclose(fp);
+        ASSERT_EQ(pool.getNumberOfBuffersInUse(), 0);
+        ASSERT_EQ(memoryFile.getSize(), content.size());
+        ASSERT_EQ(std::memcmp(memoryFile.getData(), content.data(), content.size()), 0);
+
+        // And get back to the pool once emptied
+        fp = memoryFile.open("w");
+        ASSERT_NE(fp, nullptr);
+        ASSERT_EQ(fwrite(content.data(), 1, 10, fp), 10);
+        fclose(fp);
+        ASSERT_EQ(pool.getNumberOfBuffersInUse(), 1);
+    }
+    ASSERT_EQ(pool.getNumberOfBuffersInUse(), 0);
+}
@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "AuthenticationMpscQueue.h"
+
+#define MPSC_TEST_PRODUCERS 4
+#define MPSC_TEST_VALUES_PER_PRODUCER 10000
+
+struct MpscTestValue : public AuthenticationMpscLink<MpscTestValue>
+{
+    explicit MpscTestValue(int value) : value(value)
+    {
+    }
+
+    int value;
+};
+
+static std::vector<int> mpscTestValues(const std::vector<std::shared_ptr<MpscTestValue>> &values)
+{
+    std::vector<int> ints;
+    for (std::vector<std::shared_ptr<MpscTestValue>>::const_iterator it = values.begin();
+         it != values.end(); ++it)
+    {
+        ints.push_back((*it)->value);
+    }
+    return ints;
+}
+
+TEST(AuthenticationQueueTest, MpscQueuePushOrder)
+{
+    AuthenticationMpscQueue<MpscTestValue> queue;
+    std::vector<std::shared_ptr<MpscTestValue>> values;
+
+    ASSERT_TRUE(queue.empty());
+    ASSERT_EQ(queue.drain(values), 0);
+
+    // Only the first push finds the queue empty
+    ASSERT_TRUE(queue.push(std::make_shared<MpscTestValue>(1)));
+    ASSERT_FALSE(queue.push(std::make_shared<MpscTestValue>(2)));
+    ASSERT_FALSE(queue.push(std::make_shared<MpscTestValue>(3)));
+    ASSERT_FALSE(queue.empty());
+
+    ASSERT_EQ(queue.drain(values), 3);
+    ASSERT_EQ(mpscTestValues(values), std::vector<int>({1, 2, 3}));
+    ASSERT_TRUE(queue.empty());
+
+    // A drained element can be pushed again, and is kept alive while queued
+    std::weak_ptr<MpscTestValue> first = values[0];
+    ASSERT_TRUE(queue.push(values[0]));
+    values.clear();
+    ASSERT_FALSE(first.expired());
+    ASSERT_EQ(queue.drain(values), 1);
+    ASSERT_EQ(mpscTestValues(values), std::vector<int>({1}));
+    values.clear();
+    ASSERT_TRUE(first.expired());
+}
+
+TEST(AuthenticationQueueTest, MpscQueueConcurrentProducers)
+{
+    AuthenticationMpscQueue<MpscTestValue> queue;
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < MPSC_TEST_PRODUCERS; producer++)
+    {
+        producers.push_back(std::thread([&queue, producer]
+                                        {
+            for (int i = 0; i < MPSC_TEST_VALUES_PER_PRODUCER; i++)
+            {
+                queue.push(std::make_shared<MpscTestValue>(producer * MPSC_TEST_VALUES_PER_PRODUCER + i));
+            } }));
+    }
+
+    // Drain while the producers run, the values of each producer keep their order
+    std::vector<std::shared_ptr<MpscTestValue>> drained;
+    while (drained.size() < MPSC_TEST_PRODUCERS * MPSC_TEST_VALUES_PER_PRODUCER)
+    {
+        queue.drain(drained);
+    }
+    for (std::vector<std::thread>::iterator it = producers.begin(); it != producers.end(); ++it)
+    {
+        it->join();
+    }
+    ASSERT_TRUE(queue.empty());
+
+    std::vector<int> values = mpscTestValues(drained);
+    std::vector<int> lastValue(MPSC_TEST_PRODUCERS, -1);
+    for (std::vector<int>::iterator it = values.begin(); it != values.end(); ++it)
+    {
+        int producer = *it / MPSC_TEST_VALUES_PER_PRODUCER;
+        ASSERT_GT(*it, lastValue[producer]);
+        lastValue[producer] = *it;
+    }
+}
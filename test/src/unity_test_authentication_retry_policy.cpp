@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+
+#include "AuthenticationRetryPolicy.h"
+
+#define RETRY_TEST_MAX_TRIES 4
+#define RETRY_TEST_INITIAL_BACKOFF_MS 100
+#define RETRY_TEST_MAX_BACKOFF_MS 300
+#define RETRY_TEST_DEADLINE_MS 5000
+
+TEST(AuthenticationRetryPolicyTest, RetryPolicyBackoff)
+{
+    AuthenticationRetryPolicy policy(RETRY_TEST_MAX_TRIES,
+                                     std::chrono::milliseconds(RETRY_TEST_INITIAL_BACKOFF_MS),
+                                     std::chrono::milliseconds(RETRY_TEST_MAX_BACKOFF_MS),
+                                     0.0,
+                                     std::chrono::milliseconds(RETRY_TEST_DEADLINE_MS));
+    std::chrono::milliseconds delay;
+
+    // Doubled on each failed try, up to the maximum
+    ASSERT_TRUE(policy.nextTry(1, 0, std::chrono::milliseconds(0), delay));
+    ASSERT_EQ(delay.count(), 100);
+    ASSERT_TRUE(policy.nextTry(2, 0, std::chrono::milliseconds(0), delay));
+    ASSERT_EQ(delay.count(), 200);
+    ASSERT_TRUE(policy.nextTry(3, 0, std::chrono::milliseconds(0), delay));
+    ASSERT_EQ(delay.count(), 300);
+
+    // Up to the number of tries
+    ASSERT_FALSE(policy.nextTry(RETRY_TEST_MAX_TRIES, 0, std::chrono::milliseconds(0), delay));
+}
+
+TEST(AuthenticationRetryPolicyTest, RetryPolicyJitter)
+{
+    AuthenticationRetryPolicy policy(RETRY_TEST_MAX_TRIES,
+                                     std::chrono::milliseconds(RETRY_TEST_INITIAL_BACKOFF_MS),
+                                     std::chrono::milliseconds(RETRY_TEST_MAX_BACKOFF_MS),
+                                     0.5,
+                                     std::chrono::milliseconds(RETRY_TEST_DEADLINE_MS));
+    std::chrono::milliseconds delay;
+
+    // Never longer than the backoff, never shorter than its fixed part
+    bool spread = false;
+    std::chrono::milliseconds firstDelay(-1);
+    for (int i = 0; i < 100; i++)
+    {
+        ASSERT_TRUE(policy.nextTry(1, 0, std::chrono::milliseconds(0), delay));
+        ASSERT_LE(delay.count(), RETRY_TEST_INITIAL_BACKOFF_MS);
+        ASSERT_GE(delay.count(), RETRY_TEST_INITIAL_BACKOFF_MS / 2);
+        if (firstDelay.count() < 0)
+        {
+            firstDelay = delay;
+        }
+        spread = spread || (delay != firstDelay);
+    }
+    ASSERT_TRUE(spread);
+}
+
+TEST(AuthenticationRetryPolicyTest, RetryPolicyWaitAndDeadline)
+{
+    AuthenticationRetryPolicy policy(RETRY_TEST_MAX_TRIES,
+                                     std::chrono::milliseconds(RETRY_TEST_INITIAL_BACKOFF_MS),
+                                     std::chrono::milliseconds(RETRY_TEST_MAX_BACKOFF_MS),
+                                     0.0,
+                                     std::chrono::milliseconds(RETRY_TEST_DEADLINE_MS));
+    std::chrono::milliseconds delay;
+
+    // The time asked by the target hardware, whatever the failed tries
+    ASSERT_TRUE(policy.nextTry(RETRY_TEST_MAX_TRIES, 2, std::chrono::milliseconds(0), delay));
+    ASSERT_EQ(delay.count(), 2000);
+
+    // Nothing past the deadline
+    ASSERT_FALSE(policy.nextTry(0, 2, std::chrono::milliseconds(RETRY_TEST_DEADLINE_MS - 1000),
+                                delay));
+    ASSERT_FALSE(policy.nextTry(1, 0, std::chrono::milliseconds(RETRY_TEST_DEADLINE_MS), delay));
+}
+
+TEST(AuthenticationRetryPolicyTest, RetryPolicyStatusTimeout)
+{
+    AuthenticationRetryPolicy policy;
+
+    ASSERT_EQ(policy.statusTimeout(0, 0),
+              std::chrono::milliseconds(std::chrono::seconds(DEFAULT_AUTHENTICATION_DLP_TIMEOUT)));
+    ASSERT_EQ(policy.statusTimeout(0, 600),
+              std::chrono::milliseconds(std::chrono::seconds(DEFAULT_AUTHENTICATION_DLP_TIMEOUT)));
+
+    // The Exception Timer overrides it, both ways
+    ASSERT_EQ(policy.statusTimeout(60, 0), std::chrono::milliseconds(60000));
+    ASSERT_EQ(policy.statusTimeout(2, 0), std::chrono::milliseconds(2000));
+}
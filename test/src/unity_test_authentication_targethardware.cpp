@@ -476,7 +476,49 @@ TEST_F(AuthenticationTargetHardwareTest, AuthenticationTargetHardwareLoadAuthent
               AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
 
     ASSERT_NE(fp, nullptr);
-    ASSERT_EQ(bufferSize, MAX_CERTIFICATE_BUFFER_SIZE);
+    ASSERT_EQ(bufferSize, MAX_MEMORY_FILE_SIZE);
+    fclose(fp);
+}
+
+TEST_F(AuthenticationTargetHardwareTest, AuthenticationTargetHardwareLoadAuthenticationRequestLarge)
+{
+    // Start data loader server for status thread
+    startDataLoaderServer();
+
+    FILE *fp = NULL;
+    size_t bufferSize = 0;
+
+    EXPECT_EQ(authenticationTargetHardware->loadAuthenticationInitialization(
+                  &fp, &bufferSize, initializationAuthenticationFileName),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    ASSERT_NE(fp, nullptr);
+    fclose(fp);
+    fp = NULL;
+
+    // A load list far larger than the former fixed buffer
+    LoadAuthenticationRequestFile largeRequestFile(loadAuthenticationRequestFileName);
+    for (int i = 0; i < 400; i++)
+    {
+        LoadAuthenticationRequestHeaderFile headerFile;
+        headerFile.setHeaderFileName("certificate/pescert.crt");
+        headerFile.setLoadPartNumberName("00000000");
+        largeRequestFile.addHeaderFile(headerFile);
+    }
+    std::shared_ptr<std::vector<uint8_t>> fileBuffer = std::make_shared<std::vector<uint8_t>>();
+    largeRequestFile.serialize(fileBuffer);
+    ASSERT_GT(fileBuffer->size(), MAX_CERTIFICATE_BUFFER_SIZE);
+
+    EXPECT_EQ(authenticationTargetHardware->loadAuthenticationRequest(
+                  &fp, &bufferSize, initializationAuthenticationFileName),
+              AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
+    ASSERT_NE(fp, nullptr);
+    ASSERT_EQ(fwrite(fileBuffer->data(), 1, fileBuffer->size(), fp), fileBuffer->size());
+    fclose(fp);
+
+    // Received whole, so it passes the framing validation
+    ASSERT_EQ(authenticationTargetHardware->notify(
+                  NotifierAuthenticationEventType::NOTIFIER_AUTHENTICATION_EVENT_TFTP_SECTION_CLOSED),
+              NotifierAuthenticationOperationResult::NOTIFIER_OK);
 }
 
 /*
@@ -510,7 +552,7 @@ TEST_F(AuthenticationTargetHardwareTest, DISABLED_AuthenticationTargetHardwareLo
               AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
 
     EXPECT_NE(fp, nullptr);
-    EXPECT_EQ(bufferSize, MAX_CERTIFICATE_BUFFER_SIZE);
+    EXPECT_EQ(bufferSize, MAX_MEMORY_FILE_SIZE);
 
     // Serialize load list file to buffer
     std::shared_ptr<std::vector<uint8_t>> fileBuffer;
@@ -519,7 +561,7 @@ TEST_F(AuthenticationTargetHardwareTest, DISABLED_AuthenticationTargetHardwareLo
     loadAuthenticationRequestFile->serialize(fileBuffer);
 
     // Write to file pointer
-    EXPECT_EQ(fwrite(fileBuffer->data(), 1, bufferSize, fp), bufferSize);
+    EXPECT_EQ(fwrite(fileBuffer->data(), 1, fileBuffer->size(), fp), fileBuffer->size());
     fclose(fp);
 
     // Notify target hardware that load list was received
@@ -568,7 +610,7 @@ TEST_F(AuthenticationTargetHardwareTest, DISABLED_AuthenticationTargetHardwareAu
               AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
 
     EXPECT_NE(fp, nullptr);
-    EXPECT_EQ(bufferSize, MAX_CERTIFICATE_BUFFER_SIZE);
+    EXPECT_EQ(bufferSize, MAX_MEMORY_FILE_SIZE);
 
     // Serialize load list file to buffer
     std::shared_ptr<std::vector<uint8_t>> fileBuffer;
@@ -577,7 +619,7 @@ TEST_F(AuthenticationTargetHardwareTest, DISABLED_AuthenticationTargetHardwareAu
     loadAuthenticationRequestFile->serialize(fileBuffer);
 
     // Write to file pointer
-    EXPECT_EQ(fwrite(fileBuffer->data(), 1, bufferSize, fp), bufferSize);
+    EXPECT_EQ(fwrite(fileBuffer->data(), 1, fileBuffer->size(), fp), fileBuffer->size());
     fclose(fp);
 
     // Notify target hardware that load list was received
@@ -686,7 +728,7 @@ TEST_F(AuthenticationTargetHardwareTest, DISABLED_AuthenticationTargetHardwareAu
               AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
 
     EXPECT_NE(fp, nullptr);
-    EXPECT_EQ(bufferSize, MAX_CERTIFICATE_BUFFER_SIZE);
+    EXPECT_EQ(bufferSize, MAX_MEMORY_FILE_SIZE);
 
     // Serialize load list file to buffer
     std::shared_ptr<std::vector<uint8_t>> fileBuffer;
@@ -695,7 +737,7 @@ TEST_F(AuthenticationTargetHardwareTest, DISABLED_AuthenticationTargetHardwareAu
     loadAuthenticationRequestFile->serialize(fileBuffer);
 
     // Write to file pointer
-    EXPECT_EQ(fwrite(fileBuffer->data(), 1, bufferSize, fp), bufferSize);
+    EXPECT_EQ(fwrite(fileBuffer->data(), 1, fileBuffer->size(), fp), fileBuffer->size());
     fclose(fp);
 
     // Notify target hardware that load list was received
@@ -755,7 +797,7 @@ TEST_F(AuthenticationTargetHardwareTest, DISABLED_AuthenticationTargetHardwareAu
               AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
 
     EXPECT_NE(fp, nullptr);
-    EXPECT_EQ(bufferSize, MAX_CERTIFICATE_BUFFER_SIZE);
+    EXPECT_EQ(bufferSize, MAX_MEMORY_FILE_SIZE);
 
     // Serialize load list file to buffer
     std::shared_ptr<std::vector<uint8_t>> fileBuffer;
@@ -764,7 +806,7 @@ TEST_F(AuthenticationTargetHardwareTest, DISABLED_AuthenticationTargetHardwareAu
     loadAuthenticationRequestFile->serialize(fileBuffer);
 
     // Write to file pointer
-    EXPECT_EQ(fwrite(fileBuffer->data(), 1, bufferSize, fp), bufferSize);
+    EXPECT_EQ(fwrite(fileBuffer->data(), 1, fileBuffer->size(), fp), fileBuffer->size());
     fclose(fp);
 
     // Notify target hardware that load list was received
@@ -811,7 +853,7 @@ TEST_F(AuthenticationTargetHardwareTest, DISABLED_AuthenticationTargetHardwareAu
               AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
 
     EXPECT_NE(fp, nullptr);
-    EXPECT_EQ(bufferSize, MAX_CERTIFICATE_BUFFER_SIZE);
+    EXPECT_EQ(bufferSize, MAX_MEMORY_FILE_SIZE);
 
     // Serialize load list file to buffer
     std::shared_ptr<std::vector<uint8_t>> fileBuffer;
@@ -820,7 +862,7 @@ TEST_F(AuthenticationTargetHardwareTest, DISABLED_AuthenticationTargetHardwareAu
     loadAuthenticationRequestFile->serialize(fileBuffer);
 
     // Write to file pointer
-    EXPECT_EQ(fwrite(fileBuffer->data(), 1, bufferSize, fp), bufferSize);
+    EXPECT_EQ(fwrite(fileBuffer->data(), 1, fileBuffer->size(), fp), fileBuffer->size());
     fclose(fp);
 
     // Notify target hardware that load list was received
@@ -865,7 +907,7 @@ TEST_F(AuthenticationTargetHardwareTest, DISABLED_AuthenticationTargetHardwareAu
               AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
 
     EXPECT_NE(fp, nullptr);
-    EXPECT_EQ(bufferSize, MAX_CERTIFICATE_BUFFER_SIZE);
+    EXPECT_EQ(bufferSize, MAX_MEMORY_FILE_SIZE);
 
     // Add inexistent file so the authentication fails
     for (int i = NUM_LOADS; i <= 2 * NUM_LOADS; ++i)
@@ -883,7 +925,7 @@ TEST_F(AuthenticationTargetHardwareTest, DISABLED_AuthenticationTargetHardwareAu
     loadAuthenticationRequestFile->serialize(fileBuffer);
 
     // Write to file pointer
-    EXPECT_EQ(fwrite(fileBuffer->data(), 1, bufferSize, fp), bufferSize);
+    EXPECT_EQ(fwrite(fileBuffer->data(), 1, fileBuffer->size(), fp), fileBuffer->size());
     fclose(fp);
 
     // Notify target hardware that load list was received
@@ -940,7 +982,7 @@ TEST_F(AuthenticationTargetHardwareTest, DISABLED_AuthenticationTargetHardwareFi
               AuthenticationOperationResult::AUTHENTICATION_OPERATION_OK);
 
     EXPECT_NE(fp, nullptr);
-    EXPECT_EQ(bufferSize, MAX_CERTIFICATE_BUFFER_SIZE);
+    EXPECT_EQ(bufferSize, MAX_MEMORY_FILE_SIZE);
 
     // Serialize load list file to buffer
     std::shared_ptr<std::vector<uint8_t>> fileBuffer;
@@ -949,7 +991,7 @@ TEST_F(AuthenticationTargetHardwareTest, DISABLED_AuthenticationTargetHardwareFi
     loadAuthenticationRequestFile->serialize(fileBuffer);
 
     // Write to file pointer
-    EXPECT_EQ(fwrite(fileBuffer->data(), 1, bufferSize, fp), bufferSize);
+    EXPECT_EQ(fwrite(fileBuffer->data(), 1, fileBuffer->size(), fp), fileBuffer->size());
     fclose(fp);
 
     // Notify target hardware that load list was received
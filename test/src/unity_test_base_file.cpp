@@ -51,6 +51,23 @@ TEST(AuthenticationFilesTest, BaseFileSerializeJSON)
                     "}");
 }
 
+TEST(AuthenticationFilesTest, BaseFileSerializeJSONForgedLength)
+{
+    BaseAuthenticationFile baseFile;
+    std::shared_ptr<std::vector<uint8_t>> data = std::make_shared<std::vector<uint8_t>>();
+    data->push_back(0xFF);
+    data->push_back(0xFF);
+    data->push_back(0xFF);
+    data->push_back(0xFF);
+    data->push_back('A');
+    data->push_back('4');
+    ASSERT_EQ(baseFile.deserialize(data), SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK);
+
+    std::string json("");
+    ASSERT_EQ(baseFile.serializeJSON(json), SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK);
+    ASSERT_LT(json.capacity(), 1024);
+}
+
 TEST(AuthenticationFilesTest, BaseFileDeserializeJSON)
 {
     BaseAuthenticationFile baseFile;
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <cstring>
+
 #include "InitializationAuthenticationFile.h"
 
 TEST(AuthenticationFilesTest, InitializationFileSerialization)
@@ -60,6 +62,39 @@ TEST(AuthenticationFilesTest, InitializationFileSerialization)
     ASSERT_EQ(data->at(36), '\0');
 }
 
+TEST(AuthenticationFilesTest, InitializationFileSerializeInto)
+{
+    InitializationAuthenticationFile initializationFile("TEST_FILE.TEST", "A4");
+    initializationFile.setOperationAcceptanceStatusCode(0x0001);
+    initializationFile.setStatusDescription("Test file");
+    std::vector<uint8_t> cryptographicKey = {
+        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+        0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10};
+    initializationFile.setCryptographicKey(cryptographicKey);
+
+    std::shared_ptr<std::vector<uint8_t>>
+        data = std::make_shared<std::vector<uint8_t>>();
+    ASSERT_EQ(initializationFile.serialize(data), SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK);
+
+    size_t fileSize = 0;
+    initializationFile.getFileSize(fileSize);
+    ASSERT_EQ(fileSize, 37);
+
+    uint8_t buffer[64];
+    size_t written = 0;
+    ASSERT_EQ(initializationFile.serializeInto(buffer, sizeof(buffer), written),
+              SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK);
+    ASSERT_EQ(written, data->size());
+    ASSERT_EQ(std::memcmp(buffer, data->data(), written), 0);
+
+    // Every buffer smaller than the file must be rejected
+    for (size_t capacity = 0; capacity < fileSize; capacity++)
+    {
+        ASSERT_EQ(initializationFile.serializeInto(buffer, capacity, written),
+                  SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR);
+    }
+}
+
 // TODO: Add public key field
 TEST(AuthenticationFilesTest, DISABLED_InitializationFileSerializationDescriptionOverflow)
 {
@@ -280,4 +315,40 @@ TEST(AuthenticationFilesTest, InitializationFileFileName)
     std::string fileName = "";
     ASSERT_EQ(baseFile.getFileName(fileName), FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK);
     ASSERT_EQ(fileName, "TEST_FILE.TEST");
-}
\ No newline at end of file
+}
+
+TEST(AuthenticationFilesTest, InitializationFileCryptographicKeyMove)
+{
+    InitializationAuthenticationFile initializationFile("TEST_FILE.TEST", "A4");
+    std::vector<uint8_t> cryptographicKey(MAX_CRYPTOGRAPHIC_KEY_SIZE, 0x5A);
+    const uint8_t *keyData = cryptographicKey.data();
+
+    // The key is held out of the object, so the file is cheap to put on a stack
+    EXPECT_LT(sizeof(InitializationAuthenticationFile), MAX_STATUS_DESCRIPTION_SIZE);
+
+    ASSERT_EQ(initializationFile.setCryptographicKey(std::move(cryptographicKey)), FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK);
+    ASSERT_TRUE(cryptographicKey.empty());
+
+    AuthenticationFieldView cryptographicKeyView;
+    ASSERT_EQ(initializationFile.getCryptographicKey(cryptographicKeyView), FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(cryptographicKeyView.data(), keyData);
+    ASSERT_EQ(cryptographicKeyView.size(), MAX_CRYPTOGRAPHIC_KEY_SIZE);
+
+    size_t fileSize = 0;
+    initializationFile.getFileSize(fileSize);
+    ASSERT_EQ(fileSize, 11 + MAX_CRYPTOGRAPHIC_KEY_SIZE);
+
+    std::vector<uint8_t> releasedKey;
+    ASSERT_EQ(initializationFile.releaseCryptographicKey(releasedKey), FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(releasedKey.data(), keyData);
+    ASSERT_EQ(releasedKey.size(), MAX_CRYPTOGRAPHIC_KEY_SIZE);
+
+    uint16_t cryptographicKeyLength = 0;
+    initializationFile.getCryptographicKeyLength(cryptographicKeyLength);
+    ASSERT_EQ(cryptographicKeyLength, 0);
+    initializationFile.getFileSize(fileSize);
+    ASSERT_EQ(fileSize, 11);
+
+    std::vector<uint8_t> oversizedKey(MAX_CRYPTOGRAPHIC_KEY_SIZE + 1, 0);
+    ASSERT_EQ(initializationFile.setCryptographicKey(std::move(oversizedKey)), FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_ERROR);
+}
@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+
+#include "LoadAuthenticationRequestView.h"
+
+TEST(AuthenticationFilesTest, LoadAuthenticationRequestViewParse)
+{
+    LoadAuthenticationRequestFile loadAuthenticationRequestFile("TEST_FILE.TEST", "A4");
+    for (int i = 0; i < 3; i++)
+    {
+        LoadAuthenticationRequestHeaderFile headerFile;
+        headerFile.setHeaderFileName("TEST_FILE" + std::to_string(i) + ".TEST");
+        headerFile.setLoadPartNumberName("TEST_PART_NUMBER" + std::to_string(i));
+        loadAuthenticationRequestFile.addHeaderFile(headerFile);
+    }
+
+    std::shared_ptr<std::vector<uint8_t>> data = std::make_shared<std::vector<uint8_t>>();
+    ASSERT_EQ(loadAuthenticationRequestFile.serialize(data),
+              SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK);
+    size_t fileSize = data->size();
+
+    // Trailing bytes after the file length are not part of the file
+    data->resize(fileSize + 100, 0);
+
+    LoadAuthenticationRequestView loadAuthenticationRequestView;
+    ASSERT_EQ(loadAuthenticationRequestView.parse(data->data(), data->size()),
+              SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK);
+
+    uint32_t fileLength = 0;
+    loadAuthenticationRequestView.getFileLength(fileLength);
+    ASSERT_EQ(fileLength, fileSize);
+
+    uint16_t numberOfHeaderFiles = 0;
+    loadAuthenticationRequestView.getNumberOfHeaderFiles(numberOfHeaderFiles);
+    ASSERT_EQ(numberOfHeaderFiles, 3);
+
+    int i = 0;
+    for (LoadAuthenticationRequestView::HeaderFileIterator it = loadAuthenticationRequestView.begin();
+         it != loadAuthenticationRequestView.end(); ++it)
+    {
+        AuthenticationFieldView headerFileName;
+        AuthenticationFieldView loadPartNumberName;
+        it->getHeaderFileName(headerFileName);
+        it->getLoadPartNumberName(loadPartNumberName);
+        ASSERT_EQ(headerFileName.toString(), "TEST_FILE" + std::to_string(i) + ".TEST");
+        ASSERT_EQ(loadPartNumberName.toString(), "TEST_PART_NUMBER" + std::to_string(i));
+        i++;
+    }
+    ASSERT_EQ(i, 3);
+
+    // Every truncated buffer must be rejected
+    for (size_t size = 0; size < fileSize; size++)
+    {
+        ASSERT_EQ(loadAuthenticationRequestView.parse(data->data(), size),
+                  SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR);
+    }
+}
@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+
+#include "LoadAuthenticationStatusEncoder.h"
+
+static std::shared_ptr<std::vector<LoadAuthenticationStatusHeaderFile>> buildHeaderFiles(
+    size_t numberOfHeaderFiles)
+{
+    std::shared_ptr<std::vector<LoadAuthenticationStatusHeaderFile>> headerFiles =
+        std::make_shared<std::vector<LoadAuthenticationStatusHeaderFile>>(numberOfHeaderFiles);
+    for (size_t i = 0; i < numberOfHeaderFiles; i++)
+    {
+        headerFiles->at(i).setHeaderFileName("TEST_FILE" + std::to_string(i) + ".TEST");
+        headerFiles->at(i).setLoadPartNumberName("TEST_PART_NUMBER" + std::to_string(i));
+        headerFiles->at(i).setLoadRatio(0);
+        headerFiles->at(i).setLoadStatus(0x0001);
+        headerFiles->at(i).setLoadStatusDescription("WAITING");
+    }
+    return headerFiles;
+}
+
+// Serialize the same content with LoadAuthenticationStatusFile
+static std::vector<uint8_t> serializeStatusFile(
+    std::shared_ptr<std::vector<LoadAuthenticationStatusHeaderFile>> &headerFiles,
+    uint16_t statusCode, std::string *description, uint16_t counter,
+    uint16_t exceptionTimer, uint16_t estimatedTime, uint32_t loadListRatio)
+{
+    LoadAuthenticationStatusFile loadAuthenticationStatusFile("TEST_FILE.TEST", "A4");
+    loadAuthenticationStatusFile.setAuthenticationOperationStatusCode(statusCode);
+    if (description != nullptr)
+    {
+        loadAuthenticationStatusFile.setAuthenticationStatusDescription(*description);
+    }
+    loadAuthenticationStatusFile.setCounter(counter);
+    loadAuthenticationStatusFile.setExceptionTimer(exceptionTimer);
+    loadAuthenticationStatusFile.setEstimatedTime(estimatedTime);
+    loadAuthenticationStatusFile.setLoadListRatio(loadListRatio);
+    for (std::vector<LoadAuthenticationStatusHeaderFile>::iterator it = headerFiles->begin();
+         it != headerFiles->end(); ++it)
+    {
+        loadAuthenticationStatusFile.addHeaderFile(*it);
+    }
+
+    std::shared_ptr<std::vector<uint8_t>> data = std::make_shared<std::vector<uint8_t>>();
+    EXPECT_EQ(loadAuthenticationStatusFile.serialize(data),
+              SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK);
+    return *data;
+}
+
+static std::vector<uint8_t> encode(LoadAuthenticationStatusEncoder &encoder)
+{
+    uint8_t *data = nullptr;
+    size_t size = 0;
+    EXPECT_EQ(encoder.encode(data, size),
+              SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK);
+    return std::vector<uint8_t>(data, data + size);
+}
+
+TEST(AuthenticationFilesTest, LoadAuthenticationStatusEncoderMatchesFile)
+{
+    std::shared_ptr<std::vector<LoadAuthenticationStatusHeaderFile>> headerFiles =
+        buildHeaderFiles(3);
+    LoadAuthenticationStatusEncoder encoder("A4");
+    ASSERT_EQ(encoder.setHeaderFiles(headerFiles),
+              FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(encoder.setAuthenticationOperationStatusCode(0x0002),
+              FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(encoder.setCounter(1),
+              FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK);
+
+    ASSERT_EQ(encode(encoder), serializeStatusFile(headerFiles, 0x0002, nullptr, 1, 0, 0, 0));
+    ASSERT_EQ(encoder.getNumberOfFullEncodes(), 1);
+}
+
+TEST(AuthenticationFilesTest, LoadAuthenticationStatusEncoderPatchFixedWidthFields)
+{
+    std::shared_ptr<std::vector<LoadAuthenticationStatusHeaderFile>> headerFiles =
+        buildHeaderFiles(3);
+    LoadAuthenticationStatusEncoder encoder("A4");
+    encoder.setHeaderFiles(headerFiles);
+    std::string description = "STATUS";
+    encoder.setAuthenticationStatusDescription(description);
+    encode(encoder);
+
+    ASSERT_EQ(encoder.setAuthenticationOperationStatusCode(0x0004),
+              FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(encoder.setCounter(0x1234),
+              FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(encoder.setExceptionTimer(0x5678),
+              FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(encoder.setEstimatedTime(0xFFFF),
+              FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(encoder.setLoadListRatio(33),
+              FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(encoder.setHeaderFileLoadStatus(1, 0x0003),
+              FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(encoder.setHeaderFileLoadRatio(1, 100),
+              FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(encoder.setHeaderFileLoadStatusDescription(2, "FAILED!"),
+              FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(encoder.setAuthenticationStatusDescription("UPDATE"),
+              FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK);
+    description = "UPDATE";
+
+    ASSERT_EQ(encode(encoder),
+              serializeStatusFile(headerFiles, 0x0004, &description, 0x1234, 0x5678, 0xFFFF, 33));
+    // Every change kept the size of the file, so nothing was encoded again
+    ASSERT_EQ(encoder.getNumberOfFullEncodes(), 1);
+
+    std::string headerFileDescription;
+    headerFiles->at(2).getLoadStatusDescription(headerFileDescription);
+    ASSERT_EQ(headerFileDescription, "FAILED!");
+}
+
+TEST(AuthenticationFilesTest, LoadAuthenticationStatusEncoderDescriptionLengthChange)
+{
+    std::shared_ptr<std::vector<LoadAuthenticationStatusHeaderFile>> headerFiles =
+        buildHeaderFiles(3);
+    LoadAuthenticationStatusEncoder encoder("A4");
+    encoder.setHeaderFiles(headerFiles);
+    encode(encoder);
+
+    ASSERT_EQ(encoder.setHeaderFileLoadStatusDescription(0, "Checking received file..."),
+              FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(encoder.setHeaderFileLoadRatio(2, 50),
+              FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(encode(encoder), serializeStatusFile(headerFiles, 0, nullptr, 0, 0, 0, 0));
+    ASSERT_EQ(encoder.getNumberOfFullEncodes(), 2);
+
+    // Header files after the changed one moved, their offsets must follow
+    ASSERT_EQ(encoder.setHeaderFileLoadStatus(2, 0x1007),
+              FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK);
+    std::string description = "ABORTED";
+    encoder.setAuthenticationStatusDescription(description);
+    encoder.setCounter(2);
+    ASSERT_EQ(encode(encoder), serializeStatusFile(headerFiles, 0, &description, 2, 0, 0, 0));
+    ASSERT_EQ(encoder.getNumberOfFullEncodes(), 3);
+
+    ASSERT_EQ(encoder.clearAuthenticationStatusDescription(),
+              FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(encode(encoder), serializeStatusFile(headerFiles, 0, nullptr, 2, 0, 0, 0));
+}
+
+TEST(AuthenticationFilesTest, LoadAuthenticationStatusEncoderInvalidHeaderFile)
+{
+    std::shared_ptr<std::vector<LoadAuthenticationStatusHeaderFile>> headerFiles =
+        buildHeaderFiles(1);
+    LoadAuthenticationStatusEncoder encoder("A4");
+    encoder.setHeaderFiles(headerFiles);
+
+    ASSERT_EQ(encoder.setHeaderFileLoadRatio(1, 0),
+              FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_ERROR);
+    ASSERT_EQ(encoder.setHeaderFileLoadStatus(1, 0),
+              FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_ERROR);
+    ASSERT_EQ(encoder.setHeaderFileLoadStatusDescription(1, ""),
+              FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_ERROR);
+
+    std::shared_ptr<std::vector<LoadAuthenticationStatusHeaderFile>> noHeaderFiles;
+    ASSERT_EQ(encoder.setHeaderFiles(noHeaderFiles),
+              FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_ERROR);
+}
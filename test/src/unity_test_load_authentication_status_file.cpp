@@ -265,6 +265,59 @@ TEST(AuthenticationFilesTest, LoadAuthenticationStatusFileSerialization)
     }
 }
 
+TEST(AuthenticationFilesTest, LoadAuthenticationStatusFileSerializeInto)
+{
+    LoadAuthenticationStatusFile loadAuthenticationStatusFile("TEST_FILE.TEST", "A4");
+    loadAuthenticationStatusFile.setAuthenticationOperationStatusCode(0x4141);
+    loadAuthenticationStatusFile.setAuthenticationStatusDescription("TEST_STATUS_DESCRIPTION");
+    loadAuthenticationStatusFile.setCounter(72);
+    loadAuthenticationStatusFile.setExceptionTimer(73);
+    loadAuthenticationStatusFile.setEstimatedTime(74);
+    loadAuthenticationStatusFile.setLoadListRatio(75);
+
+    for (int i = 0; i < 3; i++)
+    {
+        LoadAuthenticationStatusHeaderFile headerFile;
+        ASSERT_EQ(headerFile.setHeaderFileName("TEST_FILE" + std::to_string(i) + ".TEST"),
+            FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK);
+        ASSERT_EQ(headerFile.setLoadPartNumberName("TEST_PART_NUMBER" + std::to_string(i)),
+            FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK);
+        ASSERT_EQ(headerFile.setLoadRatio(42 + i),
+            FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK);
+        ASSERT_EQ(headerFile.setLoadStatus(0x4242 + i),
+            FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK);
+        ASSERT_EQ(headerFile.setLoadStatusDescription("TEST_STATUS_DESCRIPTION" + std::to_string(i)),
+            FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK);
+        ASSERT_EQ(loadAuthenticationStatusFile.addHeaderFile(headerFile),
+            FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK);
+    }
+
+    std::shared_ptr<std::vector<uint8_t>> data = std::make_shared<std::vector<uint8_t>>();
+    ASSERT_EQ(loadAuthenticationStatusFile.serialize(data),
+              SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK);
+
+    size_t fileSize = 0;
+    loadAuthenticationStatusFile.getFileSize(fileSize);
+    uint32_t fileLength = 0;
+    loadAuthenticationStatusFile.getFileLength(fileLength);
+    ASSERT_EQ(fileSize, data->size());
+    ASSERT_EQ(fileLength, data->size());
+
+    std::vector<uint8_t> buffer(fileSize);
+    size_t written = 0;
+    ASSERT_EQ(loadAuthenticationStatusFile.serializeInto(buffer.data(), buffer.size(), written),
+              SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK);
+    ASSERT_EQ(written, data->size());
+    ASSERT_EQ(buffer, *data);
+
+    // Every buffer smaller than the file must be rejected
+    for (size_t capacity = 0; capacity < fileSize; capacity++)
+    {
+        ASSERT_EQ(loadAuthenticationStatusFile.serializeInto(buffer.data(), capacity, written),
+                  SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR);
+    }
+}
+
 TEST(AuthenticationFilesTest, LoadAuthenticationStatusFileDeserialization)
 {
     std::shared_ptr<std::vector<uint8_t>> data = std::make_shared<std::vector<uint8_t>>();
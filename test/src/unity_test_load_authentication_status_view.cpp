@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+
+#include "LoadAuthenticationStatusView.h"
+
+static void buildLoadAuthenticationStatusFile(LoadAuthenticationStatusFile &loadAuthenticationStatusFile)
+{
+    loadAuthenticationStatusFile.setAuthenticationOperationStatusCode(0x4141);
+    loadAuthenticationStatusFile.setAuthenticationStatusDescription("TEST_STATUS_DESCRIPTION");
+    loadAuthenticationStatusFile.setCounter(72);
+    loadAuthenticationStatusFile.setExceptionTimer(73);
+    loadAuthenticationStatusFile.setEstimatedTime(74);
+    loadAuthenticationStatusFile.setLoadListRatio(75);
+
+    for (int i = 0; i < 3; i++)
+    {
+        LoadAuthenticationStatusHeaderFile headerFile;
+        headerFile.setHeaderFileName("TEST_FILE" + std::to_string(i) + ".TEST");
+        headerFile.setLoadPartNumberName("TEST_PART_NUMBER" + std::to_string(i));
+        headerFile.setLoadRatio(42 + i);
+        headerFile.setLoadStatus(0x4242 + i);
+        headerFile.setLoadStatusDescription("TEST_STATUS_DESCRIPTION" + std::to_string(i));
+        loadAuthenticationStatusFile.addHeaderFile(headerFile);
+    }
+}
+
+TEST(AuthenticationFilesTest, LoadAuthenticationStatusViewParse)
+{
+    LoadAuthenticationStatusFile loadAuthenticationStatusFile("TEST_FILE.TEST", "A4");
+    buildLoadAuthenticationStatusFile(loadAuthenticationStatusFile);
+
+    std::shared_ptr<std::vector<uint8_t>> data = std::make_shared<std::vector<uint8_t>>();
+    ASSERT_EQ(loadAuthenticationStatusFile.serialize(data),
+              SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK);
+
+    // Trailing bytes after the file length are not part of the file
+    data->resize(data->size() + 100, 0xFF);
+
+    LoadAuthenticationStatusView loadAuthenticationStatusView;
+    ASSERT_EQ(loadAuthenticationStatusView.parse(data->data(), data->size()),
+              SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK);
+
+    uint32_t fileLength = 0;
+    ASSERT_EQ(loadAuthenticationStatusView.getFileLength(fileLength),
+              FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_OK);
+    ASSERT_EQ(fileLength, data->size() - 100);
+
+    AuthenticationFieldView protocolVersion;
+    loadAuthenticationStatusView.getProtocolVersion(protocolVersion);
+    ASSERT_EQ(protocolVersion.size(), 2);
+    ASSERT_TRUE(protocolVersion.equals("A4"));
+
+    uint16_t authenticationOperationStatusCode = 0;
+    loadAuthenticationStatusView.getAuthenticationOperationStatusCode(authenticationOperationStatusCode);
+    ASSERT_EQ(authenticationOperationStatusCode, 0x4141);
+
+    AuthenticationFieldView authenticationStatusDescription;
+    loadAuthenticationStatusView.getAuthenticationStatusDescription(authenticationStatusDescription);
+    ASSERT_EQ(authenticationStatusDescription.size(), strlen("TEST_STATUS_DESCRIPTION") + 1);
+    ASSERT_EQ(authenticationStatusDescription.toString(), "TEST_STATUS_DESCRIPTION");
+    // The view points into the wire buffer, it does not copy it
+    ASSERT_GE(authenticationStatusDescription.data(), data->data());
+    ASSERT_LT(authenticationStatusDescription.data(), data->data() + data->size());
+
+    uint16_t counter = 0;
+    uint16_t exceptionTimer = 0;
+    uint16_t estimatedTime = 0;
+    uint32_t loadListRatio = 0;
+    uint16_t numberOfHeaderFiles = 0;
+    loadAuthenticationStatusView.getCounter(counter);
+    loadAuthenticationStatusView.getExceptionTimer(exceptionTimer);
+    loadAuthenticationStatusView.getEstimatedTime(estimatedTime);
+    loadAuthenticationStatusView.getLoadListRatio(loadListRatio);
+    loadAuthenticationStatusView.getNumberOfHeaderFiles(numberOfHeaderFiles);
+    ASSERT_EQ(counter, 72);
+    ASSERT_EQ(exceptionTimer, 73);
+    ASSERT_EQ(estimatedTime, 74);
+    ASSERT_EQ(loadListRatio, 75);
+    ASSERT_EQ(numberOfHeaderFiles, 3);
+
+    int i = 0;
+    for (const LoadAuthenticationStatusHeaderView &headerFile : loadAuthenticationStatusView)
+    {
+        AuthenticationFieldView headerFileName;
+        AuthenticationFieldView loadPartNumberName;
+        AuthenticationFieldView loadStatusDescription;
+        uint32_t loadRatio = 0;
+        uint16_t loadStatus = 0;
+        headerFile.getHeaderFileName(headerFileName);
+        headerFile.getLoadPartNumberName(loadPartNumberName);
+        headerFile.getLoadRatio(loadRatio);
+        headerFile.getLoadStatus(loadStatus);
+        headerFile.getLoadStatusDescription(loadStatusDescription);
+
+        ASSERT_TRUE(headerFileName.equals("TEST_FILE" + std::to_string(i) + ".TEST"));
+        ASSERT_TRUE(loadPartNumberName.equals("TEST_PART_NUMBER" + std::to_string(i)));
+        ASSERT_EQ(loadRatio, 42 + i);
+        ASSERT_EQ(loadStatus, 0x4242 + i);
+        ASSERT_EQ(loadStatusDescription.toString(), "TEST_STATUS_DESCRIPTION" + std::to_string(i));
+        i++;
+    }
+    ASSERT_EQ(i, 3);
+}
+
+TEST(AuthenticationFilesTest, LoadAuthenticationStatusViewTruncated)
+{
+    LoadAuthenticationStatusFile loadAuthenticationStatusFile("TEST_FILE.TEST", "A4");
+    buildLoadAuthenticationStatusFile(loadAuthenticationStatusFile);
+
+    std::shared_ptr<std::vector<uint8_t>> data = std::make_shared<std::vector<uint8_t>>();
+    ASSERT_EQ(loadAuthenticationStatusFile.serialize(data),
+              SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK);
+
+    // Every truncated buffer must be rejected
+    LoadAuthenticationStatusView loadAuthenticationStatusView;
+    for (size_t size = 0; size < data->size(); size++)
+    {
+        ASSERT_EQ(loadAuthenticationStatusView.parse(data->data(), size),
+                  SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR);
+    }
+
+    // A file length shorter than the fields must be rejected too
+    (*data)[3] -= 1;
+    ASSERT_EQ(loadAuthenticationStatusView.parse(data->data(), data->size()),
+              SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR);
+
+    uint16_t counter = 0;
+    ASSERT_EQ(loadAuthenticationStatusView.getCounter(counter),
+              FileAuthenticationOperationResult::FILE_AUTHENTICATION_OPERATION_ERROR);
+    ASSERT_TRUE(loadAuthenticationStatusView.begin() == loadAuthenticationStatusView.end());
+}
+
+TEST(AuthenticationFilesTest, LoadAuthenticationStatusViewPeekCounter)
+{
+    LoadAuthenticationStatusFile loadAuthenticationStatusFile("TEST_FILE.TEST", "A4");
+    buildLoadAuthenticationStatusFile(loadAuthenticationStatusFile);
+
+    std::shared_ptr<std::vector<uint8_t>> data = std::make_shared<std::vector<uint8_t>>();
+    ASSERT_EQ(loadAuthenticationStatusFile.serialize(data),
+              SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK);
+
+    uint16_t counter = 0;
+    ASSERT_EQ(LoadAuthenticationStatusView::peekCounter(data->data(), data->size(), counter),
+              SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK);
+    ASSERT_EQ(counter, 72);
+
+    // Only the fields up to the counter are needed
+    size_t counterEnd = 4 + 2 + 2 + 1 + strlen("TEST_STATUS_DESCRIPTION") + 1 + 2;
+    ASSERT_EQ(LoadAuthenticationStatusView::peekCounter(data->data(), counterEnd, counter),
+              SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR);
+    (*data)[0] = 0;
+    (*data)[1] = 0;
+    (*data)[2] = 0;
+    (*data)[3] = static_cast<uint8_t>(counterEnd);
+    counter = 0;
+    ASSERT_EQ(LoadAuthenticationStatusView::peekCounter(data->data(), counterEnd, counter),
+              SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_OK);
+    ASSERT_EQ(counter, 72);
+    ASSERT_EQ(LoadAuthenticationStatusView::peekCounter(data->data(), counterEnd - 1, counter),
+              SerializableAuthenticationOperationResult::SERIALIZABLE_AUTHENTICATION_ERROR);
+}